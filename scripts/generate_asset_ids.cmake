@@ -0,0 +1,154 @@
+# Turns src/resources/assets.manifest into the headers resources/assetManifest.hpp builds on:
+#   assetIds.hpp          enum class AssetGroup / TextureId / SoundId and their counts
+#   textureManifest.inc   one kTextureManifest row per TextureId, in enum order
+#   soundManifest.inc     one kSoundManifest row per SoundId, in enum order
+#   assetIds.stamp        touched on every run; the build depends on it, not on the headers
+# Run with cmake -DMANIFEST=<file> -DOUTPUT_DIR=<dir> -P generate_asset_ids.cmake.
+# Outputs are only rewritten when their content changes, so unrelated edits do not rebuild.
+
+cmake_minimum_required(VERSION 3.16)
+
+if(NOT MANIFEST OR NOT OUTPUT_DIR)
+    message(FATAL_ERROR "generate_asset_ids.cmake needs -DMANIFEST=... and -DOUTPUT_DIR=...")
+endif()
+
+# "heal_potion" -> "HealPotion"
+function(to_pascal_case input out_var)
+    string(REPLACE "_" ";" parts "${input}")
+    set(result "")
+    foreach(part IN LISTS parts)
+        string(SUBSTRING "${part}" 0 1 head)
+        string(SUBSTRING "${part}" 1 -1 tail)
+        string(TOUPPER "${head}" head)
+        string(APPEND result "${head}${tail}")
+    endforeach()
+    set(${out_var} "${result}" PARENT_SCOPE)
+endfunction()
+
+function(write_if_different path content)
+    file(WRITE "${path}.tmp" "${content}")
+    execute_process(COMMAND ${CMAKE_COMMAND} -E copy_if_different "${path}.tmp" "${path}")
+    file(REMOVE "${path}.tmp")
+endfunction()
+
+set(groups "")
+set(texture_ids "")
+set(sound_ids "")
+set(texture_rows "")
+set(sound_rows "")
+set(line_number 0)
+
+file(STRINGS "${MANIFEST}" lines ENCODING UTF-8)
+foreach(line IN LISTS lines)
+    math(EXPR line_number "${line_number} + 1")
+    string(STRIP "${line}" line)
+    if(line STREQUAL "" OR line MATCHES "^#")
+        continue()
+    endif()
+    if(NOT line MATCHES "^(texture|cached|sound)[ \t]+([A-Za-z][A-Za-z0-9]*)[ \t]+([a-z][a-z0-9_]*)[ \t]+\"([^\"]*)\"[ \t]+\"([^\"]*)\"[ \t]*(.*)$")
+        message(FATAL_ERROR "${MANIFEST}:${line_number}: expected: kind id group \"path\" \"label\" [flags]")
+    endif()
+    set(kind "${CMAKE_MATCH_1}")
+    set(id "${CMAKE_MATCH_2}")
+    set(group "${CMAKE_MATCH_3}")
+    set(path "${CMAKE_MATCH_4}")
+    set(label "${CMAKE_MATCH_5}")
+    separate_arguments(flags UNIX_COMMAND "${CMAKE_MATCH_6}")
+
+    if(NOT group IN_LIST groups)
+        list(APPEND groups "${group}")
+    endif()
+    to_pascal_case("${group}" group_name)
+
+    set(trim false)
+    set(atlas false)
+    set(lod false)
+    set(item_key nullptr)
+    foreach(flag IN LISTS flags)
+        if(flag STREQUAL "trim")
+            set(trim true)
+        elseif(flag STREQUAL "atlas")
+            set(atlas true)
+        elseif(flag STREQUAL "lod")
+            set(lod true)
+        elseif(flag MATCHES "^item=([a-z0-9_]+)$")
+            set(item_key "\"${CMAKE_MATCH_1}\"")
+        else()
+            message(FATAL_ERROR "${MANIFEST}:${line_number}: unknown flag '${flag}'")
+        endif()
+    endforeach()
+
+    if(kind STREQUAL "sound")
+        if(id IN_LIST sound_ids)
+            message(FATAL_ERROR "${MANIFEST}:${line_number}: duplicate sound id ${id}")
+        endif()
+        if(trim OR atlas OR lod OR NOT item_key STREQUAL "nullptr")
+            message(FATAL_ERROR "${MANIFEST}:${line_number}: sounds take no flags")
+        endif()
+        list(APPEND sound_ids "${id}")
+        string(APPEND sound_rows "    { \"${path}\", \"${label}\", AssetGroup::${group_name} }, // SoundId::${id}\n")
+    else()
+        if(id IN_LIST texture_ids)
+            message(FATAL_ERROR "${MANIFEST}:${line_number}: duplicate texture id ${id}")
+        endif()
+        set(cached false)
+        if(kind STREQUAL "cached")
+            set(cached true)
+        elseif(trim)
+            message(FATAL_ERROR "${MANIFEST}:${line_number}: trim only applies to cached textures")
+        endif()
+        if(cached AND atlas)
+            message(FATAL_ERROR "${MANIFEST}:${line_number}: cached textures cannot go onto the icon atlas")
+        endif()
+        if(cached AND lod)
+            message(FATAL_ERROR "${MANIFEST}:${line_number}: lod only applies to textures loaded by loadAll")
+        endif()
+        list(APPEND texture_ids "${id}")
+        string(APPEND texture_rows "    { \"${path}\", \"${label}\", AssetGroup::${group_name}, ${cached}, ${trim}, ${atlas}, ${lod}, ${item_key} }, // TextureId::${id}\n")
+    endif()
+endforeach()
+
+set(banner "// Generated by scripts/generate_asset_ids.cmake from src/resources/assets.manifest; edit the manifest instead.\n")
+
+set(ids "${banner}#pragma once\n")
+string(APPEND ids "// === C++ Libraries ===\n")
+string(APPEND ids "#include <cstddef>  // Provides std::size_t for the counts.\n")
+string(APPEND ids "#include <cstdint>  // Fixes the width of the id enums.\n\n")
+string(APPEND ids "// Groups named in the manifest, in order of first appearance.\n")
+string(APPEND ids "enum class AssetGroup : std::uint8_t {\n")
+set(group_names "")
+foreach(group IN LISTS groups)
+    to_pascal_case("${group}" group_name)
+    string(APPEND ids "    ${group_name},\n")
+    string(APPEND group_names "    \"${group}\",\n")
+endforeach()
+string(APPEND ids "};\n\n")
+string(APPEND ids "// Index into assets::kTextureManifest and the texture slots of Resources.\n")
+string(APPEND ids "enum class TextureId : std::uint16_t {\n")
+foreach(id IN LISTS texture_ids)
+    string(APPEND ids "    ${id},\n")
+endforeach()
+string(APPEND ids "};\n\n")
+string(APPEND ids "// Index into assets::kSoundManifest and the sound buffers of Resources.\n")
+string(APPEND ids "enum class SoundId : std::uint16_t {\n")
+foreach(id IN LISTS sound_ids)
+    string(APPEND ids "    ${id},\n")
+endforeach()
+string(APPEND ids "};\n\n")
+list(LENGTH groups group_count)
+list(LENGTH texture_ids texture_count)
+list(LENGTH sound_ids sound_count)
+string(APPEND ids "namespace assets {\n")
+string(APPEND ids "inline constexpr std::size_t kAssetGroupCount = ${group_count};\n")
+string(APPEND ids "inline constexpr std::size_t kTextureCount = ${texture_count};\n")
+string(APPEND ids "inline constexpr std::size_t kSoundCount = ${sound_count};\n\n")
+string(APPEND ids "// Group names as spelled in the manifest, indexed by AssetGroup.\n")
+string(APPEND ids "inline constexpr const char* kAssetGroupNames[kAssetGroupCount] = {\n${group_names}};\n")
+string(APPEND ids "} // namespace assets\n")
+
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+write_if_different("${OUTPUT_DIR}/assetIds.hpp" "${ids}")
+write_if_different("${OUTPUT_DIR}/textureManifest.inc" "${banner}${texture_rows}")
+write_if_different("${OUTPUT_DIR}/soundManifest.inc" "${banner}${sound_rows}")
+# The outputs keep their old timestamps when unchanged, so the build tracks this stamp instead.
+file(TOUCH "${OUTPUT_DIR}/assetIds.stamp")
@@ -1,9 +1,23 @@
+// === C++ Libraries ===
+#include <iostream>  // Logs music files that could not be opened for streaming.
+#include <utility>   // Moves the cached bytes into the stream that uses them.
 // === SFML Libraries ===
-#include <SFML/Audio.hpp>    // Brings sf::Sound and sf::SoundBuffer used inside the implementation.
+#include <SFML/Audio.hpp>    // Brings sf::Sound and sf::Music used inside the implementation.
 // === Header Files ===
 #include "audio/audioManager.hpp"  // Declares AudioManager whose member functions are defined here.
+#include "resources/assetFiles.hpp"  // Opens packed music without copying it.
+#include "resources/assetPack.hpp"   // Tells packed tracks apart from loose ones.
+#include "resources/assetUsage.hpp"  // Notes text blip and music plays for --trace-asset-usage.
+
+namespace {
+// Every opened stream is played right away, so --trace-asset-usage counts the open as a play.
+void noteStreamOpened(const std::string& path) {
+    if (assets::usageTracer().enabled())
+        assets::usageTracer().noteMusic(path);
+}
+} // namespace
 
-const sf::SoundBuffer* AudioManager::locationMusicBuffer(LocationId id) const {
+const std::string* AudioManager::locationMusicPath(LocationId id) const {
     if (!resources)
         return nullptr;
 
@@ -21,70 +35,109 @@ const sf::SoundBuffer* AudioManager::locationMusicBuffer(LocationId id) const {
     }
 }
 
+// Points the stream at path. Only the header is parsed here; decoding happens on SFML's
+// streaming thread while the track plays, so switching tracks never decodes a whole file.
+bool AudioManager::openStream(MusicStream& stream, const std::string& path) {
+    // Packed tracks stream straight from the mapping, which outlives every stream.
+    if (assets::mountedPack().contains(path)) {
+        if (!stream.music)
+            stream.music.emplace();
+        if (!assets::openMusic(*stream.music, path)) {
+            std::cout << "Failed to stream " << path << "\n";
+            return false;
+        }
+        stream.bytes.reset();
+        noteStreamOpened(path);
+        return true;
+    }
+
+    MusicCache::Bytes bytes = musicCache.get(path);
+    if (!bytes)
+        return false;
+
+    if (!stream.music)
+        stream.music.emplace();
+    if (!stream.music->openFromMemory(bytes->data(), bytes->size())) {
+        std::cout << "Failed to stream " << path << "\n";
+        return false;
+    }
+    // Swap only after the reopen so the previous bytes outlive the old stream.
+    stream.bytes = std::move(bytes);
+    noteStreamOpened(path);
+    return true;
+}
+
 void AudioManager::init(Resources& res) {
     resources = &res;
     if (!textBlipSound)
-        textBlipSound.emplace(resources->typewriter);
-
-    if (!titleScreenSound) {
-        titleScreenSound.emplace(resources->introTitle);
-        titleScreenSound->setLooping(true);
-        titleScreenSound->setVolume(0.f);
-    }
+        textBlipSound.emplace(resources->sound(SoundId::Typewriter));
 }
 
 void AudioManager::startLocationMusic(LocationId id) {
     if (!resources)
         return;
 
-    const sf::SoundBuffer* buffer = locationMusicBuffer(id);
-    if (!buffer)
+    const std::string* path = locationMusicPath(id);
+    if (!path)
         return;
 
     locationMusicFade.active = false;
 
-    if (!locationMusic)
-        locationMusic.emplace(*buffer);
-    else
-        locationMusic->setBuffer(*buffer);
+    if (!openStream(locationMusic, *path))
+        return;
 
-    locationMusic->setLooping(true);
-    locationMusic->setVolume(0.f);
-    locationMusic->play();
+    locationMusic.music->setLooping(true);
+    locationMusic.music->setVolume(0.f);
+    locationMusic.music->play();
     locationMusicId = id;
 
     sound::startFade(locationMusicFade, 0.f, 100.f, 1.5f);
 }
 
+void AudioManager::prefetchLocationMusic(LocationId id) {
+    const std::string* path = locationMusicPath(id);
+    if (path && !assets::mountedPack().contains(*path))
+        musicCache.prefetch(*path);
+}
+
+bool AudioManager::locationMusicStaged(LocationId id) const {
+    const std::string* path = locationMusicPath(id);
+    if (!path || assets::mountedPack().contains(*path))
+        return true;
+    return musicCache.isResident(*path) && !musicCache.stalledOnPrefetch(*path);
+}
+
 void AudioManager::fadeOutLocationMusic(float duration) {
-    if (!locationMusic || locationMusic->getStatus() != sf::Sound::Status::Playing)
+    if (!locationMusic.music || locationMusic.music->getStatus() != sf::SoundSource::Status::Playing)
         return;
 
-    float startVol = locationMusic->getVolume();
+    float startVol = locationMusic.music->getVolume();
     sound::startFade(locationMusicFade, startVol, 0.f, duration);
 }
 
 void AudioManager::startTitleScreenMusic() {
-    if (titleScreenMusicStarted || !titleScreenSound)
+    if (titleScreenMusicStarted || !resources)
+        return;
+    if (!openStream(titleScreenMusic, resources->introTitle))
         return;
 
-    titleScreenSound->setLooping(true);
-    titleScreenSound->setVolume(0.f);
-    titleScreenSound->play();
+    titleScreenMusic.music->setLooping(true);
+    titleScreenMusic.music->setVolume(0.f);
+    titleScreenMusic.music->play();
     sound::startFade(titleScreenFade, 0.f, 100.f, 2.0f);
     titleScreenMusicStarted = true;
 }
 
 void AudioManager::fadeOutTitleScreenMusic(float duration) {
-    if (!titleScreenSound)
+    if (!titleScreenMusic.music)
         return;
 
-    float startVol = titleScreenSound->getVolume();
-    if (titleScreenSound->getStatus() != sf::Sound::Status::Playing && startVol <= 0.f)
+    float startVol = titleScreenMusic.music->getVolume();
+    if (titleScreenMusic.music->getStatus() != sf::SoundSource::Status::Playing && startVol <= 0.f)
         return;
 
     if (startVol <= 0.f) {
-        titleScreenSound->stop();
+        titleScreenMusic.music->stop();
         return;
     }
 
@@ -92,19 +145,19 @@ void AudioManager::fadeOutTitleScreenMusic(float duration) {
 }
 
 float AudioManager::locationMusicVolume() const {
-    if (!locationMusic)
+    if (!locationMusic.music)
         return 100.f;
-    return locationMusic->getVolume();
+    return locationMusic.music->getVolume();
 }
 
 bool AudioManager::hasLocationMusic() const {
-    return static_cast<bool>(locationMusic);
+    return static_cast<bool>(locationMusic.music);
 }
 
 void AudioManager::setLocationMusicVolume(float volume) {
-    if (!locationMusic)
+    if (!locationMusic.music)
         return;
-    locationMusic->setVolume(volume);
+    locationMusic.music->setVolume(volume);
 }
 
 void AudioManager::cancelLocationMusicFade() {
@@ -115,36 +168,36 @@ void AudioManager::startIntroDialogueMusic() {
     if (!resources)
         return;
 
-    if (introDialogueSound && introDialogueSound->getStatus() == sf::Sound::Status::Playing)
+    if (introDialogueMusic.music && introDialogueMusic.music->getStatus() == sf::SoundSource::Status::Playing)
         return;
 
-    if (!introDialogueSound)
-        introDialogueSound.emplace(resources->introDialogue);
-    else
-        introDialogueSound->setBuffer(resources->introDialogue);
+    if (!openStream(introDialogueMusic, resources->introDialogue))
+        return;
 
-    introDialogueSound->setLooping(true);
-    introDialogueSound->setVolume(80.f);
-    introDialogueSound->play();
+    introDialogueMusic.music->setLooping(true);
+    introDialogueMusic.music->setVolume(80.f);
+    introDialogueMusic.music->play();
 }
 
 void AudioManager::stopIntroDialogueMusic() {
-    if (!introDialogueSound)
+    if (!introDialogueMusic.music)
         return;
-    introDialogueSound->stop();
+    introDialogueMusic.music->stop();
 }
 
 void AudioManager::update() {
-    sound::processFade(locationMusic, locationMusicFade, [this]() { locationMusicId.reset(); });
-    sound::processFade(titleScreenSound, titleScreenFade, []() {});
+    sound::processFade(locationMusic.music, locationMusicFade, [this]() { locationMusicId.reset(); });
+    sound::processFade(titleScreenMusic.music, titleScreenFade, []() {});
 }
 
 void AudioManager::startTypingSound() {
     if (!textBlipSound)
         return;
 
-    if (textBlipSound->getStatus() != sf::Sound::Status::Playing)
+    if (textBlipSound->getStatus() != sf::Sound::Status::Playing) {
+        assets::notePlay(*textBlipSound);
         textBlipSound->play();
+    }
 }
 
 void AudioManager::stopTypingSound() {
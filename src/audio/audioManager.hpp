@@ -1,9 +1,11 @@
 #pragma once
 // === C++ Libraries ===
 #include <optional>  // Captures optional sound handles and the current location ID.
+#include <string>    // Names the music file a stream is opened from.
 // === SFML Libraries ===
-#include <SFML/Audio.hpp>  // Declares sf::Sound and sf::SoundBuffer used by the manager.
+#include <SFML/Audio.hpp>  // Declares sf::Sound and sf::Music used by the manager.
 // === Header Files ===
+#include "audio/musicCache.hpp"        // Keeps the compressed music files the streams read from.
 #include "helper/soundHelper.hpp"      // Offers the fade helpers used when ramping volumes.
 #include "rendering/locations.hpp"     // Provides LocationId for selecting music per location.
 #include "resources/resources.hpp"     // Supplies the Resources struct that holds all buffers.
@@ -15,6 +17,11 @@ public:
     void init(Resources& resources);
 
     void startLocationMusic(LocationId id);
+    // Reads the location's track into memory in the background (packed tracks need nothing).
+    void prefetchLocationMusic(LocationId id);
+    // True if the track was in memory (or packed) by the time it was opened or, if it was not
+    // opened yet, is now.
+    bool locationMusicStaged(LocationId id) const;
     void fadeOutLocationMusic(float duration);
 
     void startTitleScreenMusic();
@@ -33,15 +40,23 @@ public:
     void stopTypingSound();
 
 private:
-    const sf::SoundBuffer* locationMusicBuffer(LocationId id) const;
+    // A streamed track plus the compressed bytes it decodes from, which must outlive playback.
+    struct MusicStream {
+        std::optional<sf::Music> music;
+        MusicCache::Bytes bytes;
+    };
+
+    const std::string* locationMusicPath(LocationId id) const;
+    bool openStream(MusicStream& stream, const std::string& path);
 
     Resources* resources = nullptr;
+    MusicCache musicCache;
     std::optional<sf::Sound> textBlipSound;
-    std::optional<sf::Sound> locationMusic;
+    MusicStream locationMusic;
     std::optional<LocationId> locationMusicId;
     SoundFadeState locationMusicFade;
-    std::optional<sf::Sound> titleScreenSound;
-    std::optional<sf::Sound> introDialogueSound;
+    MusicStream titleScreenMusic;
+    MusicStream introDialogueMusic;
     SoundFadeState titleScreenFade;
     bool titleScreenMusicStarted = false;
 };
@@ -0,0 +1,43 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>  // Provides std::byte and std::size_t for the cached file contents.
+#include <future>   // Holds files that are still being read by prefetch().
+#include <list>     // Keeps the cached files in most-recently-used order.
+#include <memory>   // Shares the bytes with the sf::Music that is streaming from them.
+#include <string>   // Keys the cache by file path.
+#include <vector>   // Owns the compressed bytes of one file.
+
+// Small LRU cache of compressed music files. sf::Music streams and decodes from these bytes,
+// so only the encoded MP3 data stays resident instead of a fully decoded sf::SoundBuffer.
+class MusicCache {
+public:
+    using Bytes = std::shared_ptr<const std::vector<std::byte>>;
+
+    explicit MusicCache(std::size_t maxEntries = 4);
+
+    // Returns the file contents, reading them from disk on first use (nullptr if unreadable).
+    // Evicted entries stay alive for as long as a caller still holds the returned pointer.
+    Bytes get(const std::string& path);
+
+    // Starts reading the file on a background thread so a later get() finds it in memory.
+    void prefetch(const std::string& path);
+    // True once the file is in memory (a finished prefetch counts).
+    bool isResident(const std::string& path) const;
+    // True if the last get() of path had to wait for its unfinished prefetch.
+    bool stalledOnPrefetch(const std::string& path) const;
+
+private:
+    struct Entry {
+        std::string path;
+        Bytes bytes;
+        std::future<Bytes> pending;  // Set while prefetch() is still reading.
+        bool stalled = false;
+    };
+
+    static Bytes readFile(const std::string& path);
+    std::list<Entry>::iterator find(const std::string& path);
+    void insert(Entry entry);
+
+    std::list<Entry> entries;  // Most recently used first.
+    std::size_t capacity;
+};
@@ -1,7 +1,8 @@
 #pragma once
 // === SFML Libraries ===
-#include <SFML/System/Clock.hpp>
 #include <SFML/System/Time.hpp>
+// === Header Files ===
+#include "core/simulationClock.hpp"
 
 namespace core {
 
@@ -27,7 +28,7 @@ private:
     bool fadeOutActive_ = false;       // True while the screen is fading to black.
     bool fadeInActive_ = false;        // True while the end text is fading in.
     bool screenVisible_ = false;       // Set once the final screen is fully visible.
-    sf::Clock clock_;                  // Tracks the current phase duration.
+    SimClock clock_;                  // Tracks the current phase duration.
     float fadeOutDuration_ = 2.0f;     // How long the blackout takes.
     float fadeInDuration_ = 3.0f;      // How long the text fade-in takes.
 };
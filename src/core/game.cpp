@@ -1,11 +1,13 @@
 // === C++ Libraries ===
 #include <algorithm>  // Searches quest log entries and clamps XP.
 #include <cstddef>    // Needed for std::size_t definitions like playerNameMaxLength.
+#include <cstdint>    // Sizes the 16-bit samples counted by the memory report.
 #include <cstdlib>    // Provides std::exit for the fatal resource-loading failure path.
 #include <ctime>      // Formats the start timestamp stored for each run.
 #include <cmath>      // Provides pow/round used for XP curve.
 #include <iostream>   // Used for logging resource errors via std::cout.
 #include <chrono>     // Tracks session start/finish times for the leaderboard.
+#include <utility>    // Uses std::exchange to clear the per-frame map flag.
 // === SFML Libraries ===
 #include <SFML/Graphics.hpp>  // Provides sf::Color for palette logic applied to UI boxes.
 #include <SFML/System/Clock.hpp>
@@ -18,13 +20,20 @@
 #include "helper/layoutHelpers.hpp"   // Defines ui::layout::updateLayout used by Game::updateLayout.
 #include "helper/weaponHelpers.hpp"   // Offers ui::weapons::loadWeaponOptions for weapon setup.
 #include "helper/healingPotion.hpp"   // Manages the healing potion timer granted by Wanda Rinn.
+#include "core/memoryRegistry.hpp"    // Receives the memory sources registered after loading.
+#include "rendering/glyphBatch.hpp"   // Measures the glyph pages behind the dialogue text.
+#include "resources/contentStore.hpp" // Counts the textures loaded outside the manifest.
+#include "resources/assetUsage.hpp"   // Attributes asset uses to the current scene for --trace-asset-usage.
+#include "resources/textureLod.hpp"   // Counts the downscaled texture levels.
 #include "rendering/dialogRender.hpp" // Renders the dialog UI via renderGame in the game loop.
 #include "story/dialogInput.hpp"      // Contains waitForEnter and dialog flow helpers used in the loop.
 #include "story/dialogueLine.hpp"     // Supplies the DialogueLine type processed while waiting for Enter.
 #include "story/storyIntro.hpp"       // Provides the intro dialogue vector that Game starts with.
 #include "story/textStyles.hpp"       // Gives TextStyles used for speaker colors and UI states.
 #include "ui/confirmationUI.hpp"      // Declares confirmationPrompt handling invoked while running the loop.
+#include "ui/dialogUI.hpp"            // Declares advanceTypewriter run on every simulation step.
 #include "ui/introTitle.hpp"          // Declares intro title helpers used during the intro screen.
+#include "ui/loadingScreen.hpp"       // Draws the progress bar while Resources::loadAll runs.
 #include "ui/battleUI.hpp"            // Draws the temporary Pokemon battle demo overlay.
 #include "ui/genderSelectionUI.hpp"   // Handles the dragonborn selection overlay.
 #include "ui/mapSelectionUI.hpp"      // Declares handleMapSelectionEvent invoked for map choices.
@@ -37,6 +46,10 @@
 constexpr unsigned int windowWidth = 1280;
 constexpr unsigned int windowHeight = 720;
 constexpr unsigned int fpsLimit = 60;
+constexpr sf::Time kSimulationStep = sf::seconds(1.f / 120.f);  // Fixed simulation rate, independent of fpsLimit.
+constexpr sf::Time kMaxFrameTime = sf::seconds(0.25f);          // Longest frame fed into the accumulator.
+constexpr int kMaxCatchUpSteps = 8;                             // Steps allowed per frame before dropping backlog.
+constexpr sf::Time kMapReleaseDelay = sf::seconds(10.f);        // Map group kept this long after its last frame.
 constexpr std::size_t playerNameMaxLength = 18;
 
 constexpr float kXpCurveExponent = 1.2f;
@@ -52,38 +65,31 @@ inline int xpForLevel(int level) {
     return std::max(5, rounded);
 }
 
-namespace {
-    const sf::Texture* backgroundForLocation(const Game& game, LocationId id) {
-        switch (id) {
-            case LocationId::Perigonal: return &game.resources.backgroundPetrigonal;
-            case LocationId::Gonad: return &game.resources.backgroundGonad;
-            case LocationId::FigsidsForge: return &game.resources.backgroundBlacksmith;
-            case LocationId::Blyathyroid: return &game.resources.backgroundBlyathyroid;
-            case LocationId::Lacrimere: return &game.resources.backgroundLacrimere;
-            case LocationId::Cladrenal: return &game.resources.backgroundCladrenal;
-            case LocationId::Aerobronchi: return &game.resources.backgroundAerobronchi;
-            case LocationId::Seminiferous: return &game.resources.backgroundSeminiferous;
-            case LocationId::UmbraOssea: return &game.resources.backgroundUmbraOssea;
-            default: return nullptr;
-        }
-    }
-}
-
 // Sets up resources, audio, and UI state for a new Game instance.
-Game::Game()
+Game::Game(const LaunchOptions& options)
 : window(sf::VideoMode({windowWidth, windowHeight}), "Glandular", sf::Style::Titlebar | sf::Style::Close)
+, launchOptions(options)
 {
-    if (!resources.loadAll()) {
+    // Decode on worker threads; this thread uploads and keeps the loading screen alive.
+    auto onLoadProgress = [this](const assets::LoadProgress& progress) {
+        renderLoadingScreen(*this, progress);
+    };
+    resources.textures.setBudget(static_cast<std::size_t>(launchOptions.textureBudgetMb) * 1024 * 1024);
+    if (!resources.loadAll(launchOptions.loadThreads, onLoadProgress)) {
         std::cout << "Fatal: konnte Ressourcen nicht laden.\n";
         std::exit(1);
     }
+    // Only after loadAll: its uploads are synchronous anyway, and the window's context exists now.
+    if (launchOptions.backgroundUploads)
+        resources.textures.enableBackgroundUploads();
+    introAssets.acquire();
     audioManager.init(resources);
     itemController.init(resources);
     teleportController.loadResources(resources);
-    setBackgroundTexture(resources.introBackground);
+    setBackgroundTexture(resources.texture(TextureId::IntroBackground));
     backgroundFadeInActive = false;
     backgroundVisible = true;
-    returnSprite.emplace(resources.returnSymbol);
+    returnSprite.emplace(resources.texture(TextureId::ReturnSymbol));
     returnSprite->setColor(ColorHelper::Palette::IconGray);
 
     locations = Locations::buildLocations(resources);
@@ -92,27 +98,27 @@ Game::Game()
     blacksmithLocation.name = "Figsid's Forge";
     blacksmithLocation.color = ColorHelper::Palette::SoftYellow;
 
-    enterSound.emplace(resources.enterKey);
-    confirmSound.emplace(resources.confirm);
-    rejectSound.emplace(resources.reject);
-    startGameSound.emplace(resources.startGame);
-    buttonHoverSound.emplace(resources.buttonHovered);
+    enterSound.emplace(resources.sound(SoundId::EnterKey));
+    confirmSound.emplace(resources.sound(SoundId::Confirm));
+    rejectSound.emplace(resources.sound(SoundId::Reject));
+    startGameSound.emplace(resources.sound(SoundId::StartGame));
+    buttonHoverSound.emplace(resources.sound(SoundId::ButtonHovered));
     buttonHoverSound->setVolume(120.f);
-    introTitleHoverSound.emplace(resources.titleButtons);
+    introTitleHoverSound.emplace(resources.sound(SoundId::TitleButtons));
     introTitleHoverSound->setVolume(120.f);
-    menuOpenSound.emplace(resources.openMenu);
-    menuCloseSound.emplace(resources.closeMenu);
-    quizLoggingSound.emplace(resources.quizLoggingAnswer);
-    quizCorrectSound.emplace(resources.quizAnswerCorrect);
-    quizIncorrectSound.emplace(resources.quizAnswerIncorrect);
-    quizStartSound.emplace(resources.quizStart);
-    quizQuestionStartSound.emplace(resources.quizQuestionStart);
-    quizQuestionThinkingSound.emplace(resources.quizQuestionThinking);
-    quizEndSound.emplace(resources.quizEnd);
-    forgeSound.emplace(resources.forgeSound);
-    levelUpSound.emplace(resources.levelUp);
-    questStartSound.emplace(resources.questStart);
-    questEndSound.emplace(resources.questEnd);
+    menuOpenSound.emplace(resources.sound(SoundId::OpenMenu));
+    menuCloseSound.emplace(resources.sound(SoundId::CloseMenu));
+    quizLoggingSound.emplace(resources.sound(SoundId::QuizLoggingAnswer));
+    quizCorrectSound.emplace(resources.sound(SoundId::QuizAnswerCorrect));
+    quizIncorrectSound.emplace(resources.sound(SoundId::QuizAnswerIncorrect));
+    quizStartSound.emplace(resources.sound(SoundId::QuizStart));
+    quizQuestionStartSound.emplace(resources.sound(SoundId::QuizQuestionStart));
+    quizQuestionThinkingSound.emplace(resources.sound(SoundId::QuizQuestionThinking));
+    quizEndSound.emplace(resources.sound(SoundId::QuizEnd));
+    forgeSound.emplace(resources.sound(SoundId::ForgeSound));
+    levelUpSound.emplace(resources.sound(SoundId::LevelUp));
+    questStartSound.emplace(resources.sound(SoundId::QuestStart));
+    questEndSound.emplace(resources.sound(SoundId::QuestEnd));
     // === Framerate limitieren ===
     window.setFramerateLimit(fpsLimit);
     // === NameBox Style setzen ===
@@ -141,7 +147,7 @@ Game::Game()
     weaponPanel.setFillColor(sf::Color::Transparent);
     weaponPanel.setOutlineColor(ColorHelper::Palette::Normal);
     weaponPanel.setOutlineThickness(2.f);
-    menuButton.setTexture(&resources.menuButton, true);
+    menuButton.setTexture(&resources.texture(TextureId::MenuButton), true);
     menuButton.setFillColor(sf::Color::White);
     menuButton.setOutlineThickness(0.f);
 
@@ -152,9 +158,85 @@ Game::Game()
     currentDialogue = &intro;
     playerXpMax = static_cast<float>(xpForLevel(playerLevel));
 
+    ui::layout::loadUiFrame(*this);
     ui::weapons::loadWeaponOptions(*this);
     ui::dragons::loadDragonPortraits(*this);
     rankingManager.load("assets/data/rankings.json");
+    registerMemorySources();
+}
+
+void Game::registerMemorySources() {
+    auto& registry = core::memoryRegistry();
+    auto textureBytes = [](const sf::Texture& texture) {
+        return static_cast<std::size_t>(texture.getSize().x) * texture.getSize().y * 4;
+    };
+
+    registry.add("textures", "loadAll", [this, textureBytes]() {
+        core::MemoryUsage usage;
+        for (std::size_t i = 0; i < assets::kTextureCount; ++i) {
+            if (resources.sharedTextures[i] || resources.loadedTextures[i].getSize().x == 0)
+                continue;
+            usage.gpuBytes += textureBytes(resources.loadedTextures[i]);
+            ++usage.items;
+        }
+        return usage;
+    });
+    registry.add("textures", "texture cache", [this]() {
+        return core::MemoryUsage{ 0, resources.textures.residentBytes(), resources.textures.residentCount() };
+    });
+    registry.add("textures", "icon atlas", [this]() {
+        return core::MemoryUsage{ 0, resources.iconAtlas.residentBytes(), resources.iconAtlas.pageCount() };
+    });
+    registry.add("textures", "LOD levels", []() {
+        return core::MemoryUsage{ 0, assets::textureLods().residentBytes(), 0 };
+    });
+    registry.add("textures", "weapons and UI frame", []() {
+        return core::MemoryUsage{ 0, assets::contentStore().ownedTextureBytes(), assets::contentStore().ownedTextureCount() };
+    });
+    registry.add("sounds", "sound buffers", [this]() {
+        core::MemoryUsage usage;
+        for (std::size_t i = 0; i < assets::kSoundCount; ++i) {
+            // Released scene sounds keep a single silent sample.
+            const sf::SoundBuffer& buffer = resources.soundBuffers[i];
+            if (resources.sharedSounds[i] || buffer.getSampleCount() <= 1)
+                continue;
+            usage.cpuBytes += static_cast<std::size_t>(buffer.getSampleCount()) * sizeof(std::int16_t);
+            ++usage.items;
+        }
+        return usage;
+    });
+    registry.add("fonts", "glyph pages", []() {
+        core::MemoryUsage usage;
+        usage.gpuBytes = glyphPageBytes(usage.items);
+        return usage;
+    });
+    registry.add("game state", "battle log", [this]() {
+        const auto& log = battleDemo.logHistory;
+        core::MemoryUsage usage{ log.capacity() * sizeof(log.front()), 0, log.size() };
+        for (const auto& entry : log) {
+            usage.cpuBytes += core::heapBytes(entry.message);
+            usage.cpuBytes += entry.highlightTokens.capacity() * sizeof(entry.highlightTokens.front());
+            for (const auto& token : entry.highlightTokens)
+                usage.cpuBytes += core::heapBytes(token.first);
+        }
+        return usage;
+    });
+    registry.add("game state", "ranking entries", [this]() {
+        const auto& entries = rankingManager.entries();
+        core::MemoryUsage usage{ entries.capacity() * sizeof(core::RankingEntry), 0, entries.size() };
+        for (const auto& entry : entries)
+            usage.cpuBytes += core::heapBytes(entry.playerName) + core::heapBytes(entry.started);
+        return usage;
+    });
+    registry.add("game state", "quest log", [this]() {
+        core::MemoryUsage usage{ questLog.capacity() * sizeof(QuestLogEntry), 0, questLog.size() };
+        for (const auto& quest : questLog) {
+            usage.cpuBytes += core::heapBytes(quest.name) + core::heapBytes(quest.giver) + core::heapBytes(quest.goal);
+            if (quest.loot)
+                usage.cpuBytes += core::heapBytes(*quest.loot);
+        }
+        return usage;
+    });
 }
 
 // Tracks the active location and starts its music.
@@ -163,13 +245,29 @@ void Game::setCurrentLocation(const Location* location, bool updateBackground) {
     if (location)
         audioManager.startLocationMusic(location->id);
     if (location && updateBackground) {
-        if (const sf::Texture* backgroundTexture = backgroundForLocation(*this, location->id))
-            setBackgroundTexture(*backgroundTexture);
+        if (assets::TextureHandle backgroundTexture = backgroundFor(location->id))
+            setBackgroundTexture(backgroundTexture);
+    }
+}
+
+assets::TextureHandle Game::backgroundFor(LocationId id) const {
+    switch (id) {
+        case LocationId::Perigonal: return resources.handle(TextureId::BackgroundPetrigonal);
+        case LocationId::Gonad: return resources.handle(TextureId::BackgroundGonad);
+        case LocationId::FigsidsForge: return resources.handle(TextureId::BackgroundBlacksmith);
+        case LocationId::Blyathyroid: return resources.handle(TextureId::BackgroundBlyathyroid);
+        case LocationId::Lacrimere: return resources.handle(TextureId::BackgroundLacrimere);
+        case LocationId::Cladrenal: return resources.handle(TextureId::BackgroundCladrenal);
+        case LocationId::Aerobronchi: return resources.handle(TextureId::BackgroundAerobronchi);
+        case LocationId::Seminiferous: return resources.handle(TextureId::BackgroundSeminiferous);
+        case LocationId::UmbraOssea: return resources.handle(TextureId::BackgroundUmbraOssea);
+        default: return {};
     }
 }
 
 void Game::setBackgroundTexture(const sf::Texture& texture) {
-    queuedBackgroundTexture = nullptr;
+    queuedBackgroundTexture = {};
+    backgroundHandle = resources.textures.handleOf(texture);
     if (background && &background->getTexture() == &texture)
         return;
     background.emplace(texture);
@@ -178,6 +276,10 @@ void Game::setBackgroundTexture(const sf::Texture& texture) {
     backgroundVisible = false;
 }
 
+void Game::setBackgroundTexture(assets::TextureHandle handle) {
+    setBackgroundTexture(resources.texture(handle));
+}
+
 // Begins the looping title-screen music.
 void Game::startTitleScreenMusic() {
     audioManager.startTitleScreenMusic();
@@ -208,6 +310,7 @@ void Game::beginTeleport(LocationId id) {
     mapInteractionUnlocked = false;
     transientReturnToMap = false;
     teleportController.begin(id, audioManager);
+    locationPrefetch.begin(*this, id);
 }
 
 void Game::beginForcedDestinationSelection() {
@@ -246,15 +349,17 @@ void Game::setMenuActive(bool active) {
     auto& sound = active ? menuOpenSound : menuCloseSound;
     if (sound) {
         sound->stop();
+        assets::notePlay(*sound);
         sound->play();
     }
 }
 
 // Advances the teleport sequence and invokes callbacks when ready.
 void Game::updateTeleport() {
-    teleportController.update([this](LocationId id) {
-        startTravel(id);
-    });
+    teleportController.update(
+        [this](LocationId id) { startTravel(id); },
+        [this](LocationId) { locationPrefetch.finish(*this); }
+    );
 }
 
 // Picks the base UI frame color based on the current location.
@@ -272,9 +377,20 @@ sf::Color Game::frameColor(float uiAlphaFactor) const {
     return ColorHelper::applyAlphaFactor(frameBaseColor(), uiAlphaFactor);
 }
 
-// Recomputes the layout whenever the window geometry changes (Not happening right now, window is limited to fixed size).
+// Recomputes the layout sections flagged in layoutDirty (window size, item list, weapon/dragon panels).
 void Game::updateLayout() {
-    ui::layout::updateLayout(*this);
+    bool ran = ui::layout::updateLayout(*this);
+#ifndef NDEBUG
+    if (ran)
+        ++layoutPassCounter.passesThisSecond;
+    if (layoutPassCounter.clock.getElapsedTime().asSeconds() >= 1.f) {
+        layoutPassCounter.passesPerSecond = layoutPassCounter.passesThisSecond;
+        layoutPassCounter.passesThisSecond = 0;
+        layoutPassCounter.clock.restart();
+    }
+#else
+    (void)ran;
+#endif
 }
 
 void Game::beginSessionTimer() {
@@ -315,174 +431,227 @@ int Game::recordSessionRanking() {
 }
 
 
-// Drives the main event/render loop until the window closes.
-void Game::run() {
-    sf::Clock frameClock;
-    while (window.isOpen()) {
-        sf::Time frameTime = frameClock.restart();
-        while (auto event = window.pollEvent()) {
-            bool eventConsumed = false;
+// Drains the window's event queue and routes each event to the active screen.
+void Game::processEvents() {
+    while (auto event = window.pollEvent()) {
+        bool eventConsumed = false;
 
-            if (event->is<sf::Event::Closed>()) {
-                window.close();
-                continue;
-            }
+        if (event->is<sf::Event::Closed>()) {
+            window.close();
+            continue;
+        }
 
-            if (ui::ranking::isOverlayActive(rankingOverlay)) {
-                ui::ranking::handleOverlayEvent(rankingOverlay, *event);
-                continue;
-            }
+        if (event->is<sf::Event::Resized>())
+            layoutDirty.window = true;
 
-            if (teleportController.active()
-                || endSequenceController.isActive()
-                || endSequenceController.isScreenVisible())
-                continue;
+        if (ui::memory::handleEvent(memoryOverlay, *event))
+            continue;
 
-            if (state == GameState::BattleDemo) {
-                ui::battle::handleEvent(*this, *event);
-                continue;
-            }
+        if (ui::ranking::isOverlayActive(rankingOverlay)) {
+            ui::ranking::handleOverlayEvent(rankingOverlay, *event);
+            continue;
+        }
 
-            bool confirmationHandled = confirmationPrompt.active && handleConfirmationEvent(*this, *event);
-            if (confirmationHandled)
-                continue;
+        if (teleportController.active()
+            || endSequenceController.isActive()
+            || endSequenceController.isScreenVisible())
+            continue;
 
-            if (confirmationPrompt.active && event->is<sf::Event::TextEntered>())
-                continue;
+        if (state == GameState::BattleDemo) {
+            ui::battle::handleEvent(*this, *event);
+            continue;
+        }
 
-            if (askingName && event->is<sf::Event::TextEntered>()) {
-                const auto& text = event->getIf<sf::Event::TextEntered>();
-                char32_t code = text->unicode;
+        bool confirmationHandled = confirmationPrompt.active && handleConfirmationEvent(*this, *event);
+        if (confirmationHandled)
+            continue;
 
-                if (code == U'\r' || code == U'\n') {}
-                else if (code == U'\b') {
-                    if (!nameInput.empty())
-                        nameInput.pop_back();
-                }
-                else if (code >= 32 && code < 127) {
-                    if (nameInput.size() < playerNameMaxLength)
-                        nameInput.push_back(static_cast<char>(code));
-                }
-            }
-            if (!confirmationPrompt.active && ui::menu::handleEvent(*this, *event))
-                continue;
-            if (genderSelectionActive) {
-                if (ui::genderSelection::handleEvent(*this, *event))
-                    continue;
+        if (confirmationPrompt.active && event->is<sf::Event::TextEntered>())
+            continue;
+
+        if (askingName && event->is<sf::Event::TextEntered>()) {
+            const auto& text = event->getIf<sf::Event::TextEntered>();
+            char32_t code = text->unicode;
+
+            if (code == U'\r' || code == U'\n') {}
+            else if (code == U'\b') {
+                if (!nameInput.empty())
+                    nameInput.pop_back();
             }
-            if (state == GameState::IntroTitle && !confirmationPrompt.active) {
-                if (handleIntroTitleEvent(*this, *event))
-                    continue;
+            else if (code >= 32 && code < 127) {
+                if (nameInput.size() < playerNameMaxLength)
+                    nameInput.push_back(static_cast<char>(code));
             }
+        }
+        if (!confirmationPrompt.active && ui::menu::handleEvent(*this, *event))
+            continue;
+        if (genderSelectionActive) {
+            if (ui::genderSelection::handleEvent(*this, *event))
+                continue;
+        }
+        if (state == GameState::IntroTitle && !confirmationPrompt.active) {
+            if (handleIntroTitleEvent(*this, *event))
+                continue;
+        }
 
-            if (auto key = event->getIf<sf::Event::KeyReleased>()) {
-                if (key->scancode == sf::Keyboard::Scan::Tab) {
-                    playerStatusFolded = !playerStatusFolded;
-                    eventConsumed = true;
+        if (auto key = event->getIf<sf::Event::KeyReleased>()) {
+            if (key->scancode == sf::Keyboard::Scan::Tab) {
+                playerStatusFolded = !playerStatusFolded;
+                eventConsumed = true;
+                continue;
+            }
+            if (key->scancode == sf::Keyboard::Scan::Enter) {
+                // Block Enter key while a confirmation prompt is active to avoid
+                // accidental confirmation via keyboard (prevent misclicks).
+                if (confirmationPrompt.active)
                     continue;
-                }
-                if (key->scancode == sf::Keyboard::Scan::Enter) {
-                    // Block Enter key while a confirmation prompt is active to avoid
-                    // accidental confirmation via keyboard (prevent misclicks).
-                    if (confirmationPrompt.active)
-                        continue;
 
-                    // Enter sound is played only when a new dialogue line actually starts.
-                    // The logic for playing the sound is handled inside `waitForEnter`.
+                // Enter sound is played only when a new dialogue line actually starts.
+                // The logic for playing the sound is handled inside `waitForEnter`.
 
-                    if (state == GameState::IntroScreen) {
-                        if (!introFadeOutActive) {
-                            introFadeOutActive = true;
-                            introClock.restart();
-                        }
-                        eventConsumed = true;
+                if (state == GameState::IntroScreen) {
+                    if (!introFadeOutActive) {
+                        introFadeOutActive = true;
+                        introClock.restart();
                     }
-                    else if (state == GameState::Dialogue || state == GameState::MapSelection) {
-                        if (currentDialogue && dialogueIndex < currentDialogue->size()) {
-                            eventConsumed = waitForEnter(*this, (*currentDialogue)[dialogueIndex]);
-                        }
+                    eventConsumed = true;
+                }
+                else if (state == GameState::Dialogue || state == GameState::MapSelection) {
+                    if (currentDialogue && dialogueIndex < currentDialogue->size()) {
+                        eventConsumed = waitForEnter(*this, (*currentDialogue)[dialogueIndex]);
                     }
                 }
             }
+        }
 
-            if (!eventConsumed) {
-                if (auto button = event->getIf<sf::Event::MouseButtonReleased>()) {
-                    if (button->button == sf::Mouse::Button::Left) {
-                        auto mousePos = window.mapPixelToCoords(button->position);
-                        if (playerStatusFoldBarBounds.contains(mousePos)) {
-                            playerStatusFolded = !playerStatusFolded;
-                            eventConsumed = true;
-                            continue;
-                        }
+        if (!eventConsumed) {
+            if (auto button = event->getIf<sf::Event::MouseButtonReleased>()) {
+                if (button->button == sf::Mouse::Button::Left) {
+                    auto mousePos = window.mapPixelToCoords(button->position);
+                    if (playerStatusFoldBarBounds.contains(mousePos)) {
+                        playerStatusFolded = !playerStatusFolded;
+                        eventConsumed = true;
+                        continue;
                     }
                 }
             }
+        }
 
-            if (eventConsumed)
+        if (eventConsumed)
+            continue;
+
+        if (state == GameState::WeaponSelection && !confirmationPrompt.active)
+            handleWeaponSelectionEvent(*this, *event);
+        else if (state == GameState::MapSelection && !confirmationPrompt.active)
+            handleMapSelectionEvent(*this, *event);
+        else if (state == GameState::Quiz && !confirmationPrompt.active)
+            handleQuizEvent(*this, *event);
+        else if (state == GameState::TreasureChest && !confirmationPrompt.active) {
+            if (ui::treasureChest::handleEvent(*this, *event))
                 continue;
-
-            if (state == GameState::WeaponSelection && !confirmationPrompt.active)
-                handleWeaponSelectionEvent(*this, *event);
-            else if (state == GameState::MapSelection && !confirmationPrompt.active)
-                handleMapSelectionEvent(*this, *event);
-            else if (state == GameState::Quiz && !confirmationPrompt.active)
-                handleQuizEvent(*this, *event);
-            else if (state == GameState::TreasureChest && !confirmationPrompt.active) {
-                if (ui::treasureChest::handleEvent(*this, *event))
-                    continue;
-            }
-            else if (state == GameState::FinalChoice && !confirmationPrompt.active)
-                handleFinalChoiceEvent(*this, *event);
-            else if (state == GameState::Credits)
-                ui::credits::handleEvent(*this, *event);
         }
+        else if (state == GameState::FinalChoice && !confirmationPrompt.active)
+            handleFinalChoiceEvent(*this, *event);
+        else if (state == GameState::Credits)
+            ui::credits::handleEvent(*this, *event);
+    }
+}
 
-        // sf::Sprite returnSprite(returnSymbol);
-
-        updateTeleport();
-        endSequenceController.update();
-        if (creditsAfterEndPending && endSequenceController.isScreenVisible()) {
-            constexpr float kCreditsStartDelay = 2.0f;
-            if (!creditsAfterEndTimerActive) {
-                creditsAfterEndTimerActive = true;
-                creditsAfterEndClock.restart();
-            }
-            if (creditsAfterEndClock.getElapsedTime().asSeconds() >= kCreditsStartDelay) {
-                creditsAfterEndPending = false;
-                creditsAfterEndTimerActive = false;
-                endSequenceController.reset();
-                state = GameState::Credits;
-                creditsState.initialized = false;
-                creditsState.active = true;
-            }
+// Advances every time-driven system by exactly one fixed simulation step.
+void Game::simulate(sf::Time step) {
+    updateTeleport();
+    endSequenceController.update();
+    if (creditsAfterEndPending && endSequenceController.isScreenVisible()) {
+        constexpr float kCreditsStartDelay = 2.0f;
+        if (!creditsAfterEndTimerActive) {
+            creditsAfterEndTimerActive = true;
+            creditsAfterEndClock.restart();
         }
-        if (endSequenceController.isScreenVisible() && rankingOverlay.pending)
-            ui::ranking::activateOverlay(rankingOverlay);
-        ui::ranking::updateOverlay(rankingOverlay);
-        audioManager.update();
-        updateQuizIntro(*this);
-        updateWeaponForging(*this);
-        helper::healingPotion::update(*this);
-        ui::treasureChest::update(*this, frameTime.asSeconds());
-        ui::battle::update(*this, frameTime);
-        if (state == GameState::Credits) {
-            ui::credits::update(*this);
+        if (creditsAfterEndClock.getElapsedTime().asSeconds() >= kCreditsStartDelay) {
+            creditsAfterEndPending = false;
+            creditsAfterEndTimerActive = false;
+            endSequenceController.reset();
+            state = GameState::Credits;
+            creditsState.initialized = false;
+            creditsState.active = true;
         }
-        if (menuMapUmbraOverlayFadeInActive) {
-            float elapsed = menuMapUmbraOverlayClock.getElapsedTime().asSeconds();
-            if (elapsed >= 2.f) {
-                menuMapUmbraOverlayFadeInActive = false;
-                if (menuMapUmbraOverlayHold) {
-                    menuMapUmbraOverlayHold = false;
-                    holdMapDialogue = false;
-                }
+    }
+    if (endSequenceController.isScreenVisible() && rankingOverlay.pending)
+        ui::ranking::activateOverlay(rankingOverlay);
+    ui::ranking::updateOverlay(rankingOverlay);
+    audioManager.update();
+    updateQuizIntro(*this);
+    updateWeaponForging(*this);
+    advanceTypewriter(*this);
+    helper::healingPotion::update(*this);
+    ui::treasureChest::update(*this, step.asSeconds());
+    ui::battle::update(*this, step);
+    if (state == GameState::Credits) {
+        ui::credits::update(*this);
+    }
+    if (menuMapUmbraOverlayFadeInActive) {
+        float elapsed = menuMapUmbraOverlayClock.getElapsedTime().asSeconds();
+        if (elapsed >= 2.f) {
+            menuMapUmbraOverlayFadeInActive = false;
+            if (menuMapUmbraOverlayHold) {
+                menuMapUmbraOverlayHold = false;
+                holdMapDialogue = false;
             }
         }
+    }
+}
+
+// Drives the main loop: events, fixed-timestep simulation with catch-up cap, then an interpolated render.
+void Game::run() {
+    sf::Clock frameClock;
+    sf::Time accumulator = sf::Time::Zero;
+    while (window.isOpen()) {
+        // Clamp long stalls (window drag, breakpoint) so the simulation does not spiral.
+        accumulator += std::min(frameClock.restart(), kMaxFrameTime);
+        resources.textures.beginFrame();
+        resources.textures.collectPrefetched();
+        resources.collectGroups();
+        locationPrefetch.retain(*this);
+        if (assets::usageTracer().enabled())
+            assets::usageTracer().setScene(gameStateName(state));
+        // The background sprite is drawn straight from its texture, so mark it used explicitly.
+        if (backgroundHandle)
+            resources.texture(backgroundHandle);
+
+        processEvents();
+
+        int steps = 0;
+        while (accumulator >= kSimulationStep && steps < kMaxCatchUpSteps) {
+            core::advanceSimulation(kSimulationStep);
+            simulate(kSimulationStep);
+            accumulator -= kSimulationStep;
+            ++steps;
+        }
+        // Still behind after the catch-up budget: drop the backlog instead of slowing down further.
+        if (accumulator >= kSimulationStep)
+            accumulator = sf::Time::Zero;
+
         updateLayout();
 
+        // Render between the last two steps so animations stay smooth at any frame rate.
+        core::setRenderInterpolation(accumulator);
         window.clear(ColorHelper::Palette::BlueNearBlack);
+        typewriterShown = false;
         renderGame(*this);
+#ifndef NDEBUG
+        ui::layout::drawLayoutPassCounter(*this, window);
+#endif
+        ui::memory::update(memoryOverlay, launchOptions.memReport);
+        ui::memory::drawOverlay(memoryOverlay, window, resources.uiFont);
         window.display();
+        core::setRenderInterpolation(sf::Time::Zero);
+        // The map has many exits (travel, teleport, closing the menu); it is left once it has not been
+        // drawn for a while, so flipping menu tabs away from the map and back does not reload the group.
+        if (std::exchange(mapDrawnThisFrame, false))
+            mapIdleClock.restart();
+        else if (mapAssets.isHeld() && mapIdleClock.getElapsedTime() >= kMapReleaseDelay)
+            mapAssets.release();
+        resources.textures.trim();
     }
 }
 
@@ -612,6 +781,7 @@ void Game::startQuest(const Story::QuestDefinition& quest) {
     questPopup.message = "New Quest: " + entry.name;
     if (questStartSound) {
         questStartSound->stop();
+        assets::notePlay(*questStartSound);
         questStartSound->play();
     }
 }
@@ -635,6 +805,7 @@ void Game::completeQuest(const Story::QuestDefinition& quest) {
     questPopup.message = "Finished Quest: " + existing->name;
     if (questEndSound) {
         questEndSound->stop();
+        assets::notePlay(*questEndSound);
         questEndSound->play();
     }
 }
@@ -16,11 +16,14 @@
 // === SFML Libraries ===
 #include <SFML/Audio.hpp>           // Declares sf::Sound and other audio assets stored in the class.
 #include <SFML/Graphics.hpp>        // Defines sprites, shapes, the window, and color helpers used throughout.
-#include <SFML/System/Clock.hpp>    // Provides sf::Clock for all the timing members.
+#include <SFML/System/Clock.hpp>    // Provides sf::Clock for the wall-clock ranking and layout-pass timers.
 // === Header Files ===
 #include "audio/audioManager.hpp"               // Controls music/sfx players owned by the Game.
 #include "core/endSequenceController.hpp"       // Handles the final-sequence controller member.
 #include "core/itemController.hpp"              // Manages the in-game items referenced by Game.
+#include "core/launchOptions.hpp"               // Command-line switches passed in from main.
+#include "core/locationPrefetch.hpp"            // Stages the teleport destination's assets.
+#include "core/simulationClock.hpp"             // SimClock timers advanced by the fixed-timestep loop.
 #include "core/state.hpp"                       // Defines GameState values used throughout.
 #include "core/teleportController.hpp"          // Provides the teleport controller member and friend hook.
 #include "resources/resources.hpp"              // Supplies the Resources member with textures and sounds.
@@ -33,6 +36,7 @@
 #include "ui/nineSliceBox.hpp"                  // Declares the NineSliceBox frame used for the UI.
 #include "ui/quizGenerator.hpp"                 // Defines quiz::Question for the quiz data structure.
 #include "ui/mapSelectionUI.hpp"                // Needed for caching map popup metadata.
+#include "ui/memoryOverlay.hpp"                 // F3 memory overlay state.
 #include "items/itemRegistry.hpp"
 #include "core/ranking.hpp"                     // Tracks leaderboard entries persisted on disk.
 #include "ui/rankingUI.hpp"                     // Renders the ranking overlay once the ending completes.
@@ -126,7 +130,7 @@ struct BattleDemoState {
     std::array<sf::FloatRect, kSkillSlotCount> fightOptionBounds;
     bool fightOptionBoundsValid = false;
     sf::FloatRect fightCancelBounds;
-            sf::Clock completionClock;
+            core::SimClock completionClock;
             struct LogEntry {
                 std::string message;
                 std::vector<std::pair<std::string, sf::Color>> highlightTokens;
@@ -142,7 +146,7 @@ struct BattleDemoState {
         bool active = false;
         float startHp = 0.f;
         float endHp = 0.f;
-        sf::Clock clock;
+        core::SimClock clock;
     };
     HpPulse playerHpPulse;
     HpPulse enemyHpPulse;
@@ -294,7 +298,7 @@ struct BattleDemoState {
             bool wandaRescueActive = false;
             bool wandaRescueAwaitingInput = false;
             bool pendingForcedSwapMenu = false;
-            sf::Clock wandaRescueClock;
+            core::SimClock wandaRescueClock;
         };
 
 struct Game {
@@ -307,7 +311,7 @@ struct Game {
 
     // Represents one selectable weapon entry in the selection panel.
     struct WeaponOption {
-        sf::Texture texture;
+        const sf::Texture* texture = nullptr;  // Owned by assets::contentStore(), shared with identical files.
         std::optional<sf::Sprite> sprite;
         std::string displayName;
         int hotkeyNumber = 0;
@@ -352,7 +356,7 @@ struct Game {
         std::optional<std::size_t> activeDragon;
         std::optional<std::size_t> pendingDragon;
         std::size_t lastProcessedDialogueIndex = std::numeric_limits<std::size_t>::max();
-        sf::Clock fadeClock;
+        core::SimClock fadeClock;
     };
 
     // Tracks the popup that previews the broken weapons during Perigonal dialogue.
@@ -366,7 +370,7 @@ struct Game {
         };
 
         Phase phase = Phase::Hidden;
-        sf::Clock fadeClock;
+        core::SimClock fadeClock;
         float popupAlpha = 0.f;
         float weaponAlpha = 0.f;
         float popupFadeStart = 0.f;
@@ -382,7 +386,7 @@ struct Game {
         };
 
         Phase phase = Phase::Idle;
-        sf::Clock clock;
+        core::SimClock clock;
         float alpha = 0.f;
         bool autoAdvancePending = false;
     };
@@ -424,12 +428,12 @@ struct Game {
         int selectionIndex = -1;
         bool selectionCorrect = false;
         bool pendingQuestionStartAnnouncement = false;
-        sf::Clock selectionClock;
-        sf::Clock blinkClock;
+        core::SimClock selectionClock;
+        core::SimClock blinkClock;
         // Holds timing/dialogue state for the quiz intro announcement sequence.
         struct IntroState {
             bool active = false;
-            sf::Clock clock;
+            core::SimClock clock;
             std::size_t questionIndex = 0;
             LocationId targetLocation = LocationId::Gonad;
             const std::vector<DialogueLine>* dialogue = nullptr;
@@ -445,9 +449,9 @@ struct Game {
             Thinking
         };
         QuestionAudioPhase questionAudioPhase = QuestionAudioPhase::Idle;
-        sf::Clock questionStartClock;
+        core::SimClock questionStartClock;
         bool finalCheerActive = false;
-        sf::Clock finalCheerClock;
+        core::SimClock finalCheerClock;
         bool finalCheerTriggered = false;
         std::optional<quiz::Question> pendingSillyReplacement;
         std::mt19937 rng;
@@ -474,7 +478,7 @@ struct Game {
         };
 
         Phase phase = Phase::Idle;
-        sf::Clock clock;
+        core::SimClock clock;
         std::optional<QuestLogEntry> entry;
         std::string message;
     };
@@ -504,11 +508,29 @@ struct Game {
         int hoveredIndex = -1;
     };
 
+    // Marks which parts of the UI layout must be recomputed before the next frame.
+    struct LayoutDirtyFlags {
+        bool window = true;    // Window size changed: every box is repositioned.
+        bool items = true;     // Inventory icons were added or removed.
+        bool panels = true;    // Weapon/dragon panel contents were rebuilt.
+
+        bool any() const { return window || items || panels; }
+    };
+
+#ifndef NDEBUG
+    // Debug-only counter showing how many layout passes ran during the last second.
+    struct LayoutPassCounter {
+        unsigned int passesThisSecond = 0;
+        unsigned int passesPerSecond = 0;
+        sf::Clock clock;  // Wall time: the rate is per real second, not per simulated one.
+    };
+#endif
+
     // Sets up all shared resources and UI state for the game.
-    Game();
+    explicit Game(const LaunchOptions& options = {});
     // Drives the main event/render loop while the window is open.
     void run();
-    // Recalculates UI layout whenever the window size changes.
+    // Recalculates the parts of the UI layout flagged in layoutDirty.
     void updateLayout();
     // Begins the session timer used to measure the player's completion time.
     void beginSessionTimer();
@@ -523,6 +545,8 @@ struct Game {
         void setCurrentLocation(const Location* location, bool updateBackground = true);
     // Switches the fullscreen background to the requested texture.
     void setBackgroundTexture(const sf::Texture& texture);
+    // Same for a cached texture; the handle is kept so the texture stays resident while shown.
+    void setBackgroundTexture(assets::TextureHandle handle);
     // Plays the title screen music.
     void startTitleScreenMusic();
     // Fades out the title screen music over the given time.
@@ -536,9 +560,18 @@ struct Game {
 
         // === Public game data ===
         sf::RenderWindow window;                            // Main SFML window for rendering.
+        LaunchOptions launchOptions;                        // Switches parsed from the command line.
         Resources resources;                                // Central texture/audio assets store.
         AudioManager audioManager;                          // Music and sound effect manager.
         core::TeleportController teleportController;        // Handles teleport animations.
+        core::LocationPrefetch locationPrefetch;            // Decodes the teleport destination during the fade.
+        // Scene groups, held only while their scene runs (declared after resources, released before it).
+        assets::GroupLease introAssets{ resources, AssetGroup::Intro };      // Title screen until the title fades out.
+        assets::GroupLease mapAssets{ resources, AssetGroup::Map };          // While the map is drawn, plus a grace period.
+        assets::GroupLease quizAssets{ resources, AssetGroup::Quiz };        // Quiz intro until the dragonstone reward.
+        assets::GroupLease battleAssets{ resources, AssetGroup::Battle };    // startBattle until the battle completes.
+        bool mapDrawnThisFrame = false;                     // Set by drawMapSelectionUI; restarts mapIdleClock.
+        sf::Clock mapIdleClock;                             // Wall time since the map was last drawn.
         core::EndSequenceController endSequenceController;  // Final-overlay sequence control.
         BattleDemoState battleDemo;
         GameState state = GameState::IntroScreen;             // Current UI/game mode.
@@ -561,7 +594,7 @@ struct Game {
         bool inventoryTutorialPending = false;            // Waiting for the menu to open after the arrow line.
         bool inventoryTutorialPopupActive = false;        // Shows the tutorial popup once the menu opens.
         bool inventoryTutorialCompleted = false;          // Prevents re-triggering the tutorial after it ran.
-        sf::Clock inventoryArrowBlinkClock;               // Drives the arrow blinking effect.
+        core::SimClock inventoryArrowBlinkClock;          // Drives the arrow blinking effect.
         bool inventoryArrowVisible = true;                // Tracks the arrow's visible/blink state.
         sf::FloatRect inventoryTutorialButtonBounds;      // Hitbox for the Understood button inside the popup.
         bool inventoryTutorialButtonHovered = false;      // Hover state used for the tutorial button highlight.
@@ -571,7 +604,7 @@ struct Game {
         bool questTutorialButtonHovered = false;          // Hover state for the quest tutorial button.
         bool questTutorialClosing = false;                // Signals that the quest tutorial is fading out.
         float questTutorialCloseProgress = 0.f;           // Tracks fade progress while closing.
-        sf::Clock questTutorialCloseClock;                // Drives the quest tutorial fade-out timer.
+        core::SimClock questTutorialCloseClock;           // Drives the quest tutorial fade-out timer.
         sf::FloatRect questTutorialButtonBounds;          // Hitbox for the quest tutorial button.
         bool questTutorialAdvancePending = false;          // Signals to advance dialogue after the tutorial closes.
         bool mapItemPopupActive = false;                  // Shows the map-acquisition popup during Gonad part two.
@@ -588,13 +621,13 @@ struct Game {
         bool menuMapUmbraOverlayActive = false;           // Shows the Umbra overlay on the menu map.
         bool menuMapUmbraOverlayFadeInActive = false;      // Animates the overlay fade-in.
         bool menuMapUmbraOverlayHold = false;              // Holds dialogue until the overlay finishes fading.
-        sf::Clock menuMapUmbraOverlayClock;                // Tracks the overlay fade timing.
+        core::SimClock menuMapUmbraOverlayClock;           // Tracks the overlay fade timing.
         std::optional<sf::FloatRect> menuMapUmbraOverlayContentBounds; // Cached normalized overlay bounds.
         sf::FloatRect menuMapUmbraOverlayBounds{};         // Clickable bounds for the Umbra overlay.
         bool healingPotionActive = false;                 // Tracks whether a healing sequence is running.
         bool healingPotionReceived = false;               // Ensures the potion is only granted once.
         float healingPotionStartHp = 0.f;                 // HP recorded when the potion started healing.
-        sf::Clock healingPotionClock;                     // Drives the healing interpolation timer.
+        core::SimClock healingPotionClock;                // Drives the healing interpolation timer.
         bool emergencyHealingActive = false;               // Indicates Wanda is patching up the player.
         int emergencyHealCount = 0;                       // Tracks how many emergency heals Wanda performed.
         float playerXp = 0.f;                            // Player XP value for the status bar.
@@ -609,7 +642,7 @@ struct Game {
         struct XpGainDisplay {
             bool active = false;
             int amount = 0;
-            sf::Clock clock;
+            core::SimClock clock;
             std::vector<XpGainSegment> segments;
             std::size_t currentSegment = 0;
             bool waitingForLevelUp = false;
@@ -617,7 +650,7 @@ struct Game {
         XpGainDisplay xpGainDisplay;                      // Controls the XP gain visual effect.
         struct LevelUpDisplay {
             bool active = false;
-            sf::Clock clock;
+            core::SimClock clock;
         };
         LevelUpDisplay levelUpDisplay;
         float xpBarDisplayRatio = 0.f;                     // Smoothly animates XP bar fill.
@@ -625,21 +658,21 @@ struct Game {
             bool active = false;
             float startHp = 0.f;
             float endHp = 0.f;
-            sf::Clock clock;
+            core::SimClock clock;
             bool pendingHealing = false;
         };
         HpDamagePulse hpDamagePulse;                       // Animates HP loss similar to healing.
         struct HpLossDisplay {
             bool active = false;
             int amount = 0;
-            sf::Clock clock;
+            core::SimClock clock;
             float duration = 1.f;
         };
         HpLossDisplay hpLossDisplay;                       // Draws the "-100" popup next to the HP bar.
         struct CriticalHpNotice {
             bool active = false;
             float duration = 3.f;
-            sf::Clock clock;
+            core::SimClock clock;
             std::string message;
         };
         CriticalHpNotice criticalHpNotice;                 // Shows Wanda's warning when HP hits the floor.
@@ -661,6 +694,11 @@ struct Game {
         sf::RectangleShape menuPanel;                    // Panel shown when the menu is active.
         std::array<sf::FloatRect, 3> menuTabBounds{};    // Click/touch areas for menu tabs.
         NineSliceBox uiFrame{12};                        // Decorative frame around UI elements.
+        LayoutDirtyFlags layoutDirty;                    // Layout sections waiting to be recomputed.
+        ui::memory::OverlayState memoryOverlay;          // Per-source memory use, toggled with F3.
+#ifndef NDEBUG
+        LayoutPassCounter layoutPassCounter;             // Layout passes per second shown in debug builds.
+#endif
         bool menuActive = false;                         // Determines whether the menu overlay is visible.
         bool menuButtonHovered = false;                   // Tracks hover state for the menu button.
         int menuHoveredTab = -1;                          // Hovered tab index.
@@ -668,7 +706,7 @@ struct Game {
         bool menuButtonUnlocked = false;                  // Menu becomes available once Tory points it out.
         bool menuButtonFadeActive = false;                // Tracks whether the button is currently fading in.
         float menuButtonAlpha = 0.f;                      // Fade progress used for button visibility.
-        sf::Clock menuButtonFadeClock;                    // Drives the 1-second menu button fade.
+        core::SimClock menuButtonFadeClock;               // Drives the 1-second menu button fade.
         bool forcedDestinationSelection = false;          // Locks the menu on the map until a destination is chosen.
 
         struct CharacterMenuState {
@@ -705,12 +743,14 @@ struct Game {
 
         std::optional<sf::Sprite> background;             // Background art for the current scene.
         std::optional<sf::Sprite> returnSprite;           // Icon drawn when returning to map.
-        const sf::Texture* queuedBackgroundTexture = nullptr; // Next background to fade in.
+        assets::TextureHandle backgroundHandle;           // Cached texture behind background, if any.
+        assets::TextureHandle queuedBackgroundTexture;    // Next background to fade in.
 
         std::string visibleText;                       // Currently rendered portion of the active line.
         std::size_t charIndex = 0;                     // Visible character count.
-        sf::Clock typewriterClock;                     // Drives the typewriter animation speed.
-        sf::Clock uiGlowClock;                         // Timer for glowing UI effects.
+        core::SimClock typewriterClock;                // Drives the typewriter animation speed.
+        bool typewriterShown = false;                  // Set by drawDialogueUI while a line is typing.
+        core::SimClock uiGlowClock;                    // Timer for glowing UI effects.
 
         std::optional<sf::Sound> enterSound;                // SFX when pressing Enter to advance.
         std::optional<sf::Sound> confirmSound;              // Confirmation prompt acceptance.
@@ -739,17 +779,17 @@ struct Game {
         std::string nameInput;                         // Ongoing characters while typing.
         bool askingName = false;                       // True while waiting for name input.
 
-        sf::Clock cursorBlinkClock;                    // Cursor blink timer.
+        core::SimClock cursorBlinkClock;               // Cursor blink timer.
         bool cursorVisible = true;                     // Should the name cursor be drawn?
         float cursorBlinkInterval = 0.5f;              // Blink speed in seconds.
 
-        sf::Clock returnBlinkClock;                    // Blinking timer for the return icon.
+        core::SimClock returnBlinkClock;               // Blinking timer for the return icon.
         bool returnVisible = true;                     // Return prompt currently shown?
         float returnBlinkInterval = 0.4f;              // Return icon blink interval.
 
         std::string currentProcessedLine;               // Full string after layout formatting.
 
-        sf::Clock introClock;                           // Drives intro fade timers.
+        core::SimClock introClock;                      // Drives intro fade timers.
         float introFadeDuration = 1.0f;                 // Duration for the intro fade.
         bool introFadeOutActive = false;                // Intro fade currently running.
         float introFadeOutDuration = 3.0f;              // Duration for the intro exit fade.
@@ -757,17 +797,17 @@ struct Game {
         bool introTitleFadeOutActive = false;           // Title drop animation active.
         float introTitleFadeOutDuration = 1.0f;         // Length of the title drop.
         bool introTitleHidden = false;                  // Hides the title while animating.
-        sf::Clock introTitleFadeClock;                  // Title drop timer.
+        core::SimClock introTitleFadeClock;             // Title drop timer.
 
         bool introTitleRevealStarted = false;
         bool introTitleRevealComplete = false;
         float introTitleRevealDuration = 1.4f;
-        sf::Clock introTitleRevealClock;
+        core::SimClock introTitleRevealClock;
         bool introTitleOptionsFadeTriggered = false;
         bool introTitleOptionsFadeActive = false;
         float introTitleOptionsFadeDuration = 0.9f;
         float introTitleOptionsFadeProgress = 0.f;
-        sf::Clock introTitleOptionsFadeClock;
+        core::SimClock introTitleOptionsFadeClock;
         std::array<sf::FloatRect, 3> introTitleOptionBounds{};
         int introTitleHoveredOption = -1;
 
@@ -786,7 +826,7 @@ struct Game {
 
             Phase phase = Phase::Idle;
             int selection = -1;
-            sf::Clock clock;
+            core::SimClock clock;
             float approachDuration = 0.95f;
             float fadeDuration = 0.5f;
             bool labelsHidden = false;
@@ -796,7 +836,7 @@ struct Game {
         bool introDialogueFinished = false;              // Intro dialogue completed flag.
         bool uiFadeOutActive = false;                    // UI fade-out currently running.
         float uiFadeOutDuration = 1.0f;                  // Duration of the UI fade-out.
-        sf::Clock uiFadeClock;                           // Controls UI fade timing.
+        core::SimClock uiFadeClock;                      // Controls UI fade timing.
 
         bool uiFadeInQueued = false;                     // Next fade-in was requested.
         bool uiFadeInActive = false;                     // UI is currently fading in.
@@ -809,7 +849,7 @@ struct Game {
 
         bool backgroundFadeInActive = false;              // Background fade animation running.
         bool backgroundVisible = false;                   // Should the background be drawn?
-        sf::Clock backgroundFadeClock;                    // Timer for background fading.
+        core::SimClock backgroundFadeClock;               // Timer for background fading.
 
         std::vector<Location> locations;                    // All locations available for travel.
         const Location* currentLocation = nullptr;          // Currently active location pointer.
@@ -862,11 +902,11 @@ struct Game {
         bool finalEndingPending = false;                // Ending sequence is next.
         bool creditsAfterEndPending = false;            // Credits should start after the end screen.
         bool creditsAfterEndTimerActive = false;        // Timer started once THE END is visible.
-        sf::Clock creditsAfterEndClock;                 // Delay before starting credits.
+        core::SimClock creditsAfterEndClock;            // Delay before starting credits.
         bool startGameSoundPlayed = false;              // Ensures start sound plays once.
         struct RankingSession {
             bool started = false;
-            sf::Clock timer;
+            sf::Clock timer;                            // Wall-clock run time for the leaderboard.
             std::chrono::system_clock::time_point startTime;
         };
         RankingSession rankingSession;
@@ -885,12 +925,20 @@ struct Game {
     void beginTeleport(LocationId id);
     // Steps the teleport phase machine forward each frame.
     void updateTeleport();
+    // Background texture shown at the given location (empty handle if it has none).
+    assets::TextureHandle backgroundFor(LocationId id) const;
     // Chooses the UI frame base color for the current location.
     sf::Color frameBaseColor() const;
     // Applies the requested alpha factor to the frame color.
     sf::Color frameColor(float uiAlphaFactor) const;
 
     private:
+        // Handles all pending window events for this frame.
+        void processEvents();
+        // Advances timers, controllers, and overlays by one fixed simulation step.
+        void simulate(sf::Time step);
+        // Reports the loaded assets and the containers that grow during a session to core::memoryRegistry().
+        void registerMemorySources();
         // Fills the list of selectable weapon options.
         void loadWeaponOptions();
         // Prepares the dragon portraits displayed in the showcase.
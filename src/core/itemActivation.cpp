@@ -75,92 +75,8 @@ std::optional<std::size_t> ceremonialIndex(
 }
 
 const sf::Texture* textureForItemKeyImpl(const Game& game, std::string_view key) noexcept {
-    if (key == "holmabir")
-        return &game.resources.weaponHolmabir;
-    if (key == "kattkavar")
-        return &game.resources.weaponKattkavar;
-    if (key == "stiggedin")
-        return &game.resources.weaponStiggedin;
-    if (key == "weapon_holmabir_broken")
-        return &game.resources.weaponHolmabirBroken;
-    if (key == "weapon_kattkavar_broken")
-        return &game.resources.weaponKattkavarBroken;
-    if (key == "weapon_stiggedin_broken")
-        return &game.resources.weaponStiggedinBroken;
-    if (key == "dragonstone_air")
-        return &game.resources.dragonstoneAir;
-    if (key == "dragonstone_earth")
-        return &game.resources.dragonstoneEarth;
-    if (key == "dragonstone_fire")
-        return &game.resources.dragonstoneFire;
-    if (key == "dragonstone_water")
-        return &game.resources.dragonstoneWater;
-    if (key == "dragonscale_air")
-        return &game.resources.artifactDragonscaleAir;
-    if (key == "dragonscale_earth")
-        return &game.resources.artifactDragonscaleEarth;
-    if (key == "dragonscale_fire")
-        return &game.resources.artifactDragonscaleFire;
-    if (key == "dragonscale_water")
-        return &game.resources.artifactDragonscaleWater;
-    if (key == "dragonclaw_air")
-        return &game.resources.artifactDragonclawAir;
-    if (key == "dragonclaw_earth")
-        return &game.resources.artifactDragonclawEarth;
-    if (key == "dragonclaw_fire")
-        return &game.resources.artifactDragonclawFire;
-    if (key == "dragonclaw_water")
-        return &game.resources.artifactDragonclawWater;
-    if (key == "luckycharm_air")
-        return &game.resources.artifactLuckyCharmAir;
-    if (key == "luckycharm_earth")
-        return &game.resources.artifactLuckyCharmEarth;
-    if (key == "luckycharm_fire")
-        return &game.resources.artifactLuckyCharmFire;
-    if (key == "luckycharm_water")
-        return &game.resources.artifactLuckyCharmWater;
-    if (key == "ring_fire")
-        return &game.resources.equipmentRingFire;
-    if (key == "ring_air")
-        return &game.resources.equipmentRingAir;
-    if (key == "ring_water")
-        return &game.resources.equipmentRingWater;
-    if (key == "ring_earth")
-        return &game.resources.equipmentRingEarth;
-    if (key == "dragoncup_air")
-        return &game.resources.trophyDragoncupAir;
-    if (key == "dragoncup_earth")
-        return &game.resources.trophyDragoncupEarth;
-    if (key == "dragoncup_fire")
-        return &game.resources.trophyDragoncupFire;
-    if (key == "dragoncup_water")
-        return &game.resources.trophyDragoncupWater;
-    if (key == "dragoncup_umbra")
-        return &game.resources.trophyDragoncupUmbra;
-    if (key == "emblem_soul")
-        return &game.resources.emblemSoul;
-    if (key == "emblem_body")
-        return &game.resources.emblemBody;
-    if (key == "emblem_resolve")
-        return &game.resources.emblemResolve;
-    if (key == "emblem_mind")
-        return &game.resources.emblemMind;
-    if (key == "emblem_ascension")
-        return &game.resources.emblemAscension;
-    if (key == "map_glandular")
-        return &game.resources.mapGlandular;
-    if (key == "umbra_ussea_one")
-        return &game.resources.umbraUsseaOne;
-    if (key == "umbra_ussea_two")
-        return &game.resources.umbraUsseaTwo;
-    if (key == "umbra_ussea_three")
-        return &game.resources.umbraUsseaThree;
-    if (key == "umbra_ussea_four")
-        return &game.resources.umbraUsseaFour;
-    if (key == "umbra_ussea_complete")
-        return &game.resources.umbraUsseaComplete;
-    if (key == "heal_potion")
-        return &game.resources.healPotion;
+    if (auto id = assets::textureForItemKey(key))
+        return &game.resources.texture(*id);
     return nullptr;
 }
 
@@ -186,16 +102,16 @@ bool equipWeaponImpl(Game& game, const std::string& key) {
     const sf::Texture* left = nullptr;
     const sf::Texture* right = nullptr;
     if (key == "stiggedin") {
-        left = &game.resources.weaponStiggedinLeft;
-        right = &game.resources.weaponStiggedin;
+        left = &game.resources.texture(TextureId::WeaponStiggedinLeft);
+        right = &game.resources.texture(TextureId::WeaponStiggedin);
     }
     else if (key == "kattkavar") {
-        left = &game.resources.weaponKattkavarLeft;
-        right = &game.resources.weaponKattkavar;
+        left = &game.resources.texture(TextureId::WeaponKattkavarLeft);
+        right = &game.resources.texture(TextureId::WeaponKattkavar);
     }
     else if (key == "holmabir") {
-        left = &game.resources.weaponHolmabir;
-        right = &game.resources.weaponHolmabir;
+        left = &game.resources.texture(TextureId::WeaponHolmabir);
+        right = &game.resources.texture(TextureId::WeaponHolmabir);
     }
     if (!left && !right)
         return false;
@@ -2,6 +2,7 @@
 #include <algorithm>
 // === Header Files ===
 #include "core/itemController.hpp"
+#include "resources/assetUsage.hpp"
 
 namespace {
 // Converts certain map locations into dragonstone indices for icon lookup.
@@ -20,16 +21,17 @@ namespace core {
 
 // Initializes textures and sounds using the shared resources bundle.
 void ItemController::init(Resources& resources) {
-    acquireSound_.emplace(resources.acquire);
-    dragonstoneTextures_[0] = &resources.dragonstoneFire;
-    dragonstoneTextures_[1] = &resources.dragonstoneAir;
-    dragonstoneTextures_[2] = &resources.dragonstoneWater;
-    dragonstoneTextures_[3] = &resources.dragonstoneEarth;
+    acquireSound_.emplace(resources.sound(SoundId::Acquire));
+    dragonstoneTextures_[0] = &resources.texture(TextureId::DragonstoneFire);
+    dragonstoneTextures_[1] = &resources.texture(TextureId::DragonstoneAir);
+    dragonstoneTextures_[2] = &resources.texture(TextureId::DragonstoneWater);
+    dragonstoneTextures_[3] = &resources.texture(TextureId::DragonstoneEarth);
 }
 
 // Adds a new icon sprite and plays the pickup sound.
 void ItemController::addItem(const sf::Texture& texture, std::string key) {
     icons_.emplace_back(texture, std::move(key));
+    iconsChanged_ = true;
     playAcquireSound();
 }
 
@@ -67,15 +69,23 @@ bool ItemController::removeItem(const std::string& key) {
     if (it == icons_.end())
         return false;
     icons_.erase(it);
+    iconsChanged_ = true;
     return true;
 }
 
+bool ItemController::consumeIconsChanged() noexcept {
+    bool changed = iconsChanged_;
+    iconsChanged_ = false;
+    return changed;
+}
+
 // Plays (and restarts) the acquire sound effect when items are collected.
 void ItemController::playAcquireSound() {
     if (!acquireSound_)
         return;
 
     acquireSound_->stop();
+    assets::notePlay(*acquireSound_);
     acquireSound_->play();
 }
 
@@ -41,11 +41,15 @@ public:
     // Plays the sound that accompanies any new icon.
     void playAcquireSound();
 
+    // Returns true once after icons were added or removed so the layout can reposition them.
+    bool consumeIconsChanged() noexcept;
+
     std::vector<ItemIcon>& icons() noexcept { return icons_; }
     const std::vector<ItemIcon>& icons() const noexcept { return icons_; }
 
 private:
     std::vector<ItemIcon> icons_;                         // Icons shown in the UI.
+    bool iconsChanged_ = false;                           // Set whenever icons_ gains or loses an entry.
     std::array<bool, 4> dragonstoneIconAdded_{};          // Tracks which dragonstones were already added.
     std::optional<sf::Sound> acquireSound_;               // Sound played when collecting an icon.
     std::array<const sf::Texture*, 4> dragonstoneTextures_{}; // Cached dragonstone textures from resources.
@@ -0,0 +1,45 @@
+// === C++ Libraries ===
+#include <iostream>  // Warns about malformed switch values.
+#include <string>    // Compares argv entries against the known switch names.
+// === Header Files ===
+#include "core/launchOptions.hpp"  // Declares LaunchOptions and parseLaunchOptions.
+
+namespace {
+// Reads the value following a switch as an unsigned number; returns false when missing or malformed.
+bool readUnsigned(int argc, char** argv, int& index, unsigned int& out) {
+    if (index + 1 >= argc) {
+        std::cout << "Missing value for " << argv[index] << "\n";
+        return false;
+    }
+    try {
+        unsigned long value = std::stoul(argv[index + 1]);
+        out = static_cast<unsigned int>(value);
+        ++index;
+        return true;
+    } catch (...) {
+        std::cout << "Invalid value for " << argv[index] << ": " << argv[index + 1] << "\n";
+        ++index;
+        return false;
+    }
+}
+} // namespace
+
+LaunchOptions parseLaunchOptions(int argc, char** argv) {
+    LaunchOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--load-threads")
+            readUnsigned(argc, argv, i, options.loadThreads);
+        else if (arg == "--texture-budget-mb")
+            readUnsigned(argc, argv, i, options.textureBudgetMb);
+        else if (arg == "--asset-report")
+            options.assetReport = true;
+        else if (arg == "--sync-uploads")
+            options.backgroundUploads = false;
+        else if (arg == "--mem-report")
+            options.memReport = true;
+        else if (arg == "--trace-asset-usage")
+            options.traceAssetUsage = true;
+    }
+    return options;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+// Command-line switches that tune how the game starts (measurement/debug knobs).
+struct LaunchOptions {
+    unsigned int loadThreads = 0; // --load-threads N: asset decode workers (0 = pick from hardware).
+    unsigned int textureBudgetMb = 512; // --texture-budget-mb N: VRAM for cached textures (0 = unlimited).
+    bool assetReport = false; // --asset-report: time every asset load and write asset_report.csv/.json on exit.
+    bool backgroundUploads = true; // --sync-uploads: upload prefetched textures on the render thread instead.
+    bool memReport = false; // --mem-report: sample memory use every second and write mem_report.json on exit.
+    bool traceAssetUsage = false; // --trace-asset-usage: record which assets are used where and write asset_usage.csv on exit.
+};
+
+// Parses the known switches from argv; unknown arguments are ignored.
+LaunchOptions parseLaunchOptions(int argc, char** argv);
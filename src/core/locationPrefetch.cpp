@@ -0,0 +1,72 @@
+// === C++ Libraries ===
+#include <algorithm>  // Skips portraits that are already staged.
+#include <iostream>   // Reports the assets that were not staged in time.
+#include <string>     // Collects the labels of the misses.
+// === Header Files ===
+#include "core/locationPrefetch.hpp"    // Declares LocationPrefetch implemented below.
+#include "core/game.hpp"                // Reads the destination's background, cache and audio.
+#include "core/teleportController.hpp"  // Picks the dialogue handleTravel will start.
+#include "ui/dialogDrawElements.hpp"    // Maps speakers and locations to portrait textures.
+
+namespace core {
+
+void LocationPrefetch::begin(Game& game, LocationId id) {
+    target_ = id;
+    textures_.clear();
+    auto stage = [&](assets::TextureHandle handle) {
+        if (!handle || std::find(textures_.begin(), textures_.end(), handle) != textures_.end())
+            return;
+        textures_.push_back(handle);
+        game.resources.textures.prefetch(handle);
+    };
+
+    stage(game.backgroundFor(id));
+    if (const auto* dialogue = arrivalDialogueFor(game, id)) {
+        for (const auto& line : *dialogue) {
+            stage(dialogDraw::portraitFor(game, line.speaker));
+            stage(line.speaker == TextStyles::SpeakerId::StoryTeller
+                ? game.resources.handle(TextureId::PortraitBackgroundToryTailor)
+                : dialogDraw::portraitBackgroundFor(game, id));
+        }
+    }
+    game.audioManager.prefetchLocationMusic(id);
+}
+
+void LocationPrefetch::retain(Game& game) const {
+    for (assets::TextureHandle handle : textures_)
+        game.resources.textures.retain(handle);
+}
+
+void LocationPrefetch::finish(Game& game) {
+    if (!target_)
+        return;
+
+    const auto& cache = game.resources.textures;
+    std::vector<std::string> misses;
+    for (assets::TextureHandle handle : textures_) {
+        if (cache.stalledOnPrefetch(handle))
+            misses.push_back(cache.label(handle) + " (waited for decode)");
+        else if (!cache.isResident(handle))
+            misses.push_back(cache.label(handle) + " (not ready)");
+    }
+    if (!game.audioManager.locationMusicStaged(*target_))
+        misses.push_back("location music (waited for read)");
+
+    const Location* location = Locations::findById(game.locations, *target_);
+    const std::string name = location ? location->name : "destination";
+    const std::size_t staged = textures_.size() + 1;
+    if (misses.empty()) {
+        std::cout << "Prefetched " << name << ": " << staged << " assets resident before fade-in\n";
+    }
+    else {
+        std::cout << "Prefetch for " << name << " missed " << misses.size() << " of " << staged << " assets:";
+        for (const auto& miss : misses)
+            std::cout << "\n  " << miss;
+        std::cout << "\n";
+    }
+
+    target_.reset();
+    textures_.clear();
+}
+
+} // namespace core
@@ -0,0 +1,31 @@
+#pragma once
+// === C++ Libraries ===
+#include <optional>  // Holds the destination while a prefetch is running.
+#include <vector>    // Lists the textures staged for the destination.
+// === Header Files ===
+#include "rendering/locations.hpp"     // Provides LocationId for the destination.
+#include "resources/textureCache.hpp"  // Stages textures through their cache handles.
+
+struct Game;
+
+namespace core {
+
+// Stages a teleport destination's background, music and speaker portraits on background
+// threads while the screen fades to black, so the arrival does not decode on the main thread.
+class LocationPrefetch {
+public:
+    // Starts reading and decoding everything the arrival at id will show.
+    void begin(Game& game, LocationId id);
+    // Keeps the staged textures from being evicted; call once per frame.
+    void retain(Game& game) const;
+    // Logs which staged assets were not resident in time and stops retaining them.
+    void finish(Game& game);
+
+    bool active() const noexcept { return target_.has_value(); }
+
+private:
+    std::optional<LocationId> target_;
+    std::vector<assets::TextureHandle> textures_;
+};
+
+} // namespace core
@@ -10,6 +10,12 @@
 #include <SFML/Window.hpp>
 // === Header Files ===
 #include "game.hpp"
+#include "launchOptions.hpp"
+#include "memoryRegistry.hpp"
+#include "resources/assetPack.hpp"
+#include "resources/assetProfiler.hpp"
+#include "resources/assetUsage.hpp"
+#include "resources/contentStore.hpp"
 #include "ui/quizGenerator.hpp"
 #include "ui/quizUI.hpp"
 
@@ -25,11 +31,36 @@ int main(int argc, char** argv) {
         // falls canonical() aus irgendeinem Grund nicht geht: egal, dann läuft's wie bisher
     }
 
+    // Release builds ship glandular.gpak; without it every asset is read from assets/.
+    assets::mountPack();
+
     // Exit early if the quiz dev-mode flag is present so we can skip the full game.
     if (runQuizDevMode(argc, argv))
         return 0;
 
-    Game game;
+    LaunchOptions options = parseLaunchOptions(argc, argv);
+    // Enabled before Game loads anything, so every asset gets a row in the report.
+    if (options.assetReport)
+        assets::profiler().enable();
+    if (options.traceAssetUsage)
+        assets::usageTracer().enable();
+
+    Game game(options);
+    // Startup loads are done; duplicates the texture cache finds later are logged as they happen.
+    assets::contentStore().printSummary();
     game.run();
+
+    if (options.memReport) {
+        core::memoryRegistry().sample();
+        core::memoryRegistry().writeJson("mem_report.json");
+    }
+
+    if (options.assetReport) {
+        assets::profiler().printTopOffenders(10);
+        assets::profiler().writeReport("asset_report");
+    }
+
+    if (options.traceAssetUsage)
+        assets::usageTracer().writeReport("asset_usage");
     return 0;
 }
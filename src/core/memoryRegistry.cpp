@@ -0,0 +1,92 @@
+// === C++ Libraries ===
+#include <algorithm>   // Keeps the larger value of each peak field.
+#include <fstream>     // Writes the JSON report.
+#include <functional>  // Compares the string buffer address against the object with std::less.
+#include <iostream>    // Reports the written file or the failure.
+#include <utility>     // Moves names and measures into the registry.
+// === Header Files ===
+#include "core/memoryRegistry.hpp"  // Declares MemoryRegistry implemented below.
+
+namespace core {
+namespace {
+std::string jsonString(const std::string& text) {
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\')
+            quoted += '\\';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+void writeUsage(std::ostream& json, const MemoryUsage& usage) {
+    json << "{\"cpuBytes\": " << usage.cpuBytes << ", \"gpuBytes\": " << usage.gpuBytes
+         << ", \"items\": " << usage.items << "}";
+}
+} // namespace
+
+std::size_t heapBytes(const std::string& text) {
+    const auto* data = reinterpret_cast<const char*>(text.data());
+    const auto* self = reinterpret_cast<const char*>(&text);
+    const bool isInline = !std::less<>()(data, self) && std::less<>()(data, self + sizeof(text));
+    return isInline ? 0 : text.capacity() + 1;
+}
+
+void MemoryRegistry::add(std::string category, std::string name, Measure measure) {
+    for (auto& source : entries) {
+        if (source.category == category && source.name == name) {
+            source.measure = std::move(measure);
+            return;
+        }
+    }
+    entries.push_back(Source{ std::move(category), std::move(name), std::move(measure) });
+}
+
+void MemoryRegistry::sample() {
+    for (auto& source : entries) {
+        source.current = source.measure();
+        source.peak.cpuBytes = std::max(source.peak.cpuBytes, source.current.cpuBytes);
+        source.peak.gpuBytes = std::max(source.peak.gpuBytes, source.current.gpuBytes);
+        source.peak.items = std::max(source.peak.items, source.current.items);
+    }
+}
+
+MemoryUsage MemoryRegistry::total() const {
+    MemoryUsage sum;
+    for (const auto& source : entries) {
+        sum.cpuBytes += source.current.cpuBytes;
+        sum.gpuBytes += source.current.gpuBytes;
+        sum.items += source.current.items;
+    }
+    return sum;
+}
+
+bool MemoryRegistry::writeJson(const std::string& path) const {
+    std::ofstream json(path);
+    if (!json) {
+        std::cout << "Failed to write memory report " << path << "\n";
+        return false;
+    }
+    json << "{\n  \"total\": ";
+    writeUsage(json, total());
+    json << ",\n  \"sources\": [\n";
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        const Source& source = entries[i];
+        json << "    {\"category\": " << jsonString(source.category) << ", \"name\": " << jsonString(source.name)
+             << ", \"current\": ";
+        writeUsage(json, source.current);
+        json << ", \"peak\": ";
+        writeUsage(json, source.peak);
+        json << "}" << (i + 1 < entries.size() ? ",\n" : "\n");
+    }
+    json << "  ]\n}\n";
+    std::cout << "Wrote memory report for " << entries.size() << " sources to " << path << "\n";
+    return true;
+}
+
+MemoryRegistry& memoryRegistry() {
+    static MemoryRegistry instance;
+    return instance;
+}
+
+} // namespace core
@@ -0,0 +1,54 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>     // Provides std::size_t for the byte counts.
+#include <functional>  // Stores the callback that measures each source.
+#include <string>      // Names the categories and sources.
+#include <vector>      // Holds the registered sources in report order.
+
+namespace core {
+
+// What one source holds when it is sampled. These are estimates from element counts, not
+// allocator statistics: textures count width * height * 4 bytes of VRAM, sound buffers two
+// bytes per sample, containers their capacity plus the heap text of their strings.
+struct MemoryUsage {
+    std::size_t cpuBytes = 0;
+    std::size_t gpuBytes = 0;
+    std::size_t items = 0;  // Textures, buffers, entries, ... whatever the source counts.
+};
+
+// Heap bytes owned by text; strings that fit the small-string buffer own none.
+std::size_t heapBytes(const std::string& text);
+
+// Where memory goes, by category ("textures", "sounds", "game state", ...). Subsystems add a
+// source once; sample() asks every source for its current usage, so nothing is tracked between
+// samples. Read by the memory overlay (F3) and written by --mem-report. Main thread only.
+class MemoryRegistry {
+public:
+    using Measure = std::function<MemoryUsage()>;
+
+    struct Source {
+        std::string category;
+        std::string name;
+        Measure measure;
+        MemoryUsage current;  // Result of the last sample().
+        MemoryUsage peak;     // Largest value of each field over every sample().
+    };
+
+    // Registers a source, or replaces the measure of the source with the same category and name.
+    void add(std::string category, std::string name, Measure measure);
+    // Measures every source and updates the peaks.
+    void sample();
+    const std::vector<Source>& sources() const { return entries; }
+    // Sum of the last sample over every source.
+    MemoryUsage total() const;
+
+    // Writes the last sample and the peaks as JSON. Returns false if the file could not be written.
+    bool writeJson(const std::string& path) const;
+
+private:
+    std::vector<Source> entries;
+};
+
+MemoryRegistry& memoryRegistry();
+
+} // namespace core
@@ -0,0 +1,52 @@
+#pragma once
+// === SFML Libraries ===
+#include <SFML/System/Time.hpp>  // Represents simulated timestamps and durations.
+
+namespace core {
+
+namespace detail {
+    inline sf::Time simulationTime = sf::Time::Zero;      // Sum of all fixed simulation steps so far.
+    inline sf::Time renderInterpolation = sf::Time::Zero; // Unsimulated remainder, only set while rendering.
+}
+
+// Current simulated time. During the render step this includes the interpolation remainder,
+// so animations stay smooth between fixed steps. The remainder is dropped again after the
+// render, so this can step back by up to one fixed step between render and the next update.
+inline sf::Time simulationNow() {
+    return detail::simulationTime + detail::renderInterpolation;
+}
+
+// Advances simulated time by one fixed step (called by Game::run only).
+inline void advanceSimulation(sf::Time step) {
+    detail::simulationTime += step;
+}
+
+// Sets how far the render step sits past the last simulated step (0 outside of rendering).
+inline void setRenderInterpolation(sf::Time remainder) {
+    detail::renderInterpolation = remainder;
+}
+
+// Drop-in replacement for sf::Clock that measures simulated instead of wall-clock time,
+// so every timer built on it behaves the same at 30, 60 or 240 fps.
+// Starts are taken from the last fixed step, never from the interpolated render time, so a
+// clock restarted while rendering still reads zero or more on the next update.
+class SimClock {
+public:
+    // Returns the simulated time since construction or the last restart().
+    sf::Time getElapsedTime() const { return simulationNow() - start_; }
+
+    // Restarts the clock and returns the simulated time that had elapsed up to the last step.
+    sf::Time restart() {
+        sf::Time elapsed = detail::simulationTime - start_;
+        start_ = detail::simulationTime;
+        return elapsed;
+    }
+
+    // Moves the start forward by amount, keeping any remainder (used for fixed-rate emitters).
+    void consume(sf::Time amount) { start_ += amount; }
+
+private:
+    sf::Time start_ = detail::simulationTime;
+};
+
+} // namespace core
@@ -16,6 +16,23 @@ enum class GameState {
     FinalChoice,
 };
 
+// Short name of a state, used to label scenes in debug reports.
+inline const char* gameStateName(GameState state) {
+    switch (state) {
+        case GameState::BattleDemo: return "battle";
+        case GameState::Credits: return "credits";
+        case GameState::IntroScreen: return "intro_screen";
+        case GameState::IntroTitle: return "intro_title";
+        case GameState::Dialogue: return "dialogue";
+        case GameState::MapSelection: return "map_selection";
+        case GameState::WeaponSelection: return "weapon_selection";
+        case GameState::Quiz: return "quiz";
+        case GameState::TreasureChest: return "treasure_chest";
+        case GameState::FinalChoice: return "final_choice";
+    }
+    return "unknown";
+}
+
 class Game;
 
 // Base class for any per-mode state handler that processes events/updates/draws.
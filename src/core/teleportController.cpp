@@ -8,6 +8,7 @@
 #include "audio/audioManager.hpp"    // Controls music fading while a teleport happens.
 #include "core/game.hpp"             // Gives access to Game state mutated by handleTravel.
 #include "resources/resources.hpp"   // Supplies sound buffers consumed by TeleportController.
+#include "resources/assetUsage.hpp"  // Notes teleport sound plays for --trace-asset-usage.
 #include "story/locationDialogues.hpp"// Provides story::locationDialogueFor used when entering a map.
 #include "story/storyIntro.hpp"      // Supplies encounter dialogue sequences referenced during travel.
 
@@ -15,9 +16,9 @@ namespace core {
 
 // Loads teleport sound buffers from the shared resources pool.
 void TeleportController::loadResources(const Resources& resources) {
-    teleportStartSound_ = std::make_unique<sf::Sound>(resources.teleportStart);
-    teleportMiddleSound_ = std::make_unique<sf::Sound>(resources.teleportMiddle);
-    teleportStopSound_ = std::make_unique<sf::Sound>(resources.teleportStop);
+    teleportStartSound_ = std::make_unique<sf::Sound>(resources.sound(SoundId::TeleportStart));
+    teleportMiddleSound_ = std::make_unique<sf::Sound>(resources.sound(SoundId::TeleportMiddle));
+    teleportStopSound_ = std::make_unique<sf::Sound>(resources.sound(SoundId::TeleportStop));
 }
 
 // Starts the teleport phase machine and fades out the current music.
@@ -35,8 +36,10 @@ void TeleportController::begin(LocationId target, AudioManager& audio) {
 
     audio.fadeOutLocationMusic(fadeOutDuration_);
 
-    if (teleportStartSound_)
+    if (teleportStartSound_) {
+        assets::notePlay(*teleportStartSound_);
         teleportStartSound_->play();
+    }
     if (teleportMiddleSound_)
         teleportMiddleSound_->stop();
     if (teleportStopSound_)
@@ -44,7 +47,7 @@ void TeleportController::begin(LocationId target, AudioManager& audio) {
 }
 
 // Advances timers for each teleport phase and fires travel callbacks.
-void TeleportController::update(const TravelCallback& travelCallback) {
+void TeleportController::update(const TravelCallback& travelCallback, const ArrivalCallback& arrivalCallback) {
     if (!active_ || phase_ == Phase::None)
         return;
 
@@ -54,6 +57,7 @@ void TeleportController::update(const TravelCallback& travelCallback) {
             if (!middleStarted_ && elapsed >= 3.0f) {
                 if (teleportMiddleSound_) {
                     teleportMiddleSound_->stop();
+                    assets::notePlay(*teleportMiddleSound_);
                     teleportMiddleSound_->play();
                 }
                 middleStarted_ = true;
@@ -76,10 +80,13 @@ void TeleportController::update(const TravelCallback& travelCallback) {
                 if (!stopPlayed_) {
                     if (teleportStopSound_) {
                         teleportStopSound_->stop();
+                        assets::notePlay(*teleportStopSound_);
                         teleportStopSound_->play();
                     }
                     stopPlayed_ = true;
                 }
+                if (target_ && arrivalCallback)
+                    arrivalCallback(*target_);
             }
             break;
         }
@@ -126,6 +133,17 @@ void TeleportController::stopSounds() {
         teleportStopSound_->stop();
 }
 
+// Mirrors the branches of handleTravel below without changing any state.
+const std::vector<DialogueLine>* arrivalDialogueFor(const Game& game, LocationId id) {
+    if (id == LocationId::Gonad && game.dragonStoneCount >= 4 && game.finalEncounterPending)
+        return &gonad_part_three;
+    if (id == LocationId::Seminiferous && game.finalEncounterPending)
+        return &seminiferous_part_one;
+    if (id == LocationId::Gonad && game.lastCompletedLocation.has_value() && story::locationDialogueFor(id))
+        return &gonadWelcomeBack;
+    return story::locationDialogueFor(id);
+}
+
 // Swaps game state to the requested location and sets up its dialogue.
 void handleTravel(Game& game, LocationId id) {
     auto locPtr = Locations::findById(game.locations, id);
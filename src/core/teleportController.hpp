@@ -3,11 +3,13 @@
 #include <functional>  // Provides TravelCallback's std::function for signaling destinations.
 #include <memory>      // Stores sound handles in std::unique_ptr instances.
 #include <optional>    // Tracks optional teleport targets and state.
+#include <vector>      // Returns the dialogue lines shown on arrival.
 // === SFML Libraries ===
 #include <SFML/Audio.hpp>       // Declares sf::Sound used by the teleport sequence.
-#include <SFML/System/Clock.hpp>  // Gives sf::Clock for timing phase transitions.
 // === Header Files ===
+#include "core/simulationClock.hpp"  // Gives core::SimClock for timing phase transitions.
 #include "rendering/locations.hpp"  // Supplies LocationId and location helpers used in handleTravel.
+#include "story/dialogueLine.hpp"   // Declares DialogueLine for arrivalDialogueFor.
 
 struct AudioManager;
 struct Resources;
@@ -27,6 +29,7 @@ public:
     };
 
     using TravelCallback = std::function<void(LocationId)>;
+    using ArrivalCallback = std::function<void(LocationId)>;
 
     TeleportController() = default;
 
@@ -38,8 +41,9 @@ public:
     void begin(LocationId target, AudioManager& audio);
 
     // Updates the teleport timers, plays the appropriate sounds, and invokes the
-    // callback as soon as the teleport destination should be reached.
-    void update(const TravelCallback& travelCallback);
+    // callback as soon as the teleport destination should be reached. arrivalCallback
+    // runs when the black cooldown ends and the destination starts fading in.
+    void update(const TravelCallback& travelCallback, const ArrivalCallback& arrivalCallback = {});
 
     bool active() const noexcept { return active_; }
     Phase phase() const noexcept { return phase_; }
@@ -55,7 +59,7 @@ private:
 
     Phase phase_ = Phase::None;
     bool active_ = false;
-    sf::Clock clock_;
+    SimClock clock_;
     float fadeOutDuration_ = 3.0f;
     float cooldownDuration_ = 2.0f;
     float fadeInDuration_ = 1.0f;
@@ -70,5 +74,7 @@ private:
 
 // Updates game state and dialogue when a travel destination is reached.
 void handleTravel(Game& game, LocationId id);
+// Dialogue handleTravel would start for id in the current game state (nullptr if none).
+const std::vector<DialogueLine>* arrivalDialogueFor(const Game& game, LocationId id);
 
 } // namespace core
@@ -9,6 +9,7 @@ namespace dragons {
 // Populates Game::dragonPortraits from the texture/name list.
 void loadDragonPortraits(Game& game) {
     game.dragonPortraits.clear();
+    game.layoutDirty.panels = true;
 
     struct PortraitInfo {
         const sf::Texture* texture;
@@ -16,10 +17,10 @@ void loadDragonPortraits(Game& game) {
     };
 
     const std::vector<PortraitInfo> portraits = {
-        { &game.resources.fireDragon, "Rowsted Sheacane" },
-        { &game.resources.waterDragon, "Flawtin Seamen" },
-        { &game.resources.earthDragon, "Grounded Claymore" },
-        { &game.resources.airDragon, "Gustavo Windimaess" }
+        { &game.resources.texture(TextureId::FireDragon), "Rowsted Sheacane" },
+        { &game.resources.texture(TextureId::WaterDragon), "Flawtin Seamen" },
+        { &game.resources.texture(TextureId::EarthDragon), "Grounded Claymore" },
+        { &game.resources.texture(TextureId::AirDragon), "Gustavo Windimaess" }
     };
 
     game.dragonPortraits.reserve(portraits.size());
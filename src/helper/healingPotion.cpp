@@ -1,6 +1,7 @@
 #include "helper/healingPotion.hpp"
 
 #include "core/game.hpp"
+#include "resources/assetUsage.hpp"
 
 #include <algorithm>
 
@@ -19,9 +20,10 @@ bool beginHealing(Game& game, float startHp) {
     game.healingPotionClock.restart();
     game.healingPotionActive = true;
     if (!game.healPotionSound)
-        game.healPotionSound.emplace(game.resources.healSound);
+        game.healPotionSound.emplace(game.resources.sound(SoundId::HealSound));
     else
-        game.healPotionSound->setBuffer(game.resources.healSound);
+        game.healPotionSound->setBuffer(game.resources.sound(SoundId::HealSound));
+    assets::notePlay(*game.healPotionSound);
     game.healPotionSound->play();
     return true;
 }
@@ -32,7 +34,7 @@ bool start(Game& game) {
         return false;
 
     game.healingPotionReceived = true;
-    game.itemController.addItem(game.resources.healPotion, "heal_potion");
+    game.itemController.addItem(game.resources.texture(TextureId::HealPotion), "heal_potion");
 
     float startHp = std::clamp(game.playerHp, 0.f, game.playerHpMax);
     return beginHealing(game, startHp);
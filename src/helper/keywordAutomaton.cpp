@@ -0,0 +1,96 @@
+// === C++ Libraries ===
+#include <algorithm>  // Uses std::lower_bound to keep child edges sorted.
+#include <deque>      // Walks the trie breadth-first when computing failure links.
+// === Header Files ===
+#include "helper/keywordAutomaton.hpp"  // Declares KeywordAutomaton implemented below.
+
+namespace {
+// Orders child edges by byte so lookups can binary-search.
+bool edgeLess(const std::pair<unsigned char, int>& edge, unsigned char c) {
+    return edge.first < c;
+}
+} // namespace
+
+void KeywordAutomaton::clear() {
+    nodes.assign(1, Node{});
+}
+
+int KeywordAutomaton::child(int node, unsigned char c) const {
+    const auto& children = nodes[static_cast<std::size_t>(node)].children;
+    auto it = std::lower_bound(children.begin(), children.end(), c, edgeLess);
+    if (it == children.end() || it->first != c)
+        return kNoNode;
+    return it->second;
+}
+
+void KeywordAutomaton::add(std::string_view keyword, std::size_t keywordId) {
+    if (keyword.empty())
+        return;
+
+    int node = 0;
+    for (char raw : keyword) {
+        auto c = static_cast<unsigned char>(raw);
+        int next = child(node, c);
+        if (next == kNoNode) {
+            next = static_cast<int>(nodes.size());
+            Node created;
+            created.depth = nodes[static_cast<std::size_t>(node)].depth + 1;
+            nodes.push_back(std::move(created));
+            auto& children = nodes[static_cast<std::size_t>(node)].children;
+            children.insert(std::lower_bound(children.begin(), children.end(), c, edgeLess), { c, next });
+        }
+        node = next;
+    }
+
+    auto& terminal = nodes[static_cast<std::size_t>(node)];
+    if (terminal.keywordId == kNoNode)
+        terminal.keywordId = static_cast<int>(keywordId);
+}
+
+void KeywordAutomaton::build() {
+    std::deque<int> queue;
+    for (const auto& [c, next] : nodes[0].children) {
+        nodes[static_cast<std::size_t>(next)].fail = 0;
+        nodes[static_cast<std::size_t>(next)].outputLink = kNoNode;
+        queue.push_back(next);
+    }
+
+    while (!queue.empty()) {
+        int current = queue.front();
+        queue.pop_front();
+
+        for (const auto& [c, next] : nodes[static_cast<std::size_t>(current)].children) {
+            int fallback = nodes[static_cast<std::size_t>(current)].fail;
+            while (fallback != 0 && child(fallback, c) == kNoNode)
+                fallback = nodes[static_cast<std::size_t>(fallback)].fail;
+            int target = child(fallback, c);
+
+            Node& node = nodes[static_cast<std::size_t>(next)];
+            node.fail = (target != kNoNode && target != next) ? target : 0;
+            const Node& failNode = nodes[static_cast<std::size_t>(node.fail)];
+            node.outputLink = (failNode.keywordId != kNoNode) ? node.fail : failNode.outputLink;
+            queue.push_back(next);
+        }
+    }
+}
+
+void KeywordAutomaton::findAll(std::string_view text, std::vector<Match>& out) const {
+    int state = 0;
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        auto c = static_cast<unsigned char>(text[i]);
+        while (state != 0 && child(state, c) == kNoNode)
+            state = nodes[static_cast<std::size_t>(state)].fail;
+        int next = child(state, c);
+        state = (next == kNoNode) ? 0 : next;
+
+        // Report the keyword ending here plus every shorter keyword that is a suffix of it.
+        int output = (nodes[static_cast<std::size_t>(state)].keywordId != kNoNode)
+            ? state
+            : nodes[static_cast<std::size_t>(state)].outputLink;
+        while (output != kNoNode && output != 0) {
+            const Node& hit = nodes[static_cast<std::size_t>(output)];
+            out.push_back({ i + 1 - hit.depth, hit.depth, static_cast<std::size_t>(hit.keywordId) });
+            output = hit.outputLink;
+        }
+    }
+}
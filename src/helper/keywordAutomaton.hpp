@@ -0,0 +1,43 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>      // Provides std::size_t for positions and keyword ids.
+#include <string_view>  // Accepts keywords and scanned text without copying.
+#include <utility>      // Stores child edges as (byte, node) pairs.
+#include <vector>       // Holds the trie nodes and reported matches.
+
+// Aho-Corasick automaton: finds every occurrence of a fixed keyword set in a single pass.
+// Build it once with add()+build(), then call findAll() as often as needed.
+class KeywordAutomaton {
+public:
+    struct Match {
+        std::size_t position;   // Byte offset of the first keyword character.
+        std::size_t length;     // Keyword length in bytes.
+        std::size_t keywordId;  // Id passed to add().
+    };
+
+    // Drops every keyword so the automaton can be refilled.
+    void clear();
+    // Registers a keyword; if the same keyword is added twice, the first id wins.
+    void add(std::string_view keyword, std::size_t keywordId);
+    // Computes the failure/output links. Must run after the last add() and before findAll().
+    void build();
+    // Appends every keyword occurrence in text to out, ordered by end position.
+    void findAll(std::string_view text, std::vector<Match>& out) const;
+
+    bool empty() const { return nodes.size() <= 1; }
+
+private:
+    static constexpr int kNoNode = -1;
+
+    struct Node {
+        std::vector<std::pair<unsigned char, int>> children;  // Sorted by byte for binary search.
+        int fail = 0;                 // Longest proper suffix that is also a trie prefix.
+        int outputLink = kNoNode;     // Nearest suffix node that ends a keyword.
+        int keywordId = kNoNode;      // Keyword ending exactly at this node, if any.
+        std::size_t depth = 0;        // Prefix length, i.e. keyword length when keywordId is set.
+    };
+
+    int child(int node, unsigned char c) const;
+
+    std::vector<Node> nodes{ Node{} };
+};
@@ -7,6 +7,7 @@
 #include "helper/weaponHelpers.hpp"  // Invokes weapon layout helpers at the end of updateLayout.
 #include "helper/dragonHelpers.hpp"  // Relies on dragon layout helpers for portrait positioning.
 #include "helper/layoutHelpers.hpp"  // Declares updateLayout implemented in this translation unit.
+#include "helper/colorHelper.hpp"    // Tints the debug layout pass counter.
 
 namespace ui {
 namespace layout {
@@ -51,10 +52,8 @@ void layoutItemIcons(Game& game) {
         item.sprite.setPosition(center);
     }
 }
-} // namespace
-
-// Updates all major UI boxes, reloads the frame, and triggers weapon/dragon layouts.
-void updateLayout(Game& game) {
+// Sizes and positions every window-relative box, the menu button, and the menu tabs.
+void layoutBoxes(Game& game) {
     float w = game.window.getSize().x;
     float h = game.window.getSize().y;
 
@@ -120,22 +119,8 @@ void updateLayout(Game& game) {
     game.weaponPanel.setSize({ weaponPanelWidth, weaponPanelHeight });
     game.weaponPanel.setPosition({ game.nameBox.getPosition().x, weaponPanelY });
 
-    layoutItemIcons(game);
-
-    // === 9-Slice-Textur laden ===
-    try {
-        game.uiFrame.load("assets/textures/boxborder.png");
-    }
-    catch (const std::runtime_error&) {
-        game.uiFrame.load(std::string(TEXTADVENTURE_ASSET_DIR) + "/textures/boxborder.png");
-    }
-
-    // Layout the UI-specific elements (weapon / dragon)
-    ui::weapons::layoutWeaponSelection(game);
-    ui::dragons::layoutDragonPortraits(game);
-
     float buttonTarget = std::clamp(w * 0.08f, 48.f, 72.f);
-    auto texSize = game.resources.menuButton.getSize();
+    auto texSize = game.resources.texture(TextureId::MenuButton).getSize();
     float maxDim = static_cast<float>(std::max(texSize.x, texSize.y));
     float uniformScale = (maxDim > 0.f) ? buttonTarget / maxDim : 1.f;
     sf::Vector2f finalSize{
@@ -173,6 +158,52 @@ void updateLayout(Game& game) {
     game.menuPanel.setPosition(sf::Vector2f{ innerX, innerY });
     game.menuPanel.setSize({ innerWidth, innerHeight });
 }
+} // namespace
+
+// Loads the 9-slice frame texture, falling back to the configured asset directory.
+void loadUiFrame(Game& game) {
+    try {
+        game.uiFrame.load("assets/textures/boxborder.png");
+    }
+    catch (const std::runtime_error&) {
+        game.uiFrame.load(std::string(TEXTADVENTURE_ASSET_DIR) + "/textures/boxborder.png");
+    }
+}
+
+// Recomputes only the sections flagged in game.layoutDirty; returns true if a pass ran.
+bool updateLayout(Game& game) {
+    if (game.itemController.consumeIconsChanged())
+        game.layoutDirty.items = true;
+
+    auto& dirty = game.layoutDirty;
+    if (!dirty.any())
+        return false;
+
+    // Icons and panels sit inside the boxes, so a window change cascades into both.
+    if (dirty.window) {
+        layoutBoxes(game);
+        dirty.items = true;
+        dirty.panels = true;
+    }
+    if (dirty.items)
+        layoutItemIcons(game);
+    if (dirty.panels) {
+        ui::weapons::layoutWeaponSelection(game);
+        ui::dragons::layoutDragonPortraits(game);
+    }
+
+    dirty = Game::LayoutDirtyFlags{ false, false, false };
+    return true;
+}
+
+#ifndef NDEBUG
+void drawLayoutPassCounter(Game& game, sf::RenderTarget& target) {
+    sf::Text counter{ game.resources.uiFont, "layout passes/s: " + std::to_string(game.layoutPassCounter.passesPerSecond), 14 };
+    counter.setFillColor(ColorHelper::Palette::IconGray);
+    counter.setPosition({ 6.f, 4.f });
+    target.draw(counter);
+}
+#endif
 
 } // namespace layout
 } // namespace ui
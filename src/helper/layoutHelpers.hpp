@@ -4,8 +4,15 @@
 
 namespace ui {
 namespace layout {
+    // Loads the 9-slice UI frame texture once at startup.
+    void loadUiFrame(Game& game);
     // Update layout of top-level UI elements (nameBox, textBox, locationBox, itemBox, weaponPanel)
+    // for every section flagged in game.layoutDirty. Returns false when nothing was dirty.
     // Implementation: src/helper/layoutHelpers.cpp
-    void updateLayout(Game& game);
+    bool updateLayout(Game& game);
+#ifndef NDEBUG
+    // Draws the debug "layout passes/s" readout in the top-left corner.
+    void drawLayoutPassCounter(Game& game, sf::RenderTarget& target);
+#endif
 }
 }
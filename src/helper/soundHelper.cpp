@@ -14,15 +14,9 @@ void startFade(SoundFadeState& fade, float startVolume, float targetVolume, floa
     fade.clock.restart();
 }
 
-// Advances the fade, applies the interpolated volume, and stops the sound if the fade finished.
-void processFade(
-    std::optional<sf::Sound>& sound,
-    SoundFadeState& fade,
-    const std::function<void()>& onStop
-) {
-    if (!fade.active || !sound)
-        return;
-
+namespace {
+// Applies the interpolated volume to any sound source and stops it if the fade finished.
+void applyFade(sf::SoundSource& source, SoundFadeState& fade, const std::function<void()>& onStop) {
     float duration = fade.duration > 0.f ? fade.duration : 0.f;
     float t = duration > 0.f
         ? std::min(1.f, fade.clock.getElapsedTime().asSeconds() / duration)
@@ -30,15 +24,38 @@ void processFade(
     float volume = fade.startVolume + (fade.targetVolume - fade.startVolume) * t;
     volume = std::clamp(volume, 0.f, 100.f);
 
-    sound->setVolume(volume);
+    source.setVolume(volume);
 
     if (t >= 1.f) {
         fade.active = false;
         if (fade.targetVolume <= 0.f) {
-            sound->stop();
+            source.stop();
             onStop();
         }
     }
 }
+} // namespace
+
+// Advances the fade, applies the interpolated volume, and stops the sound if the fade finished.
+void processFade(
+    std::optional<sf::Sound>& sound,
+    SoundFadeState& fade,
+    const std::function<void()>& onStop
+) {
+    if (!fade.active || !sound)
+        return;
+    applyFade(*sound, fade, onStop);
+}
+
+// Streamed music variant; shares the interpolation with the sf::Sound overload.
+void processFade(
+    std::optional<sf::Music>& music,
+    SoundFadeState& fade,
+    const std::function<void()>& onStop
+) {
+    if (!fade.active || !music)
+        return;
+    applyFade(*music, fade, onStop);
+}
 
 } // namespace sound
@@ -1,10 +1,11 @@
 #pragma once
 // === C++ Libraries ===
 #include <functional>  // Needs std::function for processFade's onStop callbacks.
-#include <optional>    // Stores optional sf::Sound references manipulated during fades.
+#include <optional>    // Stores optional sf::Sound/sf::Music handles manipulated during fades.
 // === SFML Libraries ===
-#include <SFML/Audio.hpp>        // Declares sf::Sound used when adjusting volumes.
-#include <SFML/System/Clock.hpp> // Provides sf::Clock used to track fade progress.
+#include <SFML/Audio.hpp>        // Declares sf::Sound and sf::Music used when adjusting volumes.
+// === Header Files ===
+#include "core/simulationClock.hpp"  // Provides core::SimClock used to track fade progress.
 
 // Tracks the progress of a volume fade for a single sound.
 struct SoundFadeState {
@@ -12,7 +13,7 @@ struct SoundFadeState {
     float duration = 1.f;
     float startVolume = 0.f;
     float targetVolume = 0.f;
-    sf::Clock clock;
+    core::SimClock clock;
 };
 
 namespace sound {
@@ -24,4 +25,10 @@ namespace sound {
         SoundFadeState& fade,
         const std::function<void()>& onStop
     );
+    // Same as above for streamed music.
+    void processFade(
+        std::optional<sf::Music>& music,
+        SoundFadeState& fade,
+        const std::function<void()>& onStop
+    );
 }
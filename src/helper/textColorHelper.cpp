@@ -7,20 +7,26 @@
 #include "story/textStyles.hpp"    // Provides speaker-specific color/style metadata.
 #include "story/storyIntro.hpp"    // Adds extra tokens that should be colored for story text.
 #include "helper/colorHelper.hpp"  // References the normal palette for default text segments.
+#include "helper/keywordAutomaton.hpp" // Matches every token in one pass over the text.
 #include "helper/textColorHelper.hpp"  // Declares buildColoredSegments implemented below.
 
-// Scans for speaker/story tokens and returns pre-colored segments for rendering.
-std::vector<ColoredTextSegment> buildColoredSegments(const std::string& text) {
-    std::vector<ColoredTextSegment> segments;
-
-    if (text.empty())
-        return segments;
-
-    struct TokenMatch {
-        std::size_t pos;
-        std::size_t length;
-        sf::Color color;
-    };
+namespace {
+// Every colored token compiled into one automaton; keyword ids index into colors.
+struct ColorKeywordTable {
+    KeywordAutomaton automaton;
+    std::vector<sf::Color> colors;
+    bool built = false;
+    std::size_t dynamicRevision = 0;   // StoryIntro::dynamicColorTokensRevision at build time.
+    std::string playerName;            // playerDisplayName at build time (the Player speaker token).
+};
+
+// Returns the shared keyword table, rebuilding it only when the dynamic tokens or player name changed.
+const ColorKeywordTable& colorKeywords() {
+    static ColorKeywordTable table;
+    if (table.built
+        && table.dynamicRevision == StoryIntro::dynamicColorTokensRevision
+        && table.playerName == playerDisplayName)
+        return table;
 
     const std::array<TextStyles::SpeakerId, 11> speakersToColor{
         TextStyles::SpeakerId::StoryTeller,
@@ -36,57 +42,79 @@ std::vector<ColoredTextSegment> buildColoredSegments(const std::string& text) {
         TextStyles::SpeakerId::EarthDragon
     };
 
-    std::vector<std::pair<std::string, sf::Color>> tokens;
-    tokens.reserve(speakersToColor.size());
+    table.automaton.clear();
+    table.colors.clear();
+    // Registration order is priority order: speaker names win over story tokens spelled the same.
+    auto add = [&](const std::string& word, sf::Color color) {
+        table.automaton.add(word, table.colors.size());
+        table.colors.push_back(color);
+    };
     for (auto speaker : speakersToColor) {
         TextStyles::SpeakerStyle style = TextStyles::speakerStyle(speaker);
         if (!style.name.empty())
-            tokens.emplace_back(style.name, style.color);
+            add(style.name, style.color);
     }
-    const std::size_t speakerTokenCount = tokens.size();
+    for (const auto& [word, color] : StoryIntro::colorTokens())
+        add(word, color);
+    for (const auto& [word, color] : StoryIntro::dynamicColorTokens)
+        add(word, color);
+    table.automaton.build();
+
+    table.built = true;
+    table.dynamicRevision = StoryIntro::dynamicColorTokensRevision;
+    table.playerName = playerDisplayName;
+    return table;
+}
 
-    auto storyTokens = StoryIntro::colorTokensWithDynamic();
-    tokens.insert(tokens.end(), storyTokens.begin(), storyTokens.end());
+// True when the character before/after a match does not continue a word.
+bool isWordBoundary(const std::string& text, std::size_t pos, std::size_t length) {
+    bool leftOk = (pos == 0) || !std::isalnum(static_cast<unsigned char>(text[pos - 1]));
+    std::size_t after = pos + length;
+    bool rightOk = (after >= text.size()) || !std::isalnum(static_cast<unsigned char>(text[after]));
+    return leftOk && rightOk;
+}
+} // namespace
+
+// Scans for speaker/story tokens and returns pre-colored segments viewing into text.
+std::vector<ColoredTextSegment> buildColoredSegments(const std::string& text) {
+    std::vector<ColoredTextSegment> segments;
 
-    std::vector<TokenMatch> matches;
-    matches.reserve(tokens.size());
-    for (const auto& token : tokens) {
-        std::size_t searchPos = 0;
-        while ((searchPos = text.find(token.first, searchPos)) != std::string::npos) {
-            bool leftOk = (searchPos == 0) || !std::isalnum(static_cast<unsigned char>(text[searchPos - 1]));
-            std::size_t after = searchPos + token.first.size();
-            bool rightOk = (after >= text.size()) || !std::isalnum(static_cast<unsigned char>(text[after]));
+    if (text.empty())
+        return segments;
 
-            if (leftOk && rightOk)
-                matches.push_back({ searchPos, token.first.size(), token.second });
+    const ColorKeywordTable& keywords = colorKeywords();
 
-            searchPos += token.first.size();
-        }
-    }
+    static std::vector<KeywordAutomaton::Match> matches;
+    matches.clear();
+    keywords.automaton.findAll(text, matches);
+    std::erase_if(matches, [&](const KeywordAutomaton::Match& match) {
+        return !isWordBoundary(text, match.position, match.length);
+    });
 
-    std::sort(matches.begin(), matches.end(), [](const TokenMatch& a, const TokenMatch& b) {
-        if (a.pos == b.pos)
+    std::sort(matches.begin(), matches.end(), [](const KeywordAutomaton::Match& a, const KeywordAutomaton::Match& b) {
+        if (a.position == b.position)
             return a.length > b.length; // prefer longer tokens like "Dragon Scales" over shorter overlaps
-        return a.pos < b.pos;
+        return a.position < b.position;
     });
 
+    const std::string_view source = text;
     std::size_t cursor = 0;
     for (const auto& match : matches) {
-        if (match.pos < cursor)
+        if (match.position < cursor)
             continue;
 
-        if (match.pos > cursor)
-            segments.push_back({ text.substr(cursor, match.pos - cursor), ColorHelper::Palette::Normal });
+        if (match.position > cursor)
+            segments.push_back({ source.substr(cursor, match.position - cursor), ColorHelper::Palette::Normal });
 
-        segments.push_back({ text.substr(match.pos, match.length), match.color });
-        cursor = match.pos + match.length;
+        segments.push_back({ source.substr(match.position, match.length), keywords.colors[match.keywordId] });
+        cursor = match.position + match.length;
     }
 
     if (cursor < text.size())
-        segments.push_back({ text.substr(cursor), ColorHelper::Palette::Normal });
+        segments.push_back({ source.substr(cursor), ColorHelper::Palette::Normal });
 
     if (segments.empty())
-        segments.push_back({ text, ColorHelper::Palette::Normal });
+        segments.push_back({ source, ColorHelper::Palette::Normal });
 
     return segments;
 }
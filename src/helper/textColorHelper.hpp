@@ -1,6 +1,7 @@
 #pragma once
 // === C++ Libraries ===
-#include <string>            // Stores source text and segment substrings for coloring.
+#include <string>            // Accepts the source text that segments point into.
+#include <string_view>       // Segments reference the source text instead of copying it.
 #include <vector>            // Returns dynamic lists of ColoredTextSegment results.
 // === SFML Libraries ===
 #include <SFML/Graphics.hpp>  // Provides sf::Color used for each segment.
@@ -8,10 +9,13 @@
 #include "helper/colorHelper.hpp"  // Supplies default palette colors for fallback segments.
 
 // Describes text and the color it should be rendered in for a segment.
+// The text is a view: whatever it points at must outlive the segment.
 struct ColoredTextSegment {
-    std::string text;
+    std::string_view text;
     sf::Color color = ColorHelper::Palette::Normal;
 };
 
 // Splits a string into colored segments based on tokens/names that should change color.
+// The returned segments view into text, so it has to stay alive while they are used.
 std::vector<ColoredTextSegment> buildColoredSegments(const std::string& text);
+std::vector<ColoredTextSegment> buildColoredSegments(std::string&& text) = delete;
@@ -1,9 +1,11 @@
 // === C++ Libraries ===
-#include <filesystem>  // Iterates over the weapon texture directory when loading options.
-#include <algorithm>    // Uses std::sort and std::transform while preparing weapon data.
+#include <filesystem>  // Splits the weapon file names into stem and extension.
+#include <algorithm>    // Uses std::transform while preparing weapon data.
 #include <cctype>       // Applies std::tolower for case-insensitive hotkey detection.
 // === Header Files ===
 #include "helper/weaponHelpers.hpp"  // Declares the helpers implemented in this file.
+#include "resources/assetFiles.hpp"    // Lists the weapon textures in the pack or assets/.
+#include "resources/contentStore.hpp"  // Loads them, sharing files identical to a manifest texture.
 
 namespace ui {
 namespace weapons {
@@ -20,27 +22,19 @@ namespace {
 void loadWeaponOptions(Game& game) {
     namespace fs = std::filesystem;
 
-    const fs::path weaponDir{"assets/gfx/weapons/fixed"};
     game.weaponOptions.clear();
-
-    if (!fs::exists(weaponDir))
-        return;
+    game.layoutDirty.panels = true;
 
     std::vector<fs::path> weaponFiles;
-    for (const auto& entry : fs::directory_iterator(weaponDir)) {
-        if (!entry.is_regular_file())
-            continue;
-
-        auto ext = entry.path().extension().string();
-        std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    for (const auto& file : assets::listAssetFiles("assets/gfx/weapons/fixed")) {
+        fs::path path{ file };
+        auto ext = toLower(path.extension().string());
         if (ext != ".png" && ext != ".jpg" && ext != ".jpeg")
             continue;
 
-        weaponFiles.push_back(entry.path());
+        weaponFiles.push_back(std::move(path));
     }
 
-    std::sort(weaponFiles.begin(), weaponFiles.end());
-
     game.weaponOptions.reserve(weaponFiles.size());
 
     const std::string prefix = "Weapon ";
@@ -48,7 +42,8 @@ void loadWeaponOptions(Game& game) {
         game.weaponOptions.emplace_back();
         auto& option = game.weaponOptions.back();
 
-        if (!option.texture.loadFromFile(path.string())) {
+        option.texture = assets::contentStore().loadTexture(path.generic_string(), true);
+        if (!option.texture) {
             game.weaponOptions.pop_back();
             continue;
         }
@@ -83,8 +78,7 @@ void loadWeaponOptions(Game& game) {
             option.hotkeyNumber = 3;
         }
         
-        option.sprite.emplace(option.texture);
-        option.sprite->setTexture(option.texture);
+        option.sprite.emplace(*option.texture);
     }
 }
 
@@ -119,7 +113,7 @@ void layoutWeaponSelection(Game& game) {
 
         auto& sprite = *option.sprite;
         sprite.setScale({ 1.f, 1.f });
-        auto texSize = option.texture.getSize();
+        auto texSize = option.texture->getSize();
         float scaleX = (slotWidth * 0.7f) / static_cast<float>(texSize.x);
         float scaleY = (spriteAreaHeight * 0.8f) / static_cast<float>(texSize.y);
         float scale = std::min(scaleX, scaleY);
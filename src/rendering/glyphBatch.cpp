@@ -0,0 +1,128 @@
+// === C++ Libraries ===
+#include <cstdint>  // Casts scaled alpha values back to std::uint8_t.
+#include <set>      // Remembers each (font, size) pair whose glyph page a batch uses.
+#include <utility>  // Pairs a font with its character size.
+// === Header Files ===
+#include "rendering/glyphBatch.hpp"  // Declares GlyphBatch implemented below.
+#include "resources/assetUsage.hpp"  // Counts the font as used for --trace-asset-usage.
+
+namespace {
+// Batches are built on the render thread only.
+std::set<std::pair<const sf::Font*, unsigned int>>& usedGlyphPages() {
+    static std::set<std::pair<const sf::Font*, unsigned int>> pages;
+    return pages;
+}
+} // namespace
+
+std::size_t glyphPageBytes(std::size_t& pageCount) {
+    std::size_t bytes = 0;
+    pageCount = usedGlyphPages().size();
+    for (const auto& [font, characterSize] : usedGlyphPages()) {
+        const sf::Vector2u size = font->getTexture(characterSize).getSize();
+        bytes += static_cast<std::size_t>(size.x) * size.y * 4;
+    }
+    return bytes;
+}
+
+GlyphBatch::GlyphBatch(const sf::Font& font, unsigned int characterSize)
+: font(&font)
+, characterSize(characterSize)
+{
+    usedGlyphPages().emplace(&font, characterSize);
+}
+
+// Mirrors sf::Text's quad layout (1px padding around each glyph rect) for regular, non-italic text.
+void GlyphBatch::addGlyphQuad(
+    sf::VertexArray& vertices,
+    std::vector<sf::Color>& baseColors,
+    sf::Vector2f position,
+    sf::Color color,
+    const sf::Glyph& glyph
+) {
+    const sf::Vector2f padding{ 1.f, 1.f };
+    const sf::Vector2f p1 = glyph.bounds.position - padding;
+    const sf::Vector2f p2 = glyph.bounds.position + glyph.bounds.size + padding;
+    const sf::Vector2f uv1 = sf::Vector2f(glyph.textureRect.position) - padding;
+    const sf::Vector2f uv2 = sf::Vector2f(glyph.textureRect.position + glyph.textureRect.size) + padding;
+
+    vertices.append({ position + sf::Vector2f{ p1.x, p1.y }, color, { uv1.x, uv1.y } });
+    vertices.append({ position + sf::Vector2f{ p2.x, p1.y }, color, { uv2.x, uv1.y } });
+    vertices.append({ position + sf::Vector2f{ p1.x, p2.y }, color, { uv1.x, uv2.y } });
+    vertices.append({ position + sf::Vector2f{ p1.x, p2.y }, color, { uv1.x, uv2.y } });
+    vertices.append({ position + sf::Vector2f{ p2.x, p1.y }, color, { uv2.x, uv1.y } });
+    vertices.append({ position + sf::Vector2f{ p2.x, p2.y }, color, { uv2.x, uv2.y } });
+    baseColors.insert(baseColors.end(), 6, color);
+}
+
+void GlyphBatch::addText(
+    const sf::String& text,
+    sf::Vector2f position,
+    sf::Color fillColor,
+    float outlineThickness,
+    sf::Color outlineColor
+) {
+    constexpr bool isBold = false;
+    const float whitespaceWidth = font->getGlyph(U' ', characterSize, isBold).advance;
+    const float lineSpacing = font->getLineSpacing(characterSize);
+
+    // sf::Text puts the baseline of the first line at y = characterSize.
+    float x = 0.f;
+    float y = static_cast<float>(characterSize);
+    char32_t prevChar = 0;
+    for (char32_t curChar : text) {
+        if (curChar == U'\r')
+            continue;
+
+        x += font->getKerning(prevChar, curChar, characterSize, isBold);
+        prevChar = curChar;
+
+        if (curChar == U' ' || curChar == U'\n' || curChar == U'\t') {
+            if (curChar == U' ')
+                x += whitespaceWidth;
+            else if (curChar == U'\t')
+                x += whitespaceWidth * 4.f;
+            else {
+                y += lineSpacing;
+                x = 0.f;
+            }
+            continue;
+        }
+
+        sf::Vector2f pen = position + sf::Vector2f{ x, y };
+        if (outlineThickness != 0.f) {
+            const sf::Glyph& outlineGlyph = font->getGlyph(curChar, characterSize, isBold, outlineThickness);
+            addGlyphQuad(outlineVertices, outlineBaseColors, pen, outlineColor, outlineGlyph);
+        }
+
+        const sf::Glyph& glyph = font->getGlyph(curChar, characterSize, isBold);
+        addGlyphQuad(fillVertices, fillBaseColors, pen, fillColor, glyph);
+        x += glyph.advance;
+    }
+}
+
+void GlyphBatch::setAlphaFactor(float alphaFactor) {
+    auto apply = [alphaFactor](sf::VertexArray& vertices, const std::vector<sf::Color>& baseColors) {
+        for (std::size_t i = 0; i < baseColors.size(); ++i) {
+            sf::Color color = baseColors[i];
+            color.a = static_cast<std::uint8_t>(static_cast<float>(color.a) * alphaFactor);
+            vertices[i].color = color;
+        }
+    };
+    apply(fillVertices, fillBaseColors);
+    apply(outlineVertices, outlineBaseColors);
+}
+
+void GlyphBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    if (fillVertices.getVertexCount() == 0 && outlineVertices.getVertexCount() == 0)
+        return;
+
+    // Fetched per draw: the page texture may have grown since the quads were built,
+    // but glyph texture rects are in pixels and stay valid.
+    states.texture = &font->getTexture(characterSize);
+    if (assets::usageTracer().enabled())
+        assets::usageTracer().noteFont(*font);
+    if (outlineVertices.getVertexCount() > 0)
+        target.draw(outlineVertices, states);
+    if (fillVertices.getVertexCount() > 0)
+        target.draw(fillVertices, states);
+}
@@ -0,0 +1,46 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>  // Provides std::size_t for the glyph page bytes.
+#include <vector>   // Keeps the untinted vertex colors so alpha can be re-applied.
+// === SFML Libraries ===
+#include <SFML/Graphics.hpp>  // Provides Font glyph lookups, VertexArray, and RenderTarget.
+
+// Collects the glyph quads of many differently colored strings that share one font and
+// character size, so a whole text block is submitted with a single draw call (plus one
+// for outlined glyphs). Quads are placed exactly like sf::Text would place them.
+class GlyphBatch {
+public:
+    GlyphBatch(const sf::Font& font, unsigned int characterSize);
+
+    // Appends the glyphs of text with the pen origin at position (same as sf::Text::setPosition).
+    void addText(
+        const sf::String& text,
+        sf::Vector2f position,
+        sf::Color fillColor,
+        float outlineThickness = 0.f,
+        sf::Color outlineColor = sf::Color::White
+    );
+
+    // Scales every vertex alpha by alphaFactor relative to the colors passed to addText.
+    void setAlphaFactor(float alphaFactor);
+
+    // Draws outlined glyphs first, then all fills, using the font page texture.
+    void draw(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default) const;
+
+    bool empty() const { return fillVertices.getVertexCount() == 0; }
+
+private:
+    void addGlyphQuad(sf::VertexArray& vertices, std::vector<sf::Color>& baseColors, sf::Vector2f position, sf::Color color, const sf::Glyph& glyph);
+
+    const sf::Font* font = nullptr;
+    unsigned int characterSize = 0;
+    sf::VertexArray fillVertices{ sf::PrimitiveType::Triangles };
+    sf::VertexArray outlineVertices{ sf::PrimitiveType::Triangles };
+    std::vector<sf::Color> fillBaseColors;
+    std::vector<sf::Color> outlineBaseColors;
+};
+
+// Estimated VRAM of the glyph pages of every (font, character size) a GlyphBatch was built for.
+// SFML cannot list a font's pages without creating them, so sizes only drawn through sf::Text
+// are not counted. pageCount receives the number of pages measured.
+std::size_t glyphPageBytes(std::size_t& pageCount);
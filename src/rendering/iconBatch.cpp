@@ -0,0 +1,49 @@
+// === C++ Libraries ===
+#include <algorithm>  // Finds the batch of a page and picks the fitting scale.
+#include <iterator>   // Points at a batch that was just appended.
+// === Header Files ===
+#include "rendering/iconBatch.hpp"       // Declares IconBatch implemented below.
+#include "resources/assetProfiler.hpp"  // Attributes the drawn size to the icon's source texture.
+
+void IconBatch::add(const assets::AtlasRegion& region, const sf::FloatRect& bounds, sf::Color color) {
+    if (!region.page || bounds.size.x <= 0.f || bounds.size.y <= 0.f)
+        return;
+    if (region.source && assets::profiler().enabled())
+        assets::profiler().noteDraw(*region.source, bounds.size);
+    auto batch = std::find_if(batches.begin(), batches.end(), [&](const auto& entry) {
+        return entry.first == region.page;
+    });
+    if (batch == batches.end()) {
+        batches.emplace_back(region.page, sf::VertexArray(sf::PrimitiveType::Triangles));
+        batch = std::prev(batches.end());
+    }
+
+    const sf::Vector2f p1 = bounds.position;
+    const sf::Vector2f p2 = bounds.position + bounds.size;
+    const sf::Vector2f uv1(region.rect.position);
+    const sf::Vector2f uv2(region.rect.position + region.rect.size);
+
+    sf::VertexArray& vertices = batch->second;
+    vertices.append({ { p1.x, p1.y }, color, { uv1.x, uv1.y } });
+    vertices.append({ { p2.x, p1.y }, color, { uv2.x, uv1.y } });
+    vertices.append({ { p1.x, p2.y }, color, { uv1.x, uv2.y } });
+    vertices.append({ { p1.x, p2.y }, color, { uv1.x, uv2.y } });
+    vertices.append({ { p2.x, p1.y }, color, { uv2.x, uv1.y } });
+    vertices.append({ { p2.x, p2.y }, color, { uv2.x, uv2.y } });
+}
+
+void IconBatch::addFitted(const assets::AtlasRegion& region, sf::Vector2f center, sf::Vector2f areaSize, sf::Color color) {
+    if (region.rect.size.x <= 0 || region.rect.size.y <= 0 || areaSize.x <= 0.f || areaSize.y <= 0.f)
+        return;
+    const sf::Vector2f regionSize(region.rect.size);
+    const float scale = std::min(areaSize.x / regionSize.x, areaSize.y / regionSize.y);
+    const sf::Vector2f size = regionSize * scale;
+    add(region, { center - (size * 0.5f), size }, color);
+}
+
+void IconBatch::draw(sf::RenderTarget& target, sf::RenderStates states) const {
+    for (const auto& [page, vertices] : batches) {
+        states.texture = page;
+        target.draw(vertices, states);
+    }
+}
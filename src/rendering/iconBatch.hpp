@@ -0,0 +1,27 @@
+#pragma once
+// === C++ Libraries ===
+#include <utility>  // Pairs each atlas page with its vertices.
+#include <vector>   // Stores one vertex array per atlas page.
+// === SFML Libraries ===
+#include <SFML/Graphics.hpp>  // Provides VertexArray, RenderTarget and the icon rects.
+// === Header Files ===
+#include "resources/textureAtlas.hpp"  // Declares the atlas regions the quads sample from.
+
+// Collects icon quads that sample from atlas pages (see resources/textureAtlas.hpp), so a
+// whole inventory grid or tab bar is submitted with one draw call per page - usually one.
+class IconBatch {
+public:
+    // Appends region stretched over bounds.
+    void add(const assets::AtlasRegion& region, const sf::FloatRect& bounds, sf::Color color = sf::Color::White);
+    // Appends region scaled to fit inside areaSize, centered on center (keeps the aspect ratio).
+    void addFitted(const assets::AtlasRegion& region, sf::Vector2f center, sf::Vector2f areaSize, sf::Color color = sf::Color::White);
+
+    // Draws every page's quads in the order the pages were first used.
+    void draw(sf::RenderTarget& target, sf::RenderStates states = sf::RenderStates::Default) const;
+
+    bool empty() const { return batches.empty(); }
+    void clear() { batches.clear(); }
+
+private:
+    std::vector<std::pair<const sf::Texture*, sf::VertexArray>> batches;
+};
@@ -1,29 +1,34 @@
 // === C++ Libraries ===
-#include <algorithm>  // Uses std::max/min when calculating wrap limits and advancing lines.
-#include <cctype>     // Applies std::isspace to group characters into words/spaces.
-#include <string>     // Holds segments, tokens, and intermediate substrings during drawing.
+#include <algorithm>      // Uses std::max/min when calculating wrap limits and advancing lines.
+#include <bit>            // Hashes the float parts of the cache key via std::bit_cast.
+#include <cctype>         // Applies std::isspace to group characters into words/spaces.
+#include <cstdint>        // Stores the cache's last-use counters.
+#include <functional>     // Hashes segment text and the font address.
+#include <optional>       // Lets cache entries hold a not-yet-built TextLayout.
+#include <string>         // Holds tokens, intermediate substrings, and the cache's owned segment copies.
+#include <string_view>    // Splits the segment views on newlines without copying.
+#include <utility>        // Pairs cached segment text with its color.
+#include <unordered_map>  // Keeps built layouts keyed by their input hash.
 // === Header Files ===
-#include "textLayout.hpp"  // Declares drawColoredSegments implemented below.
+#include "textLayout.hpp"  // Declares TextLayout and drawColoredSegments implemented below.
 #include "helper/colorHelper.hpp"  // Applies special outlines for dark-purple segments.
 
-// Handles word-wrapping and line breaks while drawing each colored segment.
-sf::Vector2f drawColoredSegments(
-    sf::RenderTarget& target,
+// Handles word-wrapping and line breaks once, recording each colored run relative to the origin.
+TextLayout::TextLayout(
     const sf::Font& font,
     const std::vector<ColoredTextSegment>& segments,
-    sf::Vector2f startPos,
     unsigned int characterSize,
     float maxWidth,
-    float alphaFactor,
-    float lineSpacingMultiplier,
-    bool measureOnly
-) {
+    float lineSpacingMultiplier
+)
+: glyphs(font, characterSize)
+{
     if (segments.empty())
-        return startPos;
+        return;
 
-    const float baseLineStartX = startPos.x;
+    const float baseLineStartX = 0.f;
     const float wrapLimit = baseLineStartX + std::max(0.f, maxWidth);
-    sf::Vector2f cursor = startPos;
+    sf::Vector2f cursor{ 0.f, 0.f };
     sf::Text metrics(font, sf::String(), characterSize);
     metrics.setString("Hg");
     float lineSpacing = metrics.getLineSpacing();
@@ -38,24 +43,24 @@ sf::Vector2f drawColoredSegments(
         // Split segments on explicit newline markers so we can advance lines manually.
         while (offset <= segment.text.size()) {
             std::size_t newlinePos = segment.text.find('\n', offset);
-            std::string part = (newlinePos == std::string::npos)
+            std::string_view part = (newlinePos == std::string_view::npos)
                 ? segment.text.substr(offset)
                 : segment.text.substr(offset, newlinePos - offset);
 
             if (!part.empty()) {
-                // Prepare an SFML text object tinted by the segment color and alpha factor.
+                // Prepare an SFML text object styled like the segment; alpha is applied in draw().
+                // The drawable is only used for measuring; glyphs go into the batch via emitRun.
                 sf::Text drawable(font, sf::String(), characterSize);
-                sf::Color drawableColor = segment.color;
-                drawableColor.a = static_cast<std::uint8_t>(static_cast<float>(drawableColor.a) * alphaFactor);
-                drawable.setFillColor(drawableColor);
-                if (segment.color == ColorHelper::Palette::DarkPurple) {
-                    sf::Color outlineColor = sf::Color::White;
-                    outlineColor.a = drawableColor.a;
-                    drawable.setOutlineColor(outlineColor);
-                    drawable.setOutlineThickness(2.f);
-                } else {
-                    drawable.setOutlineThickness(0.f);
-                }
+                sf::Color outlineColor = sf::Color::White;
+                outlineColor.a = segment.color.a;
+                const float outlineThickness = (segment.color == ColorHelper::Palette::DarkPurple) ? 2.f : 0.f;
+                drawable.setFillColor(segment.color);
+                drawable.setOutlineColor(outlineColor);
+                drawable.setOutlineThickness(outlineThickness);
+                // Appends the drawable's current string at its current position to the glyph batch.
+                auto emitRun = [&]() {
+                    glyphs.addText(drawable.getString(), drawable.getPosition(), segment.color, outlineThickness, outlineColor);
+                };
 
                 std::size_t partIndex = 0;
                 // Group the substring into runs of spaces or words for proper wrapping.
@@ -95,8 +100,7 @@ sf::Vector2f drawColoredSegments(
 
                         // Draw the space and advance the cursor.
                         drawable.setPosition(cursor);
-                        if (!measureOnly)
-                            target.draw(drawable);
+                        emitRun();
                         cursor.x += tokenWidth;
                     } else {
                         // Handles long words that need to split across multiple lines.
@@ -121,8 +125,7 @@ sf::Vector2f drawColoredSegments(
                                 if (chunkWidth > availableWidth && !currentChunk.empty()) {
                                     drawable.setString(currentChunk);
                                     drawable.setPosition(cursor);
-                                    if (!measureOnly)
-                                        target.draw(drawable);
+                                    emitRun();
                                     cursor.x += drawable.getLocalBounds().size.x;
                                     cursor.x = baseLineStartX;
                                     cursor.y += lineAdvance;
@@ -134,8 +137,7 @@ sf::Vector2f drawColoredSegments(
                                 // Draw single oversized glyphs on their own line when needed.
                                 if (cursor.x + chunkWidth > wrapLimit && currentChunk.empty()) {
                                 drawable.setPosition(cursor);
-                                if (!measureOnly)
-                                    target.draw(drawable);
+                                emitRun();
                                 cursor.x += chunkWidth;
                                 continue;
                             }
@@ -147,8 +149,7 @@ sf::Vector2f drawColoredSegments(
                             if (!currentChunk.empty()) {
                                 drawable.setString(currentChunk);
                                 drawable.setPosition(cursor);
-                                if (!measureOnly)
-                                    target.draw(drawable);
+                                emitRun();
                                 cursor.x += drawable.getLocalBounds().size.x;
                             }
                         };
@@ -168,16 +169,14 @@ sf::Vector2f drawColoredSegments(
                         // Standard branch: fits on current line.
                         if (tokenWidth <= availableWidth) {
                             drawable.setPosition(cursor);
-                            if (!measureOnly)
-                                target.draw(drawable);
+                            emitRun();
                             cursor.x += tokenWidth;
                         // Word fits on its own line after we wrap down.
                         } else if (tokenWidth <= maxWidth) {
                             cursor.x = baseLineStartX;
                             cursor.y += lineAdvance;
                             drawable.setPosition(cursor);
-                            if (!measureOnly)
-                                target.draw(drawable);
+                            emitRun();
                             cursor.x += tokenWidth;
                         // Word is too long even for an empty line; split it.
                         } else {
@@ -198,5 +197,122 @@ sf::Vector2f drawColoredSegments(
         }
     }
 
-    return cursor;
+    cursorEnd = cursor;
+}
+
+// Re-tints the cached glyphs only when the alpha changed, then submits them at the origin.
+void TextLayout::draw(sf::RenderTarget& target, sf::Vector2f origin, float alphaFactor) {
+    if (alphaFactor != appliedAlpha) {
+        glyphs.setAlphaFactor(alphaFactor);
+        appliedAlpha = alphaFactor;
+    }
+
+    sf::RenderStates states;
+    states.transform.translate(origin);
+    glyphs.draw(target, states);
+}
+
+namespace {
+constexpr std::size_t kMaxCachedLayouts = 256;  // Typewriter lines create one entry per revealed character.
+
+struct LayoutCacheEntry {
+    const sf::Font* font = nullptr;
+    unsigned int characterSize = 0;
+    float maxWidth = 0.f;
+    float lineSpacingMultiplier = 0.f;
+    std::vector<std::pair<std::string, sf::Color>> segments;  // Owned copy: input segments are views.
+    std::optional<TextLayout> layout;
+    std::uint64_t lastUse = 0;
+};
+
+void hashCombine(std::size_t& seed, std::size_t value) {
+    seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+}
+
+std::size_t hashLayoutKey(
+    const sf::Font& font,
+    const std::vector<ColoredTextSegment>& segments,
+    unsigned int characterSize,
+    float maxWidth,
+    float lineSpacingMultiplier
+) {
+    std::size_t seed = std::hash<const void*>{}(&font);
+    hashCombine(seed, characterSize);
+    hashCombine(seed, std::bit_cast<std::uint32_t>(maxWidth));
+    hashCombine(seed, std::bit_cast<std::uint32_t>(lineSpacingMultiplier));
+    for (const auto& segment : segments) {
+        hashCombine(seed, std::hash<std::string_view>{}(segment.text));
+        hashCombine(seed, segment.color.toInteger());
+    }
+    return seed;
+}
+
+bool sameSegments(const std::vector<std::pair<std::string, sf::Color>>& stored, const std::vector<ColoredTextSegment>& segments) {
+    return std::equal(stored.begin(), stored.end(), segments.begin(), segments.end(), [](const auto& a, const auto& b) {
+        return a.second == b.color && a.first == b.text;
+    });
+}
+} // namespace
+
+TextLayout& cachedTextLayout(
+    const sf::Font& font,
+    const std::vector<ColoredTextSegment>& segments,
+    unsigned int characterSize,
+    float maxWidth,
+    float lineSpacingMultiplier
+) {
+    static std::unordered_map<std::size_t, LayoutCacheEntry> cache;
+    static std::uint64_t useCounter = 0;
+    ++useCounter;
+
+    std::size_t key = hashLayoutKey(font, segments, characterSize, maxWidth, lineSpacingMultiplier);
+    auto found = cache.find(key);
+    if (found == cache.end() && cache.size() >= kMaxCachedLayouts) {
+        // Drop everything that was not touched during the last kMaxCachedLayouts lookups.
+        std::erase_if(cache, [](const auto& item) {
+            return item.second.lastUse + kMaxCachedLayouts < useCounter;
+        });
+    }
+
+    LayoutCacheEntry& entry = (found != cache.end()) ? found->second : cache[key];
+    bool matches = entry.layout
+        && entry.font == &font
+        && entry.characterSize == characterSize
+        && entry.maxWidth == maxWidth
+        && entry.lineSpacingMultiplier == lineSpacingMultiplier
+        && sameSegments(entry.segments, segments);
+    if (!matches) {
+        // New key, or a hash collision: (re)build the layout in place.
+        entry.font = &font;
+        entry.characterSize = characterSize;
+        entry.maxWidth = maxWidth;
+        entry.lineSpacingMultiplier = lineSpacingMultiplier;
+        entry.segments.clear();
+        for (const auto& segment : segments)
+            entry.segments.emplace_back(std::string(segment.text), segment.color);
+        entry.layout.emplace(font, segments, characterSize, maxWidth, lineSpacingMultiplier);
+    }
+    entry.lastUse = useCounter;
+    return *entry.layout;
+}
+
+// Looks up (or builds) the cached layout and submits it at startPos unless only measuring.
+sf::Vector2f drawColoredSegments(
+    sf::RenderTarget& target,
+    const sf::Font& font,
+    const std::vector<ColoredTextSegment>& segments,
+    sf::Vector2f startPos,
+    unsigned int characterSize,
+    float maxWidth,
+    float alphaFactor,
+    float lineSpacingMultiplier,
+    bool measureOnly
+) {
+    if (segments.empty())
+        return startPos;
+
+    TextLayout& layout = cachedTextLayout(font, segments, characterSize, maxWidth, lineSpacingMultiplier);
+    if (!measureOnly)
+        layout.draw(target, startPos, alphaFactor);
+    return startPos + layout.endCursor();
 }
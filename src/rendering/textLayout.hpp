@@ -1,12 +1,48 @@
 #pragma once
 // === C++ Libraries ===
-#include <vector>                 // Stores the list of ColoredTextSegment inputs to draw.
+#include <vector>                 // Stores the list of ColoredTextSegment inputs to lay out.
 // === SFML Libraries ===
 #include <SFML/Graphics.hpp>      // Provides the font, RenderTarget, Text, and Color helpers for drawing.
 // === Header Files ===
 #include "helper/textColorHelper.hpp"  // Defines ColoredTextSegment used by drawColoredSegments.
+#include "rendering/glyphBatch.hpp"    // Holds the laid-out glyph quads submitted in one draw call.
+
+// Word-wrapped colored text computed once for (segments, font, size, width, spacing).
+// Glyph quads are stored relative to the layout origin so the same layout can be
+// drawn anywhere (one draw call, two with outlined runs) and measured for free.
+class TextLayout {
+public:
+    TextLayout(
+        const sf::Font& font,
+        const std::vector<ColoredTextSegment>& segments,
+        unsigned int characterSize,
+        float maxWidth,
+        float lineSpacingMultiplier
+    );
+
+    // Submits the cached glyphs with their top-left corner at origin.
+    void draw(sf::RenderTarget& target, sf::Vector2f origin, float alphaFactor = 1.f);
+
+    // Cursor after the last glyph, relative to the layout origin.
+    sf::Vector2f endCursor() const { return cursorEnd; }
+
+private:
+    GlyphBatch glyphs;
+    sf::Vector2f cursorEnd{};
+    float appliedAlpha = 1.f;
+};
+
+// Returns the cached layout for these inputs, building it on first use.
+TextLayout& cachedTextLayout(
+    const sf::Font& font,
+    const std::vector<ColoredTextSegment>& segments,
+    unsigned int characterSize,
+    float maxWidth,
+    float lineSpacingMultiplier
+);
 
 // Draws colored text segments with wrapping/alpha handling and returns the new cursor.
+// Backed by cachedTextLayout, so repeated calls (and measureOnly passes) skip the wrapping work.
 sf::Vector2f drawColoredSegments(
     sf::RenderTarget& target,
     const sf::Font& font,
@@ -0,0 +1,96 @@
+// === C++ Libraries ===
+#include <algorithm>     // Sorts the loose directory listing.
+#include <filesystem>    // Checks and lists loose files when the pack does not have them.
+#include <fstream>       // Reads loose files into memory for readAssetBytes.
+#include <string_view>   // Passes shader sources without copying.
+#include <system_error>  // Keeps the filesystem checks non-throwing.
+// === Header Files ===
+#include "resources/assetFiles.hpp"  // Declares the loaders implemented below.
+#include "resources/assetPack.hpp"   // Looks paths up in the mounted pack.
+#include "resources/assetUsage.hpp"  // Records every opened file for --trace-asset-usage.
+#include "resources/qoiImage.hpp"    // Decodes baked QOI art as well as PNG/JPEG.
+
+namespace assets {
+namespace {
+void noteOpened(const std::string& path) {
+    if (usageTracer().enabled())
+        usageTracer().noteFileOpened(path);
+}
+} // namespace
+
+bool readAssetBytes(const std::string& path, AssetBytes& bytes) {
+    noteOpened(path);
+    if (auto blob = mountedPack().find(path)) {
+        bytes.storage.clear();
+        bytes.view = *blob;
+        return true;
+    }
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return false;
+    bytes.storage.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(bytes.storage.data()), static_cast<std::streamsize>(bytes.storage.size())))
+        return false;
+    bytes.view = bytes.storage;
+    return true;
+}
+
+bool loadImage(sf::Image& image, const std::string& path) {
+    AssetBytes bytes;
+    return readAssetBytes(path, bytes) && decodeImage(bytes.view, image);
+}
+
+bool loadTexture(sf::Texture& texture, const std::string& path) {
+    sf::Image image;
+    return loadImage(image, path) && texture.loadFromImage(image);
+}
+
+bool loadSoundBuffer(sf::SoundBuffer& buffer, const std::string& path) {
+    noteOpened(path);
+    if (auto blob = mountedPack().find(path))
+        return buffer.loadFromMemory(blob->data(), blob->size());
+    return buffer.loadFromFile(path);
+}
+
+bool openFont(sf::Font& font, const std::string& path) {
+    noteOpened(path);
+    if (auto blob = mountedPack().find(path))
+        return font.openFromMemory(blob->data(), blob->size());
+    return font.openFromFile(path);
+}
+
+bool openMusic(sf::Music& music, const std::string& path) {
+    noteOpened(path);
+    if (auto blob = mountedPack().find(path))
+        return music.openFromMemory(blob->data(), blob->size());
+    return music.openFromFile(path);
+}
+
+bool loadShader(sf::Shader& shader, const std::string& path, sf::Shader::Type type) {
+    noteOpened(path);
+    if (auto blob = mountedPack().find(path))
+        return shader.loadFromMemory(std::string_view(reinterpret_cast<const char*>(blob->data()), blob->size()), type);
+    return shader.loadFromFile(path, type);
+}
+
+bool assetExists(const std::string& path) {
+    std::error_code error;
+    return mountedPack().contains(path) || std::filesystem::exists(path, error);
+}
+
+std::vector<std::string> listAssetFiles(const std::string& directory) {
+    std::vector<std::string> files = mountedPack().list(directory);
+    if (!files.empty())
+        return files;
+
+    std::error_code error;
+    for (const auto& entry : std::filesystem::directory_iterator(directory, error)) {
+        if (entry.is_regular_file(error))
+            files.push_back(entry.path().generic_string());
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+} // namespace assets
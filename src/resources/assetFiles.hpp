@@ -0,0 +1,40 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>  // Provides std::byte for raw file contents.
+#include <span>     // Views file bytes without copying them out of the pack.
+#include <string>   // Takes asset paths as the game spells them ("assets/...").
+#include <vector>   // Returns directory listings and holds loose file contents.
+// === SFML Libraries ===
+#include <SFML/Audio/Music.hpp>        // Streams music straight from the mapped pack.
+#include <SFML/Audio/SoundBuffer.hpp>  // Decodes sound effects.
+#include <SFML/Graphics/Font.hpp>      // Opens fonts that keep reading from their source bytes.
+#include <SFML/Graphics/Image.hpp>     // Decodes images on the CPU.
+#include <SFML/Graphics/Shader.hpp>    // Compiles shader sources.
+#include <SFML/Graphics/Texture.hpp>   // Uploads images that need no CPU-side processing.
+
+// Every loader reads from the mounted .gpak when it holds the path (zero-copy views into the
+// mapping) and falls back to the loose file under assets/ otherwise, so development builds
+// work without a pack. Fonts and music keep pointing into the mapping while they are open.
+// Images may be PNG/JPEG or baked QOI (see resources/qoiImage.hpp), whatever the extension.
+namespace assets {
+
+// Raw file contents: a zero-copy view into the mounted pack, or the loose file read into storage.
+struct AssetBytes {
+    std::vector<std::byte> storage;
+    std::span<const std::byte> view;
+};
+
+bool readAssetBytes(const std::string& path, AssetBytes& bytes);
+bool loadImage(sf::Image& image, const std::string& path);
+bool loadTexture(sf::Texture& texture, const std::string& path);
+bool loadSoundBuffer(sf::SoundBuffer& buffer, const std::string& path);
+bool openFont(sf::Font& font, const std::string& path);
+bool openMusic(sf::Music& music, const std::string& path);
+bool loadShader(sf::Shader& shader, const std::string& path, sf::Shader::Type type);
+
+// True if the pack or the loose tree has the file.
+bool assetExists(const std::string& path);
+// Paths of the files directly inside directory, from the pack if it has any, sorted.
+std::vector<std::string> listAssetFiles(const std::string& directory);
+
+} // namespace assets
@@ -0,0 +1,206 @@
+// === C++ Libraries ===
+#include <algorithm>  // Uses std::max when resolving the worker count.
+#include <cstdint>    // Sizes the decoded sound samples.
+#include <iostream>   // Reports every asset that failed to load once the pool finished.
+#include <thread>     // Spawns the decode workers and queries hardware_concurrency.
+#include <utility>    // Moves paths and labels into the job list.
+// === SFML Libraries ===
+#include <SFML/System/Clock.hpp>  // Times every load step for the asset profiler and the content store.
+// === Header Files ===
+#include "resources/assetLoader.hpp"  // Declares ParallelLoader implemented below.
+#include "resources/assetFiles.hpp"   // Reads each file from the asset pack or the loose tree.
+#include "resources/contentStore.hpp" // Shares one decode between files with identical bytes.
+#include "resources/qoiImage.hpp"     // Decodes baked QOI art as well as PNG/JPEG.
+#include "resources/textureLod.hpp"   // Filters and keeps the downscaled levels of lod textures.
+
+namespace assets {
+namespace {
+double elapsedMs(const sf::Clock& clock) {
+    return static_cast<double>(clock.getElapsedTime().asMicroseconds()) / 1000.0;
+}
+} // namespace
+
+unsigned int resolveThreadCount(unsigned int requested) {
+    if (requested > 0)
+        return requested;
+    unsigned int hardware = std::thread::hardware_concurrency();
+    // Leave one core for the main thread, which is busy uploading and drawing the loading screen.
+    return std::max(1u, hardware > 1 ? hardware - 1 : 1u);
+}
+
+ParallelLoader::ParallelLoader(unsigned int threadCount)
+: threads(resolveThreadCount(threadCount))
+, maxDecodedInFlight(static_cast<std::size_t>(threads) * 2)
+{}
+
+void ParallelLoader::addTexture(sf::Texture& target, std::string path, std::string label, OpaqueBounds* bounds,
+                                const sf::Texture** shared, bool buildLods) {
+    Job job;
+    job.kind = JobKind::Texture;
+    job.texture = &target;
+    job.bounds = bounds;
+    job.sharedTexture = shared;
+    job.buildLods = buildLods;
+    job.path = std::move(path);
+    job.label = std::move(label);
+    jobs.push_back(std::move(job));
+}
+
+void ParallelLoader::addSound(sf::SoundBuffer& target, std::string path, std::string label, const sf::SoundBuffer** shared) {
+    Job job;
+    job.kind = JobKind::Sound;
+    job.sound = &target;
+    job.sharedSound = shared;
+    job.path = std::move(path);
+    job.label = std::move(label);
+    jobs.push_back(std::move(job));
+}
+
+bool ParallelLoader::shareIdentical(Job& job, std::span<const std::byte> bytes) {
+    if (job.kind == JobKind::Texture && job.sharedTexture) {
+        const sf::Texture* original = contentStore().claim(contentKey(bytes, ContentVariant::Texture), job.path, job.texture);
+        if (original == job.texture)
+            return false;
+        *job.sharedTexture = original;
+        return true;
+    }
+    if (job.kind == JobKind::Sound && job.sharedSound) {
+        const sf::SoundBuffer* original = contentStore().claim(contentKey(bytes, ContentVariant::Sound), job.path, job.sound);
+        if (original == job.sound)
+            return false;
+        *job.sharedSound = original;
+        return true;
+    }
+    return false;
+}
+
+// Pulls jobs in registration order and decodes them; texture jobs wait for a free upload slot first.
+void ParallelLoader::workerLoop() {
+    while (true) {
+        std::size_t index = 0;
+        {
+            std::unique_lock lock(mutex);
+            if (nextJob >= jobs.size())
+                return;
+            index = nextJob++;
+            if (jobs[index].kind == JobKind::Texture) {
+                slotFreed.wait(lock, [this]() { return decodedInFlight < maxDecodedInFlight; });
+                ++decodedInFlight;
+            }
+        }
+
+        Job& job = jobs[index];
+        // Hashing touches every byte, so it is timed with the read like the page faults it causes.
+        sf::Clock clock;
+        AssetBytes bytes;
+        job.ok = readAssetBytes(job.path, bytes);
+        job.report.fileBytes = bytes.view.size();
+        job.shared = job.ok && shareIdentical(job, bytes.view);
+        job.report.readMs = elapsedMs(clock);
+
+        if (job.ok && !job.shared) {
+            clock.restart();
+            if (job.kind == JobKind::Texture) {
+                job.ok = decodeImage(bytes.view, job.image);
+                // Each job owns a distinct bounds slot, so workers can write them without locking.
+                if (job.ok && job.bounds)
+                    *job.bounds = computeOpaqueBounds(job.image);
+                if (job.ok && job.buildLods)
+                    job.lodImages = buildLodImages(job.image);
+            } else {
+                job.ok = job.sound->loadFromMemory(bytes.view.data(), bytes.view.size());
+                job.report.decodedBytes = static_cast<std::size_t>(job.sound->getSampleCount()) * sizeof(std::int16_t);
+            }
+            job.report.decodeMs = elapsedMs(clock);
+        }
+
+        {
+            std::lock_guard lock(mutex);
+            readyJobs.push_back(index);
+        }
+        readyChanged.notify_one();
+    }
+}
+
+bool ParallelLoader::run(const ProgressCallback& onProgress) {
+    nextJob = 0;
+    decodedInFlight = 0;
+    readyJobs.clear();
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (unsigned int i = 0; i < threads; ++i)
+        workers.emplace_back([this]() { workerLoop(); });
+
+    LoadProgress progress;
+    progress.total = jobs.size();
+    for (std::size_t done = 0; done < jobs.size(); ++done) {
+        std::size_t index = 0;
+        {
+            std::unique_lock lock(mutex);
+            readyChanged.wait(lock, [this]() { return !readyJobs.empty(); });
+            index = readyJobs.front();
+            readyJobs.pop_front();
+        }
+
+        Job& job = jobs[index];
+        if (job.kind == JobKind::Texture) {
+            // Upload on this thread: it owns the window's GL context.
+            if (job.ok && !job.shared) {
+                sf::Clock uploadClock;
+                job.ok = job.texture->loadFromImage(job.image);
+                if (job.ok)
+                    textureLods().add(*job.texture, job.lodImages);
+                job.report.uploadMs = elapsedMs(uploadClock);
+            }
+            job.report.dimensions = job.image.getSize();
+            job.image = sf::Image();
+            job.lodImages.clear();
+            {
+                std::lock_guard lock(mutex);
+                --decodedInFlight;
+            }
+            slotFreed.notify_one();
+        }
+
+        if (job.ok && !job.shared) {
+            const void* object = job.kind == JobKind::Texture ? static_cast<const void*>(job.texture) : job.sound;
+            const std::size_t bytes = job.kind == JobKind::Texture
+                ? static_cast<std::size_t>(job.report.dimensions.x) * job.report.dimensions.y * 4
+                : job.report.decodedBytes;
+            contentStore().recordCost(object, job.report.decodeMs + job.report.uploadMs, bytes);
+        }
+
+        if (job.ok && !job.shared && profiler().enabled()) {
+            job.report.path = job.path;
+            job.report.label = job.label;
+            if (job.kind == JobKind::Texture) {
+                job.report.kind = "texture";
+                job.report.decodedBytes = static_cast<std::size_t>(job.report.dimensions.x) * job.report.dimensions.y * 4;
+                profiler().record(std::move(job.report), job.texture);
+            } else {
+                job.report.kind = "sound";
+                profiler().record(std::move(job.report));
+            }
+        }
+
+        progress.completed = done + 1;
+        progress.currentAsset = job.label;
+        if (onProgress)
+            onProgress(progress);
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    bool allLoaded = true;
+    for (const auto& job : jobs) {
+        if (job.ok)
+            continue;
+        std::cout << "Failed to load " << job.label << "\n";
+        allLoaded = false;
+    }
+    return allLoaded;
+}
+
+} // namespace assets
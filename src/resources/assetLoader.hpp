@@ -0,0 +1,92 @@
+#pragma once
+// === C++ Libraries ===
+#include <condition_variable>  // Wakes the uploader/decoder threads when work changes hands.
+#include <cstddef>             // Provides std::size_t for job indexes and counters.
+#include <deque>               // Queues decoded jobs waiting for their GPU upload.
+#include <functional>          // Stores the progress callback invoked between uploads.
+#include <mutex>               // Guards the ready queue shared with the worker threads.
+#include <span>                // Passes the file bytes to the content store.
+#include <string>              // Holds asset paths and human-readable labels.
+#include <vector>              // Stores the registered jobs.
+// === SFML Libraries ===
+#include <SFML/Audio/SoundBuffer.hpp>  // Audio jobs decode straight into their target buffer.
+#include <SFML/Graphics/Image.hpp>     // Image jobs decode into a CPU-side sf::Image first.
+#include <SFML/Graphics/Texture.hpp>   // Decoded images are uploaded into sf::Texture targets.
+// === Header Files ===
+#include "resources/assetProfiler.hpp"  // Jobs fill a load record while --asset-report is active.
+#include "resources/opaqueBounds.hpp"   // Texture jobs can measure their opaque bounds on the worker.
+
+namespace assets {
+
+// Snapshot handed to the loading screen after each finished asset.
+struct LoadProgress {
+    std::size_t completed = 0;
+    std::size_t total = 0;
+    std::string currentAsset;
+};
+
+using ProgressCallback = std::function<void(const LoadProgress&)>;
+
+// Returns the worker count to use; 0 picks one less than the hardware threads (at least 1).
+unsigned int resolveThreadCount(unsigned int requested);
+
+// Decodes textures and sound buffers on a pool of worker threads. GPU uploads and
+// progress callbacks stay on the thread that calls run(), which must own the GL context.
+class ParallelLoader {
+public:
+    explicit ParallelLoader(unsigned int threadCount);
+
+    // When bounds is set, the worker also fills it from the decoded image before the upload.
+    // When shared is set, the file is claimed in contentStore() first; if another file with the
+    // same bytes got there earlier, target stays empty and *shared points at that object instead.
+    // With buildLods the worker also filters the downscaled levels, uploaded into textureLods().
+    void addTexture(sf::Texture& target, std::string path, std::string label, OpaqueBounds* bounds = nullptr,
+                    const sf::Texture** shared = nullptr, bool buildLods = false);
+    void addSound(sf::SoundBuffer& target, std::string path, std::string label, const sf::SoundBuffer** shared = nullptr);
+
+    // Runs every registered job and returns false if any of them failed.
+    bool run(const ProgressCallback& onProgress = {});
+
+    std::size_t jobCount() const noexcept { return jobs.size(); }
+    unsigned int threadCount() const noexcept { return threads; }
+
+private:
+    enum class JobKind {
+        Texture,
+        Sound
+    };
+
+    struct Job {
+        JobKind kind = JobKind::Texture;
+        sf::Texture* texture = nullptr;
+        sf::SoundBuffer* sound = nullptr;
+        OpaqueBounds* bounds = nullptr;
+        const sf::Texture** sharedTexture = nullptr;
+        const sf::SoundBuffer** sharedSound = nullptr;
+        std::string path;
+        std::string label;
+        sf::Image image;     // Decoded pixels waiting for upload (texture jobs only).
+        std::vector<sf::Image> lodImages;  // Downscaled levels of image when buildLods is set.
+        AssetLoadRecord report;  // Timings for the asset profiler; only recorded while it is on.
+        bool ok = false;
+        bool buildLods = false;
+        bool shared = false;  // Resolved to an identical file claimed earlier; nothing to decode.
+    };
+
+    void workerLoop();
+    // Claims the job's bytes in contentStore(); returns true if another object already holds them.
+    static bool shareIdentical(Job& job, std::span<const std::byte> bytes);
+
+    std::vector<Job> jobs;
+    unsigned int threads = 1;
+    std::size_t maxDecodedInFlight = 2;   // Caps decoded images so RAM does not balloon ahead of the uploads.
+
+    std::mutex mutex;
+    std::condition_variable readyChanged;
+    std::condition_variable slotFreed;
+    std::deque<std::size_t> readyJobs;
+    std::size_t nextJob = 0;
+    std::size_t decodedInFlight = 0;
+};
+
+} // namespace assets
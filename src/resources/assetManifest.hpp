@@ -0,0 +1,84 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>      // Provides std::size_t for the table indexes.
+#include <iterator>     // Checks the generated rows against the id counts.
+#include <optional>     // Reports inventory keys no texture claims.
+#include <string_view>  // Compares inventory keys without allocating.
+// === Header Files ===
+#include "resources/assetIds.hpp"  // Generated from assets.manifest: TextureId, SoundId, AssetGroup.
+
+// Compile-time view of src/resources/assets.manifest. The rows are generated in enum order
+// (see scripts/generate_asset_ids.cmake), so every lookup is a plain array index.
+namespace assets {
+
+struct TextureManifestEntry {
+    const char* path;
+    const char* label;
+    AssetGroup group;
+    bool cached;       // Registered with TextureCache (decoded on first use) instead of loaded by loadAll.
+    bool trimMargins;  // Cached textures only: cut the transparent border at load time.
+    bool atlas;        // Copied onto Resources::iconAtlas after loading.
+    bool lod;          // loadAll builds downscaled levels for assets::lodSprite.
+    const char* itemKey;  // Inventory key that resolves to this texture, or nullptr.
+};
+
+struct SoundManifestEntry {
+    const char* path;
+    const char* label;
+    AssetGroup group;
+};
+
+inline constexpr TextureManifestEntry kTextureManifest[] = {
+#include "resources/textureManifest.inc"
+};
+
+inline constexpr SoundManifestEntry kSoundManifest[] = {
+#include "resources/soundManifest.inc"
+};
+
+static_assert(std::size(kTextureManifest) == kTextureCount, "textureManifest.inc is out of date");
+static_assert(std::size(kSoundManifest) == kSoundCount, "soundManifest.inc is out of date");
+
+constexpr std::size_t indexOf(TextureId id) { return static_cast<std::size_t>(id); }
+constexpr std::size_t indexOf(SoundId id) { return static_cast<std::size_t>(id); }
+
+constexpr const TextureManifestEntry& manifestEntry(TextureId id) { return kTextureManifest[indexOf(id)]; }
+constexpr const SoundManifestEntry& manifestEntry(SoundId id) { return kSoundManifest[indexOf(id)]; }
+
+constexpr const char* groupName(AssetGroup group) { return kAssetGroupNames[static_cast<std::size_t>(group)]; }
+
+// Groups used by a single phase of a run. Resources::loadAll leaves them out; scenes hold them
+// through Resources::acquire/release (see GroupLease) while they run.
+constexpr bool isSceneGroup(AssetGroup group) {
+    switch (group) {
+        case AssetGroup::Battle:
+        case AssetGroup::Credits:
+        case AssetGroup::Map:
+        case AssetGroup::Quiz:
+        case AssetGroup::Intro:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Scene textures have to be evictable, so they must be cached rows.
+constexpr bool sceneTexturesAreCached() {
+    for (const auto& entry : kTextureManifest) {
+        if (isSceneGroup(entry.group) && !entry.cached)
+            return false;
+    }
+    return true;
+}
+static_assert(sceneTexturesAreCached(), "assets.manifest: textures of a scene group must be cached rows");
+
+// Texture whose manifest row carries item=key.
+constexpr std::optional<TextureId> textureForItemKey(std::string_view key) {
+    for (std::size_t i = 0; i < kTextureCount; ++i) {
+        if (kTextureManifest[i].itemKey && key == kTextureManifest[i].itemKey)
+            return static_cast<TextureId>(i);
+    }
+    return std::nullopt;
+}
+
+} // namespace assets
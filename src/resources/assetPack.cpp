@@ -0,0 +1,170 @@
+// === C++ Libraries ===
+#include <algorithm>  // Binary-searches the sorted table of contents.
+#include <cstring>    // Compares the magic bytes.
+#include <iostream>   // Reports packs that could not be mapped.
+// === Platform Libraries ===
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>  // CreateFileMapping/MapViewOfFile.
+#else
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap/munmap
+#include <sys/stat.h>  // fstat for the file size.
+#include <unistd.h>    // close
+#endif
+// === Header Files ===
+#include "resources/assetPack.hpp"  // Declares AssetPack implemented below.
+
+namespace assets {
+
+std::uint64_t hashAssetPath(std::string_view path) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (char c : path) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+AssetPack::~AssetPack() {
+    close();
+}
+
+bool AssetPack::open(const std::string& path) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+    LARGE_INTEGER fileSize{};
+    HANDLE mapping = nullptr;
+    if (GetFileSizeEx(file, &fileSize) && fileSize.QuadPart > 0)
+        mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        std::cout << "Failed to map " << path << "\n";
+        return false;
+    }
+    fileHandle = file;
+    mappingHandle = mapping;
+    data = static_cast<const std::byte*>(view);
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat info {};
+    void* view = MAP_FAILED;
+    if (fstat(fd, &info) == 0 && info.st_size > 0)
+        view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // The mapping keeps the file alive.
+    if (view == MAP_FAILED) {
+        std::cout << "Failed to map " << path << "\n";
+        return false;
+    }
+    data = static_cast<const std::byte*>(view);
+    size = static_cast<std::size_t>(info.st_size);
+#endif
+
+    PackHeader header{};
+    bool valid = size >= sizeof(PackHeader);
+    if (valid) {
+        std::memcpy(&header, data, sizeof(header));
+        valid = std::memcmp(header.magic, kPackMagic, sizeof(kPackMagic)) == 0
+            && header.version == kPackVersion
+            && header.entryCount <= (size - sizeof(PackHeader)) / sizeof(PackEntry);
+    }
+    if (valid) {
+        entries = { reinterpret_cast<const PackEntry*>(data + sizeof(PackHeader)), header.entryCount };
+        valid = std::is_sorted(entries.begin(), entries.end(), [](const PackEntry& a, const PackEntry& b) {
+            return a.pathHash < b.pathHash;
+        });
+        for (const PackEntry& entry : entries) {
+            if (!valid)
+                break;
+            valid = entry.offset <= size && entry.size <= size - entry.offset
+                && entry.pathOffset <= size && entry.pathLength <= size - entry.pathOffset;
+        }
+    }
+    if (!valid) {
+        std::cout << "Failed to load " << path << " (not a version " << kPackVersion << " pack)\n";
+        close();
+        return false;
+    }
+    return true;
+}
+
+void AssetPack::close() {
+    if (!data)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+    CloseHandle(static_cast<HANDLE>(mappingHandle));
+    CloseHandle(static_cast<HANDLE>(fileHandle));
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+#else
+    munmap(const_cast<std::byte*>(data), size);
+#endif
+    data = nullptr;
+    size = 0;
+    entries = {};
+}
+
+std::string_view AssetPack::pathOf(const PackEntry& entry) const {
+    return { reinterpret_cast<const char*>(data + entry.pathOffset), entry.pathLength };
+}
+
+std::optional<std::span<const std::byte>> AssetPack::find(std::string_view path) const {
+    if (!data)
+        return std::nullopt;
+    std::uint64_t hash = hashAssetPath(path);
+    auto it = std::lower_bound(entries.begin(), entries.end(), hash, [](const PackEntry& entry, std::uint64_t value) {
+        return entry.pathHash < value;
+    });
+    // Equal hashes are adjacent; the stored path settles collisions.
+    for (; it != entries.end() && it->pathHash == hash; ++it) {
+        if (pathOf(*it) == path)
+            return std::span<const std::byte>(data + it->offset, static_cast<std::size_t>(it->size));
+    }
+    return std::nullopt;
+}
+
+std::vector<std::string> AssetPack::list(std::string_view directory) const {
+    std::vector<std::string> files;
+    for (const PackEntry& entry : entries) {
+        std::string_view path = pathOf(entry);
+        if (path.size() <= directory.size() + 1 || !path.starts_with(directory) || path[directory.size()] != '/')
+            continue;
+        if (path.find('/', directory.size() + 1) != std::string_view::npos)
+            continue;
+        files.emplace_back(path);
+    }
+    std::sort(files.begin(), files.end());
+    return files;
+}
+
+AssetPack& mountedPack() {
+    static AssetPack pack;
+    return pack;
+}
+
+bool mountPack(const std::string& path) {
+    if (!mountedPack().open(path)) {
+        std::cout << "No asset pack at " << path << ", loading loose files\n";
+        return false;
+    }
+    std::cout << "Mounted " << path << " (" << mountedPack().fileCount() << " files)\n";
+    return true;
+}
+
+} // namespace assets
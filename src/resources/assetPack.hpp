@@ -0,0 +1,82 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>      // Provides std::byte and std::size_t for the mapped views.
+#include <cstdint>      // Fixes the width of every on-disk field.
+#include <optional>     // Reports files the pack does not contain.
+#include <span>         // Hands out zero-copy views into the mapping.
+#include <string>       // Holds the pack path and listed file names.
+#include <string_view>  // Looks files up without allocating.
+#include <vector>       // Returns directory listings.
+
+namespace assets {
+
+// .gpak layout (little-endian):
+//   PackHeader
+//   PackEntry[entryCount], sorted by pathHash
+//   path strings, referenced by PackEntry::pathOffset/pathLength
+//   file blobs, each starting on a kPackAlignment boundary
+inline constexpr char kPackMagic[4] = { 'G', 'P', 'A', 'K' };
+inline constexpr std::uint32_t kPackVersion = 1;
+inline constexpr std::uint64_t kPackAlignment = 64;
+// Written by glandular_pack next to the executable; loose files are used when it is missing.
+inline constexpr const char* kDefaultPackPath = "glandular.gpak";
+
+struct PackHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t entryCount;
+    std::uint32_t reserved;
+};
+
+struct PackEntry {
+    std::uint64_t pathHash;  // hashAssetPath of the path below.
+    std::uint64_t offset;    // Blob start, from the beginning of the file.
+    std::uint64_t size;
+    std::uint32_t pathOffset;
+    std::uint32_t pathLength;
+};
+
+static_assert(sizeof(PackHeader) == 16 && sizeof(PackEntry) == 32, "PackHeader/PackEntry are written as raw bytes");
+
+// FNV-1a over the asset path as the game spells it ("assets/gfx/...").
+std::uint64_t hashAssetPath(std::string_view path);
+
+// Read-only, memory-mapped .gpak file. Views returned by find() stay valid until close().
+class AssetPack {
+public:
+    AssetPack() = default;
+    ~AssetPack();
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    // Maps the file and validates its table of contents; returns false (and stays closed)
+    // if the file is missing or malformed.
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return data != nullptr; }
+    std::size_t fileCount() const { return entries.size(); }
+
+    std::optional<std::span<const std::byte>> find(std::string_view path) const;
+    bool contains(std::string_view path) const { return find(path).has_value(); }
+    // Paths of the files directly inside directory (no trailing slash), sorted.
+    std::vector<std::string> list(std::string_view directory) const;
+
+private:
+    std::string_view pathOf(const PackEntry& entry) const;
+
+    const std::byte* data = nullptr;
+    std::size_t size = 0;
+    std::span<const PackEntry> entries;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+// Pack used by the asset loaders in resources/assetFiles.hpp; closed unless mountPack succeeded.
+AssetPack& mountedPack();
+// Opens path as the mounted pack. Logs and returns false when it is not there.
+bool mountPack(const std::string& path = kDefaultPackPath);
+
+} // namespace assets
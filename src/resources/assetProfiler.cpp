@@ -0,0 +1,161 @@
+// === C++ Libraries ===
+#include <algorithm>  // Sorts the rows and picks the top offenders.
+#include <fstream>    // Writes the report files.
+#include <iomanip>    // Formats the milliseconds in the console summary.
+#include <iostream>   // Prints the top offenders and report failures.
+#include <span>       // Picks the rows that feed one console list.
+// === Header Files ===
+#include "resources/assetProfiler.hpp"  // Declares AssetProfiler implemented below.
+
+namespace assets {
+namespace {
+// On-screen pixels are compared against uploaded pixels: 4.0 means four texels per drawn pixel.
+double overscale(const AssetLoadRecord& record) {
+    if (!record.firstUseSize || record.firstUseSize->x <= 0.f || record.firstUseSize->y <= 0.f)
+        return 0.0;
+    double uploaded = static_cast<double>(record.dimensions.x) * record.dimensions.y;
+    double drawn = static_cast<double>(record.firstUseSize->x) * record.firstUseSize->y;
+    return uploaded / drawn;
+}
+
+std::string csvField(const std::string& text) {
+    if (text.find_first_of(",\"\n") == std::string::npos)
+        return text;
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"')
+            quoted += '"';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+std::string jsonString(const std::string& text) {
+    std::string escaped = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        if (static_cast<unsigned char>(c) < 0x20)
+            continue;
+        escaped += c;
+    }
+    return escaped + "\"";
+}
+
+void printList(const char* title, std::span<const AssetLoadRecord* const> rows) {
+    if (rows.empty())
+        return;
+    std::cout << title << "\n" << std::fixed << std::setprecision(1);
+    for (const AssetLoadRecord* row : rows) {
+        std::cout << "  " << std::setw(8) << row->totalMs() << " ms  "
+                  << std::setw(6) << static_cast<double>(row->decodedBytes) / (1024.0 * 1024.0) << " MiB  "
+                  << row->dimensions.x << "x" << row->dimensions.y;
+        if (row->firstUseSize)
+            std::cout << " drawn at " << static_cast<int>(row->firstUseSize->x) << "x"
+                      << static_cast<int>(row->firstUseSize->y);
+        std::cout << "  " << row->label << "\n";
+    }
+    std::cout << std::defaultfloat;
+}
+} // namespace
+
+void AssetProfiler::record(AssetLoadRecord entry, const sf::Texture* texture) {
+    std::lock_guard lock(mutex);
+    auto [found, inserted] = recordByPath.try_emplace(entry.path, records.size());
+    if (inserted) {
+        entry.loads = 1;
+        records.push_back(std::move(entry));
+    } else {
+        AssetLoadRecord& row = records[found->second];
+        row.readMs += entry.readMs;
+        row.decodeMs += entry.decodeMs;
+        row.uploadMs += entry.uploadMs;
+        ++row.loads;
+    }
+    if (texture)
+        recordByTexture[texture] = found->second;
+}
+
+void AssetProfiler::noteDraw(const sf::Texture& texture, sf::Vector2f size) {
+    std::lock_guard lock(mutex);
+    auto found = recordByTexture.find(&texture);
+    if (found == recordByTexture.end())
+        return;
+    AssetLoadRecord& row = records[found->second];
+    if (!row.firstUseSize)
+        row.firstUseSize = size;
+}
+
+bool AssetProfiler::writeReport(const std::string& basePath) const {
+    std::lock_guard lock(mutex);
+    std::vector<const AssetLoadRecord*> sorted;
+    for (const auto& row : records)
+        sorted.push_back(&row);
+    std::stable_sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) {
+        return a->totalMs() > b->totalMs();
+    });
+
+    std::ofstream csv(basePath + ".csv");
+    std::ofstream json(basePath + ".json");
+    if (!csv || !json) {
+        std::cout << "Failed to write asset report " << basePath << "\n";
+        return false;
+    }
+
+    csv << "path,label,kind,loads,read_ms,decode_ms,upload_ms,total_ms,file_bytes,decoded_bytes,"
+           "width,height,first_use_width,first_use_height,overscale\n";
+    json << "[\n";
+    for (std::size_t i = 0; i < sorted.size(); ++i) {
+        const AssetLoadRecord& row = *sorted[i];
+        sf::Vector2f used = row.firstUseSize.value_or(sf::Vector2f{});
+        csv << csvField(row.path) << ',' << csvField(row.label) << ',' << row.kind << ','
+            << row.loads << ',' << row.readMs << ',' << row.decodeMs << ',' << row.uploadMs << ','
+            << row.totalMs() << ',' << row.fileBytes << ',' << row.decodedBytes << ','
+            << row.dimensions.x << ',' << row.dimensions.y << ',' << used.x << ',' << used.y << ','
+            << overscale(row) << '\n';
+        json << "  {\"path\": " << jsonString(row.path) << ", \"label\": " << jsonString(row.label)
+             << ", \"kind\": " << jsonString(row.kind) << ", \"loads\": " << row.loads
+             << ", \"readMs\": " << row.readMs << ", \"decodeMs\": " << row.decodeMs
+             << ", \"uploadMs\": " << row.uploadMs << ", \"totalMs\": " << row.totalMs()
+             << ", \"fileBytes\": " << row.fileBytes << ", \"decodedBytes\": " << row.decodedBytes
+             << ", \"width\": " << row.dimensions.x << ", \"height\": " << row.dimensions.y;
+        if (row.firstUseSize)
+            json << ", \"firstUseWidth\": " << used.x << ", \"firstUseHeight\": " << used.y
+                 << ", \"overscale\": " << overscale(row);
+        json << "}" << (i + 1 < sorted.size() ? ",\n" : "\n");
+    }
+    json << "]\n";
+    std::cout << "Wrote asset report for " << records.size() << " assets to "
+              << basePath << ".csv and " << basePath << ".json\n";
+    return true;
+}
+
+void AssetProfiler::printTopOffenders(std::size_t count) const {
+    std::lock_guard lock(mutex);
+    std::vector<const AssetLoadRecord*> rows;
+    for (const auto& row : records)
+        rows.push_back(&row);
+    auto printTop = [&](const char* title, auto isWorse) {
+        std::stable_sort(rows.begin(), rows.end(), isWorse);
+        printList(title, std::span(rows).first(std::min(count, rows.size())));
+    };
+
+    printTop("Slowest asset loads:", [](const auto* a, const auto* b) {
+        return a->totalMs() > b->totalMs();
+    });
+    printTop("Largest decoded assets:", [](const auto* a, const auto* b) {
+        return a->decodedBytes > b->decodedBytes;
+    });
+    // Keeps the textures that uploaded more pixels than their first draw covered.
+    std::erase_if(rows, [](const auto* row) { return overscale(*row) <= 1.0; });
+    printTop("Most oversized for their first on-screen use:", [](const auto* a, const auto* b) {
+        return overscale(*a) > overscale(*b);
+    });
+}
+
+AssetProfiler& profiler() {
+    static AssetProfiler instance;
+    return instance;
+}
+
+} // namespace assets
@@ -0,0 +1,72 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>        // Provides std::size_t for byte counts.
+#include <mutex>          // Guards the records shared with the decode threads.
+#include <optional>       // Marks assets that were never drawn.
+#include <string>         // Holds paths, labels and the report file names.
+#include <unordered_map>  // Finds a record by path or by uploaded texture.
+#include <vector>         // Stores the records in load order.
+// === SFML Libraries ===
+#include <SFML/Graphics/Sprite.hpp>    // Reads the on-screen size of a drawn sprite.
+#include <SFML/Graphics/Texture.hpp>   // Links uploaded textures back to their records.
+#include <SFML/System/Vector2.hpp>     // Stores pixel dimensions and on-screen sizes.
+
+namespace assets {
+
+// One row of the --asset-report output. Times are wall-clock milliseconds; a cached texture
+// that is reloaded after eviction adds its later loads to the same row.
+struct AssetLoadRecord {
+    std::string path;
+    std::string label;
+    std::string kind;              // "texture", "cached texture" or "sound".
+    double readMs = 0.0;           // Fetching the file bytes, page faults included for packed files.
+    double decodeMs = 0.0;         // Decoding, plus the opaque-bounds scan and margin trim of images.
+    double uploadMs = 0.0;         // loadFromImage on the GL thread; 0 for sounds.
+    std::size_t fileBytes = 0;
+    std::size_t decodedBytes = 0;  // RGBA pixels, or 16-bit samples for sounds.
+    sf::Vector2u dimensions;       // Pixels as uploaded (after trimming); 0 for sounds.
+    std::optional<sf::Vector2f> firstUseSize;  // Size on screen the first time it was drawn.
+    unsigned int loads = 0;
+
+    double totalMs() const { return readMs + decodeMs + uploadMs; }
+};
+
+// Collects per-asset load timings and sizes while --asset-report is active. Loaders report
+// from worker threads, so every member locks; when disabled the loaders skip it entirely.
+class AssetProfiler {
+public:
+    // Must be called before any asset loads; the switch is read without locking.
+    void enable() { active = true; }
+    bool enabled() const { return active; }
+
+    // Stores entry, merging its times into an earlier row for the same path. texture, when
+    // given, lets noteDraw() attribute later draws to this row.
+    void record(AssetLoadRecord entry, const sf::Texture* texture = nullptr);
+    // Remembers size as the first on-screen size of texture; later draws are ignored.
+    void noteDraw(const sf::Texture& texture, sf::Vector2f size);
+
+    // Writes basePath.csv and basePath.json, sorted by total load time. Returns false if
+    // either file could not be written.
+    bool writeReport(const std::string& basePath) const;
+    // Prints the slowest, the largest and the most oversized assets.
+    void printTopOffenders(std::size_t count) const;
+
+private:
+    bool active = false;
+    mutable std::mutex mutex;
+    std::vector<AssetLoadRecord> records;
+    std::unordered_map<std::string, std::size_t> recordByPath;
+    std::unordered_map<const sf::Texture*, std::size_t> recordByTexture;
+};
+
+// Profiler fed by the loaders in resources/assetLoader.hpp and resources/textureCache.hpp.
+AssetProfiler& profiler();
+
+// Records the sprite's on-screen size as its texture's first use. Draw sites call this
+// right before drawing; it does nothing unless --asset-report is active.
+inline void noteDraw(const sf::Sprite& sprite) {
+    if (profiler().enabled())
+        profiler().noteDraw(sprite.getTexture(), sprite.getGlobalBounds().size);
+}
+
+} // namespace assets
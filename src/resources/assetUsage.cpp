@@ -0,0 +1,192 @@
+// === C++ Libraries ===
+#include <algorithm>     // Finds fonts, buffers and scenes, and sorts the unused files.
+#include <cctype>        // Lower-cases file extensions.
+#include <filesystem>    // Lists the loose files under assets/.
+#include <fstream>       // Writes the report files.
+#include <iomanip>       // Formats the sizes in the unused list.
+#include <iostream>      // Prints the summary and report failures.
+#include <string_view>   // Lists the traced file extensions.
+#include <system_error>  // Keeps the directory walk non-throwing.
+#include <utility>       // Moves font and music paths into their rows.
+// === Header Files ===
+#include "resources/assetUsage.hpp"     // Declares AssetUsageTracer implemented below.
+#include "resources/assetManifest.hpp"  // Names the manifest rows in the report.
+
+namespace assets {
+namespace {
+// File kinds the game loads as textures, sounds, music or fonts; data files are read elsewhere.
+constexpr std::string_view kTracedExtensions[] = {
+    ".png", ".jpg", ".jpeg", ".qoi", ".wav", ".ogg", ".mp3", ".flac", ".ttf", ".otf"
+};
+
+std::string normalizedPath(const std::string& path) {
+    return std::filesystem::path(path).lexically_normal().generic_string();
+}
+
+bool isTracedFile(const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return std::find(std::begin(kTracedExtensions), std::end(kTracedExtensions), extension) != std::end(kTracedExtensions);
+}
+
+std::string csvField(const std::string& text) {
+    if (text.find_first_of(",\"\n") == std::string::npos)
+        return text;
+    std::string quoted = "\"";
+    for (char c : text) {
+        if (c == '"')
+            quoted += '"';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+double toMegabytes(std::uintmax_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+} // namespace
+
+void AssetUsageTracer::enable() {
+    active = true;
+    clock.restart();
+}
+
+void AssetUsageTracer::registerFont(const sf::Font& font, std::string path) {
+    fonts.push_back(FontUsage{ &font, std::move(path), {} });
+}
+
+void AssetUsageTracer::registerMusic(std::string path, std::string label) {
+    music.push_back(MusicUsage{ std::move(path), std::move(label), {} });
+}
+
+void AssetUsageTracer::registerSoundBuffer(const sf::SoundBuffer& buffer, std::size_t index) {
+    buffers.push_back(BufferIndex{ &buffer, index });
+}
+
+void AssetUsageTracer::note(Usage& usage) {
+    if (usage.uses++ == 0)
+        usage.firstUseSeconds = clock.getElapsedTime().asSeconds();
+    if (std::find(usage.scenes.begin(), usage.scenes.end(), currentScene) == usage.scenes.end())
+        usage.scenes.push_back(currentScene);
+}
+
+void AssetUsageTracer::noteTexture(std::size_t index) {
+    note(textures[index]);
+}
+
+void AssetUsageTracer::notePlay(const sf::Sound& sound) {
+    const sf::SoundBuffer* buffer = &sound.getBuffer();
+    auto found = std::find_if(buffers.begin(), buffers.end(),
+                              [buffer](const BufferIndex& entry) { return entry.buffer == buffer; });
+    if (found != buffers.end())
+        note(sounds[found->index]);
+}
+
+void AssetUsageTracer::noteFont(const sf::Font& font) {
+    auto found = std::find_if(fonts.begin(), fonts.end(), [&font](const FontUsage& entry) { return entry.font == &font; });
+    if (found != fonts.end())
+        note(found->usage);
+}
+
+void AssetUsageTracer::noteMusic(const std::string& path) {
+    auto found = std::find_if(music.begin(), music.end(), [&path](const MusicUsage& entry) { return entry.path == path; });
+    if (found != music.end())
+        note(found->usage);
+}
+
+void AssetUsageTracer::noteFileOpened(const std::string& path) {
+    std::string normalized = normalizedPath(path);
+    std::lock_guard lock(filesMutex);
+    openedFiles.insert(std::move(normalized));
+}
+
+bool AssetUsageTracer::writeReport(const std::string& basePath) const {
+    std::ofstream csv(basePath + ".csv");
+    std::ofstream unused(basePath + "_unused.txt");
+    if (!csv || !unused) {
+        std::cout << "Failed to write asset usage report " << basePath << "\n";
+        return false;
+    }
+
+    std::unordered_set<std::string> referenced;
+    {
+        std::lock_guard lock(filesMutex);
+        referenced = openedFiles;
+    }
+    std::size_t neverUsed = 0;
+    csv << "kind,path,label,uses,first_use_s,first_scene,scenes\n";
+    unused << "Loaded but never used:\n";
+    auto writeRow = [&](const char* kind, const std::string& path, const std::string& label, const Usage& usage) {
+        referenced.insert(normalizedPath(path));
+        std::string scenes;
+        for (const char* scene : usage.scenes)
+            scenes += (scenes.empty() ? "" : ";") + std::string(scene);
+        csv << kind << ',' << csvField(path) << ',' << csvField(label) << ',' << usage.uses << ',';
+        if (usage.uses > 0)
+            csv << usage.firstUseSeconds << ',' << usage.scenes.front();
+        else
+            csv << ',';
+        csv << ',' << csvField(scenes) << '\n';
+        if (usage.uses == 0) {
+            unused << "  " << kind << "  " << path << "\n";
+            ++neverUsed;
+        }
+    };
+    for (std::size_t i = 0; i < kTextureCount; ++i)
+        writeRow("texture", kTextureManifest[i].path, kTextureManifest[i].label, textures[i]);
+    for (std::size_t i = 0; i < kSoundCount; ++i)
+        writeRow("sound", kSoundManifest[i].path, kSoundManifest[i].label, sounds[i]);
+    for (const auto& track : music)
+        writeRow("music", track.path, track.label, track.usage);
+    // Only GlyphBatch draws are seen; sf::Text has no hook, so an untouched font is not proof of an unused one.
+    std::vector<std::string> untracedFonts;
+    for (const auto& font : fonts) {
+        if (font.usage.uses == 0)
+            untracedFonts.push_back(font.path);
+        else
+            writeRow("font", font.path, font.path, font.usage);
+    }
+    if (!untracedFonts.empty()) {
+        unused << "\nFonts never drawn through a GlyphBatch (sf::Text draws are not traced):\n";
+        for (const auto& path : untracedFonts) {
+            referenced.insert(normalizedPath(path));
+            csv << "font," << csvField(path) << ',' << csvField(path) << ",,,,\n";
+            unused << "  font  " << path << "\n";
+        }
+    }
+
+    // Everything else under assets/ that the game could load but never opened (old_textures, ...).
+    std::vector<std::pair<std::string, std::uintmax_t>> unopened;
+    std::uintmax_t unopenedBytes = 0;
+    std::error_code error;
+    for (auto it = std::filesystem::recursive_directory_iterator("assets", error);
+         !error && it != std::filesystem::recursive_directory_iterator(); it.increment(error)) {
+        if (!it->is_regular_file(error) || !isTracedFile(it->path()))
+            continue;
+        std::string path = it->path().lexically_normal().generic_string();
+        if (referenced.contains(path))
+            continue;
+        std::uintmax_t size = it->file_size(error);
+        unopenedBytes += error ? 0 : size;
+        unopened.emplace_back(std::move(path), error ? 0 : size);
+    }
+    std::sort(unopened.begin(), unopened.end());
+    unused << "\nFiles under assets/ never opened (" << unopened.size() << ", " << std::fixed
+           << std::setprecision(1) << toMegabytes(unopenedBytes) << " MB):\n";
+    for (const auto& [path, size] : unopened)
+        unused << "  " << std::setw(8) << toMegabytes(size) << " MB  " << path << "\n";
+
+    std::cout << std::fixed << std::setprecision(1) << neverUsed << " loaded asset(s) were never used and "
+              << unopened.size() << " file(s) under assets/ (" << toMegabytes(unopenedBytes)
+              << " MB) were never opened; wrote " << basePath << ".csv and " << basePath << "_unused.txt\n"
+              << std::defaultfloat;
+    return true;
+}
+
+AssetUsageTracer& usageTracer() {
+    static AssetUsageTracer instance;
+    return instance;
+}
+
+} // namespace assets
@@ -0,0 +1,92 @@
+#pragma once
+// === C++ Libraries ===
+#include <array>          // Holds one usage row per manifest texture and sound.
+#include <cstddef>        // Provides std::size_t for the manifest indexes.
+#include <cstdint>        // Counts uses without overflowing in long sessions.
+#include <mutex>          // Guards the opened-file set shared with the decode threads.
+#include <string>         // Holds font paths, opened files and the report file names.
+#include <unordered_set>  // Remembers every file the loaders opened.
+#include <vector>         // Stores the fonts and the scenes an asset was used in.
+// === SFML Libraries ===
+#include <SFML/Audio/Sound.hpp>       // Maps a played sound back to its manifest buffer.
+#include <SFML/Graphics/Font.hpp>     // Identifies fonts by the Resources member.
+#include <SFML/System/Clock.hpp>      // Times first uses from the moment tracing starts.
+// === Header Files ===
+#include "resources/assetIds.hpp"  // Sizes the texture and sound rows.
+
+namespace assets {
+
+// --trace-asset-usage: when, how often and in which scenes every manifest texture and sound,
+// every music track and every font is used, and which asset files under assets/ were never
+// opened at all. A texture is used when Resources looks it up, a sound when a play site calls
+// notePlay(), a track when AudioManager opens its stream and a font when a GlyphBatch draws
+// with it. sf::Text draws cannot be seen, so font counts are only a lower bound.
+// Everything except noteFileOpened() is main-thread only.
+class AssetUsageTracer {
+public:
+    // Call before Resources loads anything, so every opened file is seen.
+    void enable();
+    bool enabled() const { return active; }
+    // Scene that later first uses are attributed to; kept by pointer, so pass a literal.
+    void setScene(const char* scene) { currentScene = scene; }
+
+    void registerFont(const sf::Font& font, std::string path);
+    void registerSoundBuffer(const sf::SoundBuffer& buffer, std::size_t index);
+    void registerMusic(std::string path, std::string label);
+
+    void noteTexture(std::size_t index);
+    void notePlay(const sf::Sound& sound);
+    void noteFont(const sf::Font& font);
+    void noteMusic(const std::string& path);
+    // Called by the asset file loaders, also from the decode threads.
+    void noteFileOpened(const std::string& path);
+
+    // Writes basePath.csv (one row per asset) and basePath_unused.txt (loaded but never used,
+    // and files under assets/ nothing opened). Returns false if either file could not be written.
+    bool writeReport(const std::string& basePath) const;
+
+private:
+    struct Usage {
+        std::uint64_t uses = 0;
+        double firstUseSeconds = 0.0;
+        std::vector<const char*> scenes;  // In order of first use; scenes[0] saw the first use.
+    };
+    struct FontUsage {
+        const sf::Font* font = nullptr;
+        std::string path;
+        Usage usage;
+    };
+    struct MusicUsage {
+        std::string path;
+        std::string label;
+        Usage usage;
+    };
+    struct BufferIndex {
+        const sf::SoundBuffer* buffer = nullptr;
+        std::size_t index = 0;
+    };
+
+    void note(Usage& usage);
+
+    bool active = false;
+    const char* currentScene = "startup";
+    sf::Clock clock;
+    std::array<Usage, kTextureCount> textures;
+    std::array<Usage, kSoundCount> sounds;
+    std::vector<FontUsage> fonts;
+    std::vector<MusicUsage> music;
+    std::vector<BufferIndex> buffers;
+    mutable std::mutex filesMutex;
+    std::unordered_set<std::string> openedFiles;
+};
+
+AssetUsageTracer& usageTracer();
+
+// Records the sound's buffer as played. Play sites call this right before play(); it does
+// nothing unless --trace-asset-usage is active.
+inline void notePlay(const sf::Sound& sound) {
+    if (usageTracer().enabled())
+        usageTracer().notePlay(sound);
+}
+
+} // namespace assets
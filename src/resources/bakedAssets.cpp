@@ -0,0 +1,108 @@
+// === C++ Libraries ===
+#include <algorithm>     // Uses std::min for the credits square.
+#include <cmath>         // Rounds the layout sizes up to whole pixels.
+#include <filesystem>    // Checks whether a baked copy exists and is up to date.
+#include <system_error>  // Keeps the filesystem checks non-throwing.
+// === Header Files ===
+#include "resources/bakedAssets.hpp"  // Declares the bake manifest helpers implemented below.
+#include "resources/assetPack.hpp"    // A mounted pack already holds the baked bytes.
+
+namespace assets {
+namespace {
+// Window size from game.cpp; the window is created without Style::Resize.
+constexpr float kWindowWidth = 1280.f;
+constexpr float kWindowHeight = 720.f;
+
+// dialogDrawElements: portraits fit half of the name box (20% x 25% of the window); the
+// backdrop scale (1.29) is the larger of the two, so it covers the portrait too (1.23).
+constexpr float kPortraitAreaWidth = kWindowWidth * 0.20f * 0.5f;
+constexpr float kPortraitAreaHeight = kWindowHeight * 0.25f * 0.5f;
+constexpr float kPortraitScale = 1.29f;
+
+// creditsUI: act portraits fit a square of half the shorter window side, the beta tester
+// picture fits 70% x 45% of the window.
+constexpr float kCreditsSquare = std::min(kWindowWidth, kWindowHeight) * 0.5f;
+constexpr float kCreditsBetaWidth = kWindowWidth * 0.7f;
+constexpr float kCreditsBetaHeight = kWindowHeight * 0.45f;
+
+struct BakeRule {
+    std::string_view prefix;  // Matches every asset path starting with this.
+    sf::Vector2f maxSize;     // {0, 0} keeps the native resolution.
+};
+
+// First match wins, so exceptions go before the directory they live in.
+constexpr BakeRule kBakeRules[] = {
+    // Backgrounds and battle layers are stretched over the whole window.
+    { "assets/gfx/background.png", { kWindowWidth, kWindowHeight } },
+    { "assets/gfx/background/", { kWindowWidth, kWindowHeight } },
+    { "assets/gfx/battleUI/icon_", { 0.f, 0.f } },  // Gender icons are drawn at a fixed scale.
+    { "assets/gfx/battleUI/", { kWindowWidth, kWindowHeight } },
+
+    // Speaker portraits and their backdrops in the name box.
+    { "assets/gfx/characters/tory_tailor.png", { kPortraitAreaWidth * kPortraitScale, kPortraitAreaHeight * kPortraitScale } },
+    { "assets/gfx/characters/noah_bates.png", { kPortraitAreaWidth * kPortraitScale, kPortraitAreaHeight * kPortraitScale } },
+    { "assets/gfx/chars/portraits/", { kPortraitAreaWidth * kPortraitScale, kPortraitAreaHeight * kPortraitScale } },
+    { "assets/gfx/chars/portraitsBackground/", { kPortraitAreaWidth * kPortraitScale, kPortraitAreaHeight * kPortraitScale } },
+
+    // Credits
+    { "assets/gfx/chars/credits/beta_tester_", { kCreditsBetaWidth, kCreditsBetaHeight } },
+    { "assets/gfx/chars/credits/", { kCreditsSquare, kCreditsSquare } },
+};
+
+constexpr std::string_view kSourceDir = "assets/";
+} // namespace
+
+std::optional<sf::Vector2u> maxDisplaySize(std::string_view path) {
+    for (const auto& rule : kBakeRules) {
+        if (!path.starts_with(rule.prefix))
+            continue;
+        if (rule.maxSize.x <= 0.f || rule.maxSize.y <= 0.f)
+            return std::nullopt;
+        return sf::Vector2u{
+            static_cast<unsigned int>(std::ceil(rule.maxSize.x)),
+            static_cast<unsigned int>(std::ceil(rule.maxSize.y))
+        };
+    }
+    return std::nullopt;
+}
+
+std::string bakedPathFor(std::string_view path) {
+    if (path.starts_with(kSourceDir))
+        path.remove_prefix(kSourceDir.size());
+    std::string baked(kBakedAssetDir);
+    baked += '/';
+    baked += path;
+    return baked;
+}
+
+std::string bakedQoiPathFor(std::string_view path) {
+    return std::filesystem::path(bakedPathFor(path)).replace_extension(".qoi").generic_string();
+}
+
+std::string resolveAssetPath(const std::string& path) {
+    namespace fs = std::filesystem;
+    if (mountedPack().contains(path))
+        return path;  // glandular_pack stores the baked copy under the source path.
+
+    std::error_code error;
+    static const bool hasBakedDir = fs::is_directory(std::string(kBakedAssetDir), error);
+    if (!hasBakedDir)
+        return path;
+
+    // Only art with a display size gets a downsampled PNG; a QOI copy may exist for any texture.
+    const std::string candidates[] = { bakedQoiPathFor(path), maxDisplaySize(path) ? bakedPathFor(path) : std::string() };
+    for (const std::string& baked : candidates) {
+        if (baked.empty())
+            continue;
+        auto bakedTime = fs::last_write_time(baked, error);
+        if (error)
+            continue;
+        auto sourceTime = fs::last_write_time(path, error);
+        if (!error && sourceTime > bakedTime)
+            return path;  // Source art changed since the last bake.
+        return baked;
+    }
+    return path;
+}
+
+} // namespace assets
@@ -0,0 +1,29 @@
+#pragma once
+// === C++ Libraries ===
+#include <optional>     // Leaves the display size empty for art that must keep its native resolution.
+#include <string>       // Returns the resolved file path.
+#include <string_view>  // Matches asset paths against the manifest rules.
+// === SFML Libraries ===
+#include <SFML/System/Vector2.hpp>  // Stores the maximum on-screen size in pixels.
+
+namespace assets {
+
+// Directory glandular_bake writes to; mirrors the layout of assets/.
+inline constexpr std::string_view kBakedAssetDir = "assets_baked";
+
+// Largest size the game ever draws this texture at, derived from the window and UI layout
+// constants. Empty for textures drawn at a fixed scale of their native size (sprites, icons),
+// since resampling those would change how big they appear on screen.
+std::optional<sf::Vector2u> maxDisplaySize(std::string_view path);
+
+// Path under kBakedAssetDir that holds the baked copy of an "assets/..." path.
+std::string bakedPathFor(std::string_view path);
+// Same, with the extension swapped for .qoi; written by glandular_bake --qoi.
+std::string bakedQoiPathFor(std::string_view path);
+
+// Returns the baked copy of path (QOI first, then the downsampled PNG) when it exists and is
+// at least as new as the source art, otherwise path itself. Paths held by the mounted asset
+// pack are returned unchanged.
+std::string resolveAssetPath(const std::string& path);
+
+} // namespace assets
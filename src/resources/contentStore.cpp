@@ -0,0 +1,145 @@
+// === C++ Libraries ===
+#include <iomanip>   // Formats the savings in the summary.
+#include <iostream>  // Logs every duplicate and the summary.
+// === SFML Libraries ===
+#include <SFML/System/Clock.hpp>  // Times the decodes the summary counts as saved.
+// === Header Files ===
+#include "resources/contentStore.hpp"  // Declares ContentStore implemented below.
+#include "resources/assetFiles.hpp"    // Reads the file from the asset pack or the loose tree.
+#include "resources/qoiImage.hpp"      // Decodes baked QOI art as well as PNG/JPEG.
+#include "resources/textureLod.hpp"    // Builds the downscaled levels of withLods textures.
+
+namespace assets {
+
+ContentKey contentKey(std::span<const std::byte> bytes, ContentVariant variant) {
+    // Same FNV-1a as hashAssetPath; the size and variant in the key settle the rare collision.
+    std::uint64_t hash = 14695981039346656037ull;
+    for (std::byte b : bytes) {
+        hash ^= static_cast<std::uint8_t>(b);
+        hash *= 1099511628211ull;
+    }
+    return ContentKey{ hash, bytes.size(), variant };
+}
+
+const void* ContentStore::claimObject(const ContentKey& key, const std::string& path, const void* target) {
+    std::lock_guard lock(mutex);
+    auto [found, inserted] = entryByKey.try_emplace(key, entries.size());
+    if (inserted) {
+        entries.push_back(Entry{ path, target, key.variant });
+        entryByObject.emplace(target, found->second);
+        return target;
+    }
+    const Entry& original = entries[found->second];
+    if (original.path == path)
+        return original.object;  // The same file loaded twice is not a duplicate on disk.
+    duplicates.push_back(Duplicate{ path, found->second });
+    std::cout << "Sharing " << path << " with identical " << original.path << "\n";
+    return original.object;
+}
+
+const sf::Texture* ContentStore::claim(const ContentKey& key, const std::string& path, const sf::Texture* target) {
+    return static_cast<const sf::Texture*>(claimObject(key, path, target));
+}
+
+const sf::SoundBuffer* ContentStore::claim(const ContentKey& key, const std::string& path, const sf::SoundBuffer* target) {
+    return static_cast<const sf::SoundBuffer*>(claimObject(key, path, target));
+}
+
+void ContentStore::recordCost(const void* object, double decodeMs, std::size_t bytes) {
+    std::lock_guard lock(mutex);
+    auto found = entryByObject.find(object);
+    if (found == entryByObject.end())
+        return;
+    Entry& entry = entries[found->second];
+    // Evicted cache textures reload into the same object; the summary counts one decode.
+    entry.decodeMs = decodeMs;
+    entry.bytes = bytes;
+}
+
+const sf::Texture* ContentStore::loadTexture(const std::string& path, bool withLods) {
+    AssetBytes bytes;
+    if (!readAssetBytes(path, bytes))
+        return nullptr;
+
+    sf::Texture* target = nullptr;
+    {
+        std::lock_guard lock(mutex);
+        target = &ownedTextures.emplace_back();
+    }
+    const ContentKey key = contentKey(bytes.view, ContentVariant::Texture);
+    if (const sf::Texture* original = claim(key, path, target); original != target) {
+        {
+            std::lock_guard lock(mutex);
+            ownedTextures.pop_back();
+        }
+        // The first load of these bytes (a manifest row, say) may not have asked for levels.
+        if (withLods && textureLods().levelCount(*original) == 0) {
+            sf::Image image;
+            if (decodeImage(bytes.view, image))
+                textureLods().add(*original, buildLodImages(image));
+        }
+        return original;
+    }
+
+    sf::Clock clock;
+    sf::Image image;
+    if (!decodeImage(bytes.view, image) || !target->loadFromImage(image)) {
+        // Let a later file with the same bytes try again instead of sharing the empty texture,
+        // and drop the empty slot so the owned counts and byte totals stay honest.
+        std::lock_guard lock(mutex);
+        entryByKey.erase(key);
+        entryByObject.erase(target);
+        ownedTextures.pop_back();
+        return nullptr;
+    }
+    if (withLods)
+        textureLods().add(*target, buildLodImages(image));
+    const sf::Vector2u size = target->getSize();
+    recordCost(target, static_cast<double>(clock.getElapsedTime().asMicroseconds()) / 1000.0,
+               static_cast<std::size_t>(size.x) * size.y * 4);
+    return target;
+}
+
+void ContentStore::printSummary() const {
+    std::lock_guard lock(mutex);
+    if (duplicates.empty())
+        return;
+
+    double savedMs = 0.0;
+    std::size_t savedTextureBytes = 0;
+    std::size_t savedSoundBytes = 0;
+    for (const auto& duplicate : duplicates) {
+        const Entry& original = entries[duplicate.original];
+        savedMs += original.decodeMs;
+        if (original.variant == ContentVariant::Sound)
+            savedSoundBytes += original.bytes;
+        else
+            savedTextureBytes += original.bytes;
+    }
+    constexpr double kMiB = 1024.0 * 1024.0;
+    std::cout << std::fixed << std::setprecision(1)
+              << duplicates.size() << " duplicate asset file(s) shared an identical decode, saving "
+              << savedMs << " ms of decoding, " << static_cast<double>(savedTextureBytes) / kMiB
+              << " MiB of VRAM and " << static_cast<double>(savedSoundBytes) / kMiB
+              << " MiB of sound buffers\n" << std::defaultfloat;
+}
+
+std::size_t ContentStore::ownedTextureCount() const {
+    std::lock_guard lock(mutex);
+    return ownedTextures.size();
+}
+
+std::size_t ContentStore::ownedTextureBytes() const {
+    std::lock_guard lock(mutex);
+    std::size_t bytes = 0;
+    for (const sf::Texture& texture : ownedTextures)
+        bytes += static_cast<std::size_t>(texture.getSize().x) * texture.getSize().y * 4;
+    return bytes;
+}
+
+ContentStore& contentStore() {
+    static ContentStore instance;
+    return instance;
+}
+
+} // namespace assets
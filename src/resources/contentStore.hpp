@@ -0,0 +1,91 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>        // Provides std::size_t for byte counts.
+#include <cstdint>        // Stores the content hash and the variant tag.
+#include <deque>          // Owns the textures loaded for callers outside the manifest at stable addresses.
+#include <mutex>          // Guards the claims made from the decode threads.
+#include <span>           // Hashes file bytes without copying them.
+#include <string>         // Keeps the path that first claimed each content.
+#include <unordered_map>  // Finds the first claim by content key or by object.
+#include <vector>         // Stores the claims and the duplicates in discovery order.
+// === SFML Libraries ===
+#include <SFML/Audio/SoundBuffer.hpp>  // Sound buffers share decoded samples like textures share pixels.
+#include <SFML/Graphics/Texture.hpp>   // Declares the textures handed out by loadTexture().
+
+namespace assets {
+
+// How the bytes are turned into an object. Identical files only share when this matches too:
+// a trimmed cached texture is not interchangeable with the full image loadAll uploads.
+enum class ContentVariant : std::uint8_t {
+    Texture,         // Uploaded once by loadAll or loadTexture() and kept for the whole run.
+    CachedTexture,   // Owned by TextureCache, which may evict it.
+    TrimmedTexture,  // Owned by TextureCache, cut to its opaque rectangle.
+    Sound
+};
+
+// Identifies decoded content: FNV-1a of the file bytes, their size and the variant.
+struct ContentKey {
+    std::uint64_t hash = 0;
+    std::uint64_t size = 0;
+    ContentVariant variant = ContentVariant::Texture;
+
+    friend bool operator==(const ContentKey&, const ContentKey&) = default;
+};
+
+ContentKey contentKey(std::span<const std::byte> bytes, ContentVariant variant);
+
+// Remembers which object first decoded each distinct file content, so identical bytes found
+// under another path share it instead of being decoded and uploaded again. claim() is called
+// from the decode threads and locks; loadTexture() must run on the thread that owns GL.
+class ContentStore {
+public:
+    // Returns the object that first claimed key, or target itself if this is the first claim.
+    // A caller that gets another object back skips its decode and uses that one instead.
+    const sf::Texture* claim(const ContentKey& key, const std::string& path, const sf::Texture* target);
+    const sf::SoundBuffer* claim(const ContentKey& key, const std::string& path, const sf::SoundBuffer* target);
+    // Records what decoding object cost and how much memory it holds, for the summary.
+    void recordCost(const void* object, double decodeMs, std::size_t bytes);
+
+    // Loads a texture for callers outside the manifest (weapon list, UI frame). Identical content
+    // resolves to the texture already uploaded; nullptr if the file could not be loaded.
+    // withLods also uploads its downscaled levels into textureLods().
+    const sf::Texture* loadTexture(const std::string& path, bool withLods = false);
+
+    // Prints how many files shared another file's decode and the time and memory that saved.
+    void printSummary() const;
+    // Textures uploaded by loadTexture() and their estimated VRAM, for the memory report.
+    std::size_t ownedTextureCount() const;
+    std::size_t ownedTextureBytes() const;
+
+private:
+    struct Entry {
+        std::string path;
+        const void* object = nullptr;
+        ContentVariant variant = ContentVariant::Texture;
+        double decodeMs = 0.0;
+        std::size_t bytes = 0;
+    };
+
+    struct Duplicate {
+        std::string path;
+        std::size_t original = 0;  // Index into entries.
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const ContentKey& key) const noexcept { return static_cast<std::size_t>(key.hash ^ key.size); }
+    };
+
+    const void* claimObject(const ContentKey& key, const std::string& path, const void* target);
+
+    mutable std::mutex mutex;
+    std::vector<Entry> entries;
+    std::unordered_map<ContentKey, std::size_t, KeyHash> entryByKey;
+    std::unordered_map<const void*, std::size_t> entryByObject;
+    std::vector<Duplicate> duplicates;
+    std::deque<sf::Texture> ownedTextures;
+};
+
+// Store shared by ParallelLoader, TextureCache and the direct loaders.
+ContentStore& contentStore();
+
+} // namespace assets
@@ -0,0 +1,65 @@
+// === C++ Libraries ===
+#include <algorithm>  // Uses std::max while reducing the alpha channel.
+#include <cstdint>    // Reads raw RGBA bytes as std::uint8_t.
+#include <vector>     // Holds the per-row and per-column alpha maxima.
+// === Header Files ===
+#include "resources/opaqueBounds.hpp"  // Declares computeOpaqueBounds implemented below.
+
+namespace assets {
+namespace {
+// Returns the normalized rect spanned by the rows/columns whose maximum alpha exceeds threshold.
+std::optional<sf::FloatRect> boundsAbove(
+    const std::vector<std::uint8_t>& rowMax,
+    const std::vector<std::uint8_t>& columnMax,
+    std::uint8_t threshold
+) {
+    auto above = [threshold](std::uint8_t alpha) { return alpha > threshold; };
+    auto firstRow = std::find_if(rowMax.begin(), rowMax.end(), above);
+    if (firstRow == rowMax.end())
+        return std::nullopt;
+    auto lastRow = std::find_if(rowMax.rbegin(), rowMax.rend(), above);
+    auto firstColumn = std::find_if(columnMax.begin(), columnMax.end(), above);
+    auto lastColumn = std::find_if(columnMax.rbegin(), columnMax.rend(), above);
+
+    float width = static_cast<float>(columnMax.size());
+    float height = static_cast<float>(rowMax.size());
+    float minX = static_cast<float>(firstColumn - columnMax.begin());
+    float minY = static_cast<float>(firstRow - rowMax.begin());
+    float maxX = static_cast<float>(columnMax.rend() - lastColumn);  // One past the last column.
+    float maxY = static_cast<float>(rowMax.rend() - lastRow);
+    return sf::FloatRect{
+        { minX / width, minY / height },
+        { (maxX - minX) / width, (maxY - minY) / height }
+    };
+}
+} // namespace
+
+OpaqueBounds computeOpaqueBounds(const sf::Image& image) {
+    OpaqueBounds result;
+    auto size = image.getSize();
+    const std::uint8_t* pixels = image.getPixelsPtr();
+    if (size.x == 0 || size.y == 0 || !pixels)
+        return result;
+
+    // Reduce the alpha channel to a max per row and per column. The inner loop is branch-free
+    // so the compiler vectorizes it; the thresholds are applied to the two small arrays after.
+    std::vector<std::uint8_t> rowMax(size.y, 0);
+    std::vector<std::uint8_t> columnMax(size.x, 0);
+    std::uint8_t* columns = columnMax.data();
+    for (unsigned int y = 0; y < size.y; ++y) {
+        const std::uint8_t* row = pixels + static_cast<std::size_t>(y) * size.x * 4;
+        std::uint8_t best = 0;
+        for (unsigned int x = 0; x < size.x; ++x) {
+            std::uint8_t alpha = row[static_cast<std::size_t>(x) * 4 + 3];
+            columns[x] = std::max(columns[x], alpha);
+            best = std::max(best, alpha);
+        }
+        rowMax[y] = best;
+    }
+
+    result.visible = boundsAbove(rowMax, columnMax, 0);
+    result.solid = boundsAbove(rowMax, columnMax, 16);
+    return result;
+}
+
+} // namespace assets
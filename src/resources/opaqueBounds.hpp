@@ -0,0 +1,19 @@
+#pragma once
+// === C++ Libraries ===
+#include <optional>  // Leaves a variant empty when no pixel passes its alpha threshold.
+// === SFML Libraries ===
+#include <SFML/Graphics/Image.hpp>  // Scans the decoded CPU-side pixels.
+#include <SFML/Graphics/Rect.hpp>   // Stores the bounds as normalized sf::FloatRect values.
+
+namespace assets {
+
+// Bounding box of a texture's visible pixels, normalized to [0, 1] of its size.
+struct OpaqueBounds {
+    std::optional<sf::FloatRect> visible;  // Pixels with alpha > 0 (battle sprites and boxes).
+    std::optional<sf::FloatRect> solid;    // Pixels with alpha > 16 (map overlay hitboxes).
+};
+
+// Computes both variants in a single pass over the image's alpha channel.
+OpaqueBounds computeOpaqueBounds(const sf::Image& image);
+
+} // namespace assets
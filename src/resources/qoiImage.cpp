@@ -0,0 +1,206 @@
+// === C++ Libraries ===
+#include <array>    // Holds the 64-entry colour index.
+#include <cstring>  // Compares the magic bytes.
+// === Header Files ===
+#include "resources/qoiImage.hpp"  // Declares the codec implemented below.
+
+namespace assets {
+namespace {
+constexpr std::uint8_t kOpIndex = 0x00;
+constexpr std::uint8_t kOpDiff = 0x40;
+constexpr std::uint8_t kOpLuma = 0x80;
+constexpr std::uint8_t kOpRun = 0xc0;
+constexpr std::uint8_t kOpRgb = 0xfe;
+constexpr std::uint8_t kOpRgba = 0xff;
+constexpr std::uint8_t kMask2 = 0xc0;
+
+constexpr char kMagic[4] = { 'q', 'o', 'i', 'f' };
+constexpr std::size_t kHeaderSize = 14;
+constexpr std::uint8_t kEndMarker[8] = { 0, 0, 0, 0, 0, 0, 0, 1 };
+// Upper bound from the reference implementation; keeps width * height * 4 far from overflow.
+constexpr std::uint64_t kMaxPixels = 400'000'000;
+
+struct Pixel {
+    std::uint8_t r = 0, g = 0, b = 0, a = 255;
+
+    friend bool operator==(const Pixel&, const Pixel&) = default;
+};
+
+std::size_t indexOf(const Pixel& px) {
+    return (px.r * 3u + px.g * 5u + px.b * 7u + px.a * 11u) % 64u;
+}
+
+void writeU32(std::vector<std::byte>& out, std::uint32_t value) {
+    out.push_back(static_cast<std::byte>(value >> 24));
+    out.push_back(static_cast<std::byte>(value >> 16));
+    out.push_back(static_cast<std::byte>(value >> 8));
+    out.push_back(static_cast<std::byte>(value));
+}
+
+std::uint32_t readU32(const std::uint8_t* in) {
+    return (static_cast<std::uint32_t>(in[0]) << 24) | (static_cast<std::uint32_t>(in[1]) << 16)
+         | (static_cast<std::uint32_t>(in[2]) << 8) | in[3];
+}
+} // namespace
+
+bool isQoi(std::span<const std::byte> bytes) {
+    return bytes.size() >= kHeaderSize && std::memcmp(bytes.data(), kMagic, sizeof(kMagic)) == 0;
+}
+
+std::vector<std::byte> encodeQoi(const std::uint8_t* rgba, sf::Vector2u size) {
+    const std::size_t pixelCount = static_cast<std::size_t>(size.x) * size.y;
+    std::vector<std::byte> out;
+    out.reserve(kHeaderSize + pixelCount * 2 + sizeof(kEndMarker));
+    for (char c : kMagic)
+        out.push_back(static_cast<std::byte>(c));
+    writeU32(out, size.x);
+    writeU32(out, size.y);
+    out.push_back(std::byte{ 4 });  // RGBA
+    out.push_back(std::byte{ 0 });  // sRGB with linear alpha
+    auto emit = [&out](std::uint8_t value) { out.push_back(static_cast<std::byte>(value)); };
+
+    std::array<Pixel, 64> index{};
+    Pixel previous;
+    int run = 0;
+    for (std::size_t i = 0; i < pixelCount; ++i) {
+        const std::uint8_t* in = rgba + i * 4;
+        const Pixel px{ in[0], in[1], in[2], in[3] };
+        if (px == previous) {
+            if (++run == 62 || i + 1 == pixelCount) {
+                emit(static_cast<std::uint8_t>(kOpRun | (run - 1)));
+                run = 0;
+            }
+            continue;
+        }
+        if (run > 0) {
+            emit(static_cast<std::uint8_t>(kOpRun | (run - 1)));
+            run = 0;
+        }
+
+        const std::size_t slot = indexOf(px);
+        if (index[slot] == px) {
+            emit(static_cast<std::uint8_t>(kOpIndex | slot));
+        } else {
+            index[slot] = px;
+            if (px.a == previous.a) {
+                // Channel differences wrap like the decoder's 8-bit arithmetic.
+                const int dr = static_cast<std::int8_t>(px.r - previous.r);
+                const int dg = static_cast<std::int8_t>(px.g - previous.g);
+                const int db = static_cast<std::int8_t>(px.b - previous.b);
+                const int drg = dr - dg;
+                const int dbg = db - dg;
+                if (dr > -3 && dr < 2 && dg > -3 && dg < 2 && db > -3 && db < 2) {
+                    emit(static_cast<std::uint8_t>(kOpDiff | (dr + 2) << 4 | (dg + 2) << 2 | (db + 2)));
+                } else if (drg > -9 && drg < 8 && dg > -33 && dg < 32 && dbg > -9 && dbg < 8) {
+                    emit(static_cast<std::uint8_t>(kOpLuma | (dg + 32)));
+                    emit(static_cast<std::uint8_t>((drg + 8) << 4 | (dbg + 8)));
+                } else {
+                    emit(kOpRgb);
+                    emit(px.r);
+                    emit(px.g);
+                    emit(px.b);
+                }
+            } else {
+                emit(kOpRgba);
+                emit(px.r);
+                emit(px.g);
+                emit(px.b);
+                emit(px.a);
+            }
+        }
+        previous = px;
+    }
+
+    for (std::uint8_t value : kEndMarker)
+        emit(value);
+    return out;
+}
+
+std::vector<std::byte> encodeQoi(const sf::Image& image) {
+    return encodeQoi(image.getPixelsPtr(), image.getSize());
+}
+
+bool decodeQoi(std::span<const std::byte> bytes, std::vector<std::uint8_t>& rgba, sf::Vector2u& size) {
+    if (!isQoi(bytes) || bytes.size() < kHeaderSize + sizeof(kEndMarker))
+        return false;
+    const auto* in = reinterpret_cast<const std::uint8_t*>(bytes.data());
+    const std::uint32_t width = readU32(in + 4);
+    const std::uint32_t height = readU32(in + 8);
+    const std::uint8_t channels = in[12];
+    if (width == 0 || height == 0 || (channels != 3 && channels != 4)
+        || static_cast<std::uint64_t>(width) * height > kMaxPixels)
+        return false;
+
+    const std::size_t pixelCount = static_cast<std::size_t>(width) * height;
+    rgba.resize(pixelCount * 4);
+    std::array<Pixel, 64> index{};
+    Pixel px;
+    int run = 0;
+    std::size_t pos = kHeaderSize;
+    const std::size_t chunksEnd = bytes.size() - sizeof(kEndMarker);
+    for (std::size_t i = 0; i < pixelCount; ++i) {
+        if (run > 0) {
+            --run;
+        } else if (pos < chunksEnd) {
+            const std::uint8_t op = in[pos++];
+            if (op == kOpRgb) {
+                if (pos + 3 > chunksEnd)
+                    return false;
+                px.r = in[pos++];
+                px.g = in[pos++];
+                px.b = in[pos++];
+            } else if (op == kOpRgba) {
+                if (pos + 4 > chunksEnd)
+                    return false;
+                px.r = in[pos++];
+                px.g = in[pos++];
+                px.b = in[pos++];
+                px.a = in[pos++];
+            } else if ((op & kMask2) == kOpIndex) {
+                px = index[op];
+            } else if ((op & kMask2) == kOpDiff) {
+                px.r = static_cast<std::uint8_t>(px.r + ((op >> 4) & 0x03) - 2);
+                px.g = static_cast<std::uint8_t>(px.g + ((op >> 2) & 0x03) - 2);
+                px.b = static_cast<std::uint8_t>(px.b + (op & 0x03) - 2);
+            } else if ((op & kMask2) == kOpLuma) {
+                if (pos + 1 > chunksEnd)
+                    return false;
+                const std::uint8_t next = in[pos++];
+                const int dg = (op & 0x3f) - 32;
+                px.r = static_cast<std::uint8_t>(px.r + dg - 8 + ((next >> 4) & 0x0f));
+                px.g = static_cast<std::uint8_t>(px.g + dg);
+                px.b = static_cast<std::uint8_t>(px.b + dg - 8 + (next & 0x0f));
+            } else {
+                run = op & 0x3f;
+            }
+            index[indexOf(px)] = px;
+        } else {
+            return false;  // Ran out of chunks before every pixel was written.
+        }
+
+        std::uint8_t* out = rgba.data() + i * 4;
+        out[0] = px.r;
+        out[1] = px.g;
+        out[2] = px.b;
+        out[3] = channels == 4 ? px.a : 255;
+    }
+    size = { width, height };
+    return true;
+}
+
+bool decodeQoi(std::span<const std::byte> bytes, sf::Image& image) {
+    std::vector<std::uint8_t> rgba;
+    sf::Vector2u size;
+    if (!decodeQoi(bytes, rgba, size))
+        return false;
+    image = sf::Image(size, rgba.data());
+    return true;
+}
+
+bool decodeImage(std::span<const std::byte> bytes, sf::Image& image) {
+    if (isQoi(bytes))
+        return decodeQoi(bytes, image);
+    return image.loadFromMemory(bytes.data(), bytes.size());
+}
+
+} // namespace assets
@@ -0,0 +1,32 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>  // Provides std::byte for the encoded file.
+#include <cstdint>  // Reads and writes raw RGBA bytes as std::uint8_t.
+#include <span>     // Views the encoded bytes without copying them.
+#include <vector>   // Returns encoded files and decoded pixels.
+// === SFML Libraries ===
+#include <SFML/Graphics/Image.hpp>  // Wraps the decoded pixels for the texture upload.
+#include <SFML/System/Vector2.hpp>  // Carries the image size.
+
+// QOI ("Quite OK Image", qoiformat.org) codec for baked art. On our manifest textures it is
+// about the size of the PNGs (2% smaller in total; per file from 21% smaller to 35% larger)
+// but decodes about 3.4x faster, since there is no inflate step. glandular_bake --qoi writes
+// it; every image loader detects it by its magic and falls back to SFML otherwise.
+namespace assets {
+
+// True if bytes start with the "qoif" magic.
+bool isQoi(std::span<const std::byte> bytes);
+
+// Encodes size.x * size.y straight-alpha RGBA pixels.
+std::vector<std::byte> encodeQoi(const std::uint8_t* rgba, sf::Vector2u size);
+std::vector<std::byte> encodeQoi(const sf::Image& image);
+
+// Decodes into RGBA (3-channel files get opaque alpha). Returns false for truncated or
+// malformed data.
+bool decodeQoi(std::span<const std::byte> bytes, std::vector<std::uint8_t>& rgba, sf::Vector2u& size);
+bool decodeQoi(std::span<const std::byte> bytes, sf::Image& image);
+
+// Decodes QOI directly and anything else (PNG, JPEG, ...) through sf::Image::loadFromMemory.
+bool decodeImage(std::span<const std::byte> bytes, sf::Image& image);
+
+} // namespace assets
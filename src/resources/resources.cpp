@@ -1,847 +1,277 @@
 // === C++ Libraries ===
-#include <iostream>  // Logs asset-loading failures during Resources::loadAll.
+#include <algorithm>   // Skips icons that resolved to the same shared texture.
+#include <chrono>      // Polls scene sound decodes without blocking.
+#include <cstddef>     // Provides std::size_t for the manifest indexes.
+#include <cstdint>     // Declares the silent sample that stands in for a released sound.
+#include <iostream>    // Logs asset-loading failures and timing during Resources::loadAll.
 // === SFML Libraries ===
 #include <SFML/Graphics/Shader.hpp>
+#include <SFML/System/Clock.hpp>   // Measures how long the parallel load took.
 // === Header Files ===
 #include "resources.hpp"  // Declares Resources::loadAll and the stored asset handles.
-#include "resources/itemFiles.hpp"
+#include "resources/assetFiles.hpp"   // Opens files from the asset pack or the loose tree.
+#include "resources/bakedAssets.hpp"  // Prefers the downsampled copies written by glandular_bake.
 
-// Attempts to load every font/texture/audio asset required for the game.
-bool Resources::loadAll()
-{
-    // ---------------------------
-    //       === Fonts ===
-    // ---------------------------
-    if (!uiFont.openFromFile("assets/fonts/uiFont.ttf")) { // Font: Text Font
-        std::cout << "Failed to load uiFont.ttf\n"; return false;
-    }
-    if (!quizFont.openFromFile("assets/fonts/quizFont.ttf")) { // Font: Quiz Text
-        std::cout << "Failed to load quizFont.ttf\n"; return false;
-    }
-    if (!titleFont.openFromFile("assets/fonts/titleFont.otf")) { // Font: Front Layer
-        std::cout << "Failed to load titleFont.otf\n"; return false;
-    }
-    if (!titleFontExtrude.openFromFile("assets/fonts/titleFontExtrude.otf")) { // Font: Back Layer
-        std::cout << "Failed to load titleFontExtrude.otf\n"; return false;
-    }
-    if (!battleFont.openFromFile("assets/fonts/font.ttf")) { // Font: Battle UI
-        std::cout << "Failed to load font.ttf\n"; return false;
-    }
-    if (!battleFontBold.openFromFile("assets/fonts/fontBold.ttf")) { // Font: Battle UI
-        std::cout << "Failed to load font.ttf\n"; return false;
-    }
-    if (!introFont.openFromFile("assets/fonts/introFont.ttf")) { // Font: Important Message
-        std::cout << "Failed to load introFont.ttf\n"; return false;
-    }
-    // ---------------------------
-    //      === Textures ===
-    // ---------------------------
-    if (!introBackground.loadFromFile("assets/gfx/background.png")) { // Background Texture for Title
-        std::cout << "Failed to load Background Texture\n"; return false;
-    }
+namespace {
+// One row per font or music track: the Resources member it lands in, its path, and the name used in error messages.
+template <typename T>
+struct AssetEntry {
+    T Resources::* member;
+    const char* path;
+    const char* label;
+};
 
-    // ----------------------------
-    //         Item Textures
-    // ----------------------------
-    if (!dragonstoneAir.loadFromFile("assets/dragonstones/dragonstoneAir.png")) { // Item: Air Dragonstone
-        std::cout << "Failed to load Air Dragonstone Texture\n"; return false;
-    }
-    if (!dragonstoneEarth.loadFromFile("assets/dragonstones/dragonstoneEarth.png")) { // Item: Earth Dragonstone
-        std::cout << "Failed to load Earth Dragonstone Texture\n"; return false;
-    }
-    if (!dragonstoneFire.loadFromFile("assets/dragonstones/dragonstoneFire.png")) { // Item: Fire Dragonstone
-        std::cout << "Failed to load Fire Dragonstone Texture\n"; return false;
-    }
-    if (!dragonstoneWater.loadFromFile("assets/dragonstones/dragonstoneWater.png")) { // Item: Water Dragonstone
-        std::cout << "Failed to load Water Dragonstone Texture\n"; return false;
-    }
-    if (!weaponHolmabir.loadFromFile("assets/gfx/weapons/equipment/holmabir.png")) {
-        std::cout << "Failed to load Holmabir Equipment Texture\n"; return false;
-    }
-    if (!weaponHolmabirBroken.loadFromFile("assets/gfx/weapons/broken/holmabir_broken.png")) {
-        std::cout << "Failed to load Holmabir Broken Texture\n"; return false;
-    }
-    if (!weaponKattkavar.loadFromFile("assets/gfx/weapons/equipment/kattkavar_righthand.png")) {
-        std::cout << "Failed to load Kattkavar Equipment Texture (righthand)\n"; return false;
-    }
-    if (!weaponKattkavarLeft.loadFromFile("assets/gfx/weapons/equipment/kattkavar_lefthand.png")) {
-        std::cout << "Failed to load Kattkavar Equipment Texture (lefthand)\n"; return false;
-    }
-    if (!weaponKattkavarBroken.loadFromFile("assets/gfx/weapons/broken/kattkavar_broken.png")) {
-        std::cout << "Failed to load Kattkavar Broken Texture\n"; return false;
-    }
-    if (!weaponStiggedin.loadFromFile("assets/gfx/weapons/equipment/stiggedin_righthand.png")) {
-        std::cout << "Failed to load Stiggedin Equipment Texture (righthand)\n"; return false;
-    }
-    if (!weaponStiggedinLeft.loadFromFile("assets/gfx/weapons/equipment/stiggedin_lefthand.png")) {
-        std::cout << "Failed to load Stiggedin Equipment Texture (lefthand)\n"; return false;
-    }
-    if (!weaponStiggedinBroken.loadFromFile("assets/gfx/weapons/broken/stiggedin_broken.png")) {
-        std::cout << "Failed to load Stiggedin Broken Texture\n"; return false;
-    }
-    if (!healPotion.loadFromFile(ResourceFiles::Items::kHealPotionTexture)) { // Item: Healing Potion
-        std::cout << "Failed to load Healing Potion Texture\n"; return false;
-    }
-    if (!mapGlandular.loadFromFile("assets/gfx/items/map_glandular.png")) { // Item: Map of Glandular
-        std::cout << "Failed to load Map of Glandular Texture\n"; return false;
-    }
+// ---------------------------
+//       === Fonts ===
+// ---------------------------
+const AssetEntry<sf::Font> kFontAssets[] = {
+    { &Resources::uiFont, "assets/fonts/uiFont.ttf", "uiFont.ttf" }, // Font: Text Font
+    { &Resources::quizFont, "assets/fonts/quizFont.ttf", "quizFont.ttf" }, // Font: Quiz Text
+    { &Resources::titleFont, "assets/fonts/titleFont.otf", "titleFont.otf" }, // Font: Front Layer
+    { &Resources::titleFontExtrude, "assets/fonts/titleFontExtrude.otf", "titleFontExtrude.otf" }, // Font: Back Layer
+    { &Resources::battleFont, "assets/fonts/font.ttf", "font.ttf" }, // Font: Battle UI
+    { &Resources::battleFontBold, "assets/fonts/fontBold.ttf", "fontBold.ttf" }, // Font: Battle UI
+    { &Resources::introFont, "assets/fonts/introFont.ttf", "introFont.ttf" }, // Font: Important Message
+};
 
-    // ----------------------------
-    //      Character Textures
-    // ----------------------------
-    if (!airDragon.loadFromFile("assets/gfx/characters/gustavo_windimaess.png")) { // Char: Air Dragon » Gustavo Windimaess
-        std::cout << "Failed to load Air Dragon Texture\n"; return false;
-    }
-    if (!earthDragon.loadFromFile("assets/gfx/characters/grounded_claymore.png")) { // Char: Earth Dragon » Grounded Claymore
-        std::cout << "Failed to load Earth Dragon Texture\n"; return false;
-    }
-    if (!fireDragon.loadFromFile("assets/gfx/characters/rowsted_sheacane.png")) { // Char: Fire Dragon » Rowsted Shecane
-        std::cout << "Failed to load Fire Dragon Texture\n"; return false;
-    }
-    if (!waterDragon.loadFromFile("assets/gfx/characters/flawtin_seamen.png")) { // Char: Water Dragon » Flawtin Seamen
-        std::cout << "Failed to load Water Dragon Texture\n"; return false;
-    }
-    if (!dragonbornMaleSprite.loadFromFile("assets/gfx/characters/dragonborn/Dragonborn_Male.png")) { // Selectable Dragonborn Male
-        std::cout << "Failed to load Dragonborn Male Sprite\n"; return false;
-    }
-    if (!dragonbornFemaleSprite.loadFromFile("assets/gfx/characters/dragonborn/Dragonborn_Female.png")) { // Selectable Dragonborn Female
-        std::cout << "Failed to load Dragonborn Female Sprite\n"; return false;
-    }
-    if (!dragonbornMaleHoveredSprite.loadFromFile("assets/gfx/characters/dragonborn/Dragonborn_Male_Hovered.png")) { // Hovered Dragonborn Male
-        std::cout << "Failed to load Dragonborn Male Hover Sprite\n"; return false;
-    }
-    if (!dragonbornFemaleHoveredSprite.loadFromFile("assets/gfx/characters/dragonborn/Dragonborn_Female_Hovered.png")) { // Hovered Dragonborn Female
-        std::cout << "Failed to load Dragonborn Female Hover Sprite\n"; return false;
-    }
-    // ----------------------------
-    //      Character Portraits
-    // ----------------------------
-    if (!portraitStoryTeller.loadFromFile("assets/gfx/characters/tory_tailor.png")) { // Portrait: Tory Tailor
-        std::cout << "Failed to load Tory Tailor Portrait\n"; return false;
-    }
-    if (!portraitVillageElder.loadFromFile("assets/gfx/chars/portraits/portrait_noah_lott.png")) { // Portrait: Noah Lott
-        std::cout << "Failed to load Noah Lott Portrait\n"; return false;
-    }
-    if (!portraitVillageWanderer.loadFromFile("assets/gfx/chars/portraits/portrait_wanda_rinn.png")) { // Portrait: Wanda Rinn
-        std::cout << "Failed to load Village Wanderer Portrait\n"; return false;
-    }
-    if (!portraitBlacksmith.loadFromFile("assets/gfx/chars/portraits/portrait_will_figsid.png")) { // Portrait: Will Figsid
-        std::cout << "Failed to load Blacksmith Portrait\n"; return false;
-    }
-    if (!portraitNoahBates.loadFromFile("assets/gfx/characters/noah_bates.png")) { // Portrait: Noah Bates
-        std::cout << "Failed to load Noah Bates Portrait\n"; return false;
-    }
-    if (!portraitFireDragon.loadFromFile("assets/gfx/chars/portraits/portrait_rowsted_sheacane.png")) { // Portrait: Rowsted Sheacane
-        std::cout << "Failed to load Fire Dragon Portrait\n"; return false;
-    }
-    if (!portraitWaterDragon.loadFromFile("assets/gfx/chars/portraits/portrait_flawtin_seamen.png")) { // Portrait: Flawtin Seamen
-        std::cout << "Failed to load Water Dragon Portrait\n"; return false;
-    }
-    if (!portraitAirDragon.loadFromFile("assets/gfx/chars/portraits/portrait_gustavo_windimaess.png")) { // Portrait: Gustavo Windimaess
-        std::cout << "Failed to load Air Dragon Portrait\n"; return false;
-    }
-    if (!portraitEarthDragon.loadFromFile("assets/gfx/chars/portraits/portrait_grounded_claymore.png")) { // Portrait: Grounded Claymore
-        std::cout << "Failed to load Earth Dragon Portrait\n"; return false;
-    }
-    if (!portraitMasterBates.loadFromFile("assets/gfx/chars/portraits/portrait_master_bates.png")) { // Portrait: Master Bates
-        std::cout << "Failed to load Master Bates Portrait\n"; return false;
-    }
-    if (!portraitMasterBatesDragon.loadFromFile("assets/gfx/chars/portraits/portrait_master_bates_dragon.png")) { // Portrait: Master Bates (dragon form)
-        std::cout << "Failed to load Master Bates Dragon Portrait\n"; return false;
-    }
-    if (!portraitDragonbornMaleCape.loadFromFile("assets/gfx/chars/portraits/portrait_dragonborn_male_cape.png")) {
-        std::cout << "Failed to load Dragonborn Male Portrait (Cape)\n"; return false;
-    }
-    if (!portraitDragonbornMaleNoCape.loadFromFile("assets/gfx/chars/portraits/portrait_dragonborn_male_nocape.png")) {
-        std::cout << "Failed to load Dragonborn Male Portrait (No Cape)\n"; return false;
-    }
-    if (!portraitDragonbornFemaleCape.loadFromFile("assets/gfx/chars/portraits/portrait_dragonborn_female_cape.png")) {
-        std::cout << "Failed to load Dragonborn Female Portrait (Cape)\n"; return false;
-    }
-    if (!portraitDragonbornFemaleNoCape.loadFromFile("assets/gfx/chars/portraits/portrait_dragonborn_female_nocape.png")) {
-        std::cout << "Failed to load Dragonborn Female Portrait (No Cape)\n"; return false;
-    }
+// ---------------------------
+//       === Music ===
+// ---------------------------
+// Only the paths are stored; AudioManager streams the compressed files on demand.
+const AssetEntry<std::string> kMusicAssets[] = {
+    { &Resources::locationMusicAerobronchi, "assets/audio/locationMusicAerobronchi.mp3", "Aerobronchi Location Music" }, // Aerobronchi Location Sound
+    { &Resources::locationMusicBlyathyroid, "assets/audio/locationMusicBlyathyroid.mp3", "Blyathyroid Location Music" }, // Blyathyroid Location Sound
+    { &Resources::locationMusicCladrenal, "assets/audio/locationMusicCladrenal.mp3", "Cladrenal Location Music" }, // Cladrenal Location Sound
+    { &Resources::locationMusicPerigonal, "assets/audio/locationMusicPerigonal.mp3", "Perigonal Location Music" }, // Perigonal Location Sound
+    { &Resources::locationMusicBlacksmith, "assets/audio/LocationMusicBlacksmith.mp3", "Blacksmith Location Music" },
+    { &Resources::locationMusicGonad, "assets/audio/locationMusicGonad.mp3", "Gonad Location Music" }, // Gonad Location Sound
+    { &Resources::locationMusicLacrimere, "assets/audio/locationMusicLacrimere.mp3", "Lacrimere Location Music" }, // Lacrimere Location Sound
+    { &Resources::locationMusicSeminiferous, "assets/audio/locationMusicSeminiferous.mp3", "Seminiferous Location Music" }, // Seminiferous Location Sound
+    { &Resources::locationMusicUmbraOssea, "assets/audio/locationMusicUmbraOssea.mp3", "Umbra Ossea Location Music" }, // Umbra Ossea Location Sound
+    { &Resources::introTitle, "assets/audio/introTitle.mp3", "Intro Title Music" }, // Intro Title Sound
+    { &Resources::introDialogue, "assets/audio/introDialogue.mp3", "Intro Dialogue Music" }, // Intro Dialogue Sound
+};
 
-    // ----------------------------
-    //     Portrait Backgrounds
-    // ----------------------------
-    if (!portraitBackgroundAerobronchi.loadFromFile("assets/gfx/chars/portraitsBackground/portraitBackground_aerobronchi.png")) {
-        std::cout << "Failed to load Aerobronchi Portrait Background\n"; return false;
-    }
-    if (!portraitBackgroundBlacksmith.loadFromFile("assets/gfx/chars/portraitsBackground/portraitBackground_blacksmith.png")) {
-        std::cout << "Failed to load Blacksmith Portrait Background\n"; return false;
-    }
-    if (!portraitBackgroundBlyathyroid.loadFromFile("assets/gfx/chars/portraitsBackground/portraitBackground_blyathyroid.png")) {
-        std::cout << "Failed to load Blyathyroid Portrait Background\n"; return false;
-    }
-    if (!portraitBackgroundCladrenal.loadFromFile("assets/gfx/chars/portraitsBackground/portraitBackground_cladrenal.png")) {
-        std::cout << "Failed to load Cladrenal Portrait Background\n"; return false;
-    }
-    if (!portraitBackgroundGonad.loadFromFile("assets/gfx/chars/portraitsBackground/portraitBackground_gonad.png")) {
-        std::cout << "Failed to load Gonad Portrait Background\n"; return false;
-    }
-    if (!portraitBackgroundLacrimere.loadFromFile("assets/gfx/chars/portraitsBackground/portraitBackground_lacrimere.png")) {
-        std::cout << "Failed to load Lacrimere Portrait Background\n"; return false;
-    }
-    if (!portraitBackgroundPetrigonal.loadFromFile("assets/gfx/chars/portraitsBackground/portraitBackground_petrigonal.png")) {
-        std::cout << "Failed to load Petrigonal Portrait Background\n"; return false;
-    }
-    if (!portraitBackgroundSeminiferous.loadFromFile("assets/gfx/chars/portraitsBackground/portraitBackground_seminiferous.png")) {
-        std::cout << "Failed to load Seminiferous Portrait Background\n"; return false;
-    }
-    if (!portraitBackgroundUmbraOssea.loadFromFile("assets/gfx/chars/portraitsBackground/portraitBackground_umbra_ossea.png")) {
-        std::cout << "Failed to load Umbra Ossea Portrait Background\n"; return false;
-    }
-    if (!portraitBackgroundToryTailor.loadFromFile("assets/gfx/chars/portraitsBackground/portraitBackground_torytailor.png")) {
-        std::cout << "Failed to load Tory Tailor Portrait Background\n"; return false;
-    }
+// Textures and sound buffers come from src/resources/assets.manifest (see assetManifest.hpp).
 
-    // ----------------------------
-    //       Character Sprites
-    // ----------------------------
-    if (!spriteDragonbornBack.loadFromFile("assets/gfx/chars/sprites/dragonborn_backsprite.png")) {
-        std::cout << "Failed to load Dragonborn Back Sprite\n"; return false;
-    }
-    if (!spriteDragonbornFemaleBack.loadFromFile("assets/gfx/chars/sprites/dragonborn_female_backsprite.png")) {
-        std::cout << "Failed to load Dragonborn Female Back Sprite\n"; return false;
-    }
-    if (!spriteDragonbornMaleBack.loadFromFile("assets/gfx/chars/sprites/dragonborn_male_backsprite.png")) {
-        std::cout << "Failed to load Dragonborn Male Back Sprite\n"; return false;
-    }
-    if (!spriteDragonbornFemale.loadFromFile("assets/gfx/chars/sprites/dragonborn_female_sprite_cape.png")) {
-        std::cout << "Failed to load Dragonborn Female Sprite\n"; return false;
-    }
-    if (!spriteDragonbornMale.loadFromFile("assets/gfx/chars/sprites/dragonborn_male_sprite_cape.png")) {
-        std::cout << "Failed to load Dragonborn Male Sprite\n"; return false;
-    }
-    if (!spriteDragonbornFemaleNoCape.loadFromFile("assets/gfx/chars/sprites/dragonborn_female_sprite_nocape.png")) {
-        std::cout << "Failed to load Dragonborn Female No Cape Sprite\n"; return false;
-    }
-    if (!spriteDragonbornMaleNoCape.loadFromFile("assets/gfx/chars/sprites/dragonborn_male_sprite_nocape.png")) {
-        std::cout << "Failed to load Dragonborn Male No Cape Sprite\n"; return false;
-    }
-    if (!spriteDragonbornFemaleHovered.loadFromFile("assets/gfx/chars/sprites/dragonborn_female_sprite_cape_hovered.png")) {
-        std::cout << "Failed to load Dragonborn Female Hovered Sprite\n"; return false;
-    }
-    if (!spriteDragonbornMaleHovered.loadFromFile("assets/gfx/chars/sprites/dragonborn_male_sprite_cape_hovered.png")) {
-        std::cout << "Failed to load Dragonborn Male Hovered Sprite\n"; return false;
-    }
-    if (!spriteFlawtinSeamen.loadFromFile("assets/gfx/chars/sprites/flawtin_seamen_sprite.png")) {
-        std::cout << "Failed to load Flawtin Seamen Sprite\n"; return false;
-    }
-    if (!spriteFlawtinSeamenBack.loadFromFile("assets/gfx/chars/sprites/flawtin_seamen_backsprite.png")) {
-        std::cout << "Failed to load Flawtin Seamen Back Sprite\n"; return false;
-    }
-    if (!spriteGlandularCape.loadFromFile("assets/gfx/menu/character/glandular_cape.png")) {
-        std::cout << "Failed to load Glandular Cape Sprite\n"; return false;
-    }
-    if (!spriteGroundedClaymore.loadFromFile("assets/gfx/chars/sprites/grounded_claymore_sprite.png")) {
-        std::cout << "Failed to load Grounded Claymore Sprite\n"; return false;
-    }
-    if (!spriteGroundedClaymoreBack.loadFromFile("assets/gfx/chars/sprites/grounded_claymore_backsprite.png")) {
-        std::cout << "Failed to load Grounded Claymore Back Sprite\n"; return false;
-    }
-    if (!spriteGustavoWindimaess.loadFromFile("assets/gfx/chars/sprites/gustavo_windimaess_sprite.png")) {
-        std::cout << "Failed to load Gustavo Windimaess Sprite\n"; return false;
-    }
-    if (!spriteGustavoWindimaessBack.loadFromFile("assets/gfx/chars/sprites/gustavo_windimaess_backsprite.png")) {
-        std::cout << "Failed to load Gustavo Windimaess Back Sprite\n"; return false;
-    }
-    if (!spriteMasterBates.loadFromFile("assets/gfx/chars/sprites/master_bates_sprite.png")) {
-        std::cout << "Failed to load Master Bates Sprite\n"; return false;
-    }
-    if (!spriteMasterBatesDragon.loadFromFile("assets/gfx/chars/sprites/master_bates_dragon_sprite.png")) {
-        std::cout << "Failed to load Master Bates Dragon Sprite\n"; return false;
-    }
-    if (!spriteNoahLott.loadFromFile("assets/gfx/chars/sprites/noah_lott_sprite.png")) {
-        std::cout << "Failed to load Noah Lott Sprite\n"; return false;
-    }
-    if (!spriteNoahLottBack.loadFromFile("assets/gfx/chars/sprites/noah_lott_backsprite.png")) {
-        std::cout << "Failed to load Noah Lott Back Sprite\n"; return false;
-    }
-    if (!spriteRowstedSheacane.loadFromFile("assets/gfx/chars/sprites/rowsted_sheacane_sprite.png")) {
-        std::cout << "Failed to load Rowsted Sheacane Sprite\n"; return false;
-    }
-    if (!spriteRowstedSheacaneBack.loadFromFile("assets/gfx/chars/sprites/rowsted_sheacane_backsprite.png")) {
-        std::cout << "Failed to load Rowsted Sheacane Back Sprite\n"; return false;
-    }
-    if (!spriteWandaRinn.loadFromFile("assets/gfx/chars/sprites/wanda_rinn_sprite.png")) {
-        std::cout << "Failed to load Wanda Rinn Sprite\n"; return false;
-    }
-    if (!spriteWandaRinnBack.loadFromFile("assets/gfx/chars/sprites/wanda_rinn_backsprite.png")) {
-        std::cout << "Failed to load Wanda Rinn Back Sprite\n"; return false;
-    }
-    if (!spriteWillFigsid.loadFromFile("assets/gfx/chars/sprites/will_figsid_sprite.png")) {
-        std::cout << "Failed to load Will Figsid Sprite\n"; return false;
-    }
-    if (!spriteWillFigsidBack.loadFromFile("assets/gfx/chars/sprites/will_figsid_backsprite.png")) {
-        std::cout << "Failed to load Will Figsid Back Sprite\n"; return false;
-    }
+// A released scene sound keeps one silent sample: reloading a buffer in place keeps the
+// sf::Sound objects built on it attached, so Game's sounds survive the round trip.
+void emptySoundBuffer(sf::SoundBuffer& buffer) {
+    static constexpr std::int16_t kSilence = 0;
+    if (!buffer.loadFromSamples(&kSilence, 1, 1, 44100, { sf::SoundChannel::Mono }))
+        std::cout << "Failed to release sound buffer\n";
+}
 
-    // ---------------------------
-    //        Map Textures
-    // ---------------------------
-    if (!menuMapBackground.loadFromFile("assets/gfx/menu/map/Glandular.png")) {
-        std::cout << "Failed to load Menu Map Background (Glandular)\n"; return false;
-    }
-    if (!menuMapGonad.loadFromFile("assets/gfx/menu/map/Gonad.png")) {
-        std::cout << "Failed to load Menu Map Overlay (Gonad)\n"; return false;
-    }
-    if (!menuMapLacrimere.loadFromFile("assets/gfx/menu/map/Lacrimere.png")) {
-        std::cout << "Failed to load Menu Map Overlay (Lacrimere)\n"; return false;
-    }
-    if (!menuMapBlyathyroid.loadFromFile("assets/gfx/menu/map/Blyathyroid.png")) {
-        std::cout << "Failed to load Menu Map Overlay (Blyathyroid)\n"; return false;
-    }
-    if (!menuMapCladrenal.loadFromFile("assets/gfx/menu/map/Cladrenal.png")) {
-        std::cout << "Failed to load Menu Map Overlay (Cladrenal)\n"; return false;
-    }
-    if (!menuMapAerobronchi.loadFromFile("assets/gfx/menu/map/Aerobronchi.png")) {
-        std::cout << "Failed to load Menu Map Overlay (Aerobronchi)\n"; return false;
-    }
-    if (!menuMapPetrigonal.loadFromFile("assets/gfx/menu/map/Perigonal.png")) {
-        std::cout << "Failed to load Menu Map Overlay (Petrigonal)\n"; return false;
-    }
-    if (!menuMapUmbraOverlay.loadFromFile("assets/gfx/menu/map/Umbra Ossea.png")) {
-        std::cout << "Failed to load Menu Map Overlay (Umbra Ossea)\n"; return false;
-    }
-    if (!backgroundAerobronchi.loadFromFile("assets/gfx/background/background_aerobronchi.png")) {
-        std::cout << "Failed to load Background Aerobronchi\n"; return false;
-    }
-    if (!backgroundBlacksmith.loadFromFile("assets/gfx/background/background_blacksmith.png")) {
-        std::cout << "Failed to load Background Blacksmith\n"; return false;
-    }
-    if (!backgroundBlyathyroid.loadFromFile("assets/gfx/background/background_blyathyoid.png")) {
-        std::cout << "Failed to load Background Blyathyroid\n"; return false;
-    }
-    if (!backgroundCladrenal.loadFromFile("assets/gfx/background/background_cladrenal.png")) {
-        std::cout << "Failed to load Background Cladrenal\n"; return false;
-    }
-    if (!backgroundGonad.loadFromFile("assets/gfx/background/background_gonad.png")) {
-        std::cout << "Failed to load Background Gonad\n"; return false;
-    }
-    if (!backgroundLacrimere.loadFromFile("assets/gfx/background/background_lacrimere.png")) {
-        std::cout << "Failed to load Background Lacrimere\n"; return false;
-    }
-    if (!backgroundPetrigonal.loadFromFile("assets/gfx/background/background_petrigonal.png")) {
-        std::cout << "Failed to load Background Petrigonal\n"; return false;
-    }
-    if (!backgroundSeminiferous.loadFromFile("assets/gfx/background/background_seminiferous.png")) {
-        std::cout << "Failed to load Background Seminiferous\n"; return false;
-    }
-    if (!backgroundUmbraOssea.loadFromFile("assets/gfx/background/background_umbra_ossea.png")) {
-        std::cout << "Failed to load Background Umbra Ossea\n"; return false;
-    }
-    if (!backgroundToryTailor.loadFromFile("assets/gfx/background/background_torytailor.png")) {
-        std::cout << "Failed to load Background ToryTailor\n"; return false;
-    }
-    if (!battleBackgroundLayer.loadFromFile("assets/gfx/battleUI/battlebackground.png")) {
-        std::cout << "Failed to load battle background layer\n"; return false;
-    }
-    if (!battleBeginsGlandular.loadFromFile("assets/gfx/battleUI/battleBeginsGlandular.png")) {
-        std::cout << "Failed to load battle begins badge\n"; return false;
-    }
-    if (!battlePlayerPlatform.loadFromFile("assets/gfx/battleUI/playerPlatform.png")) {
-        std::cout << "Failed to load battle player platform\n"; return false;
-    }
-    if (!battleEnemyPlatform.loadFromFile("assets/gfx/battleUI/enemyPlatform.png")) {
-        std::cout << "Failed to load battle enemy platform\n"; return false;
-    }
-    if (!battleTextBox.loadFromFile("assets/gfx/battleUI/textBox.png")) {
-        std::cout << "Failed to load battle text box\n"; return false;
-    }
-    if (!battleActionBox.loadFromFile("assets/gfx/battleUI/actionBox.png")) {
-        std::cout << "Failed to load battle action box\n"; return false;
-    }
-    if (!battlePlayerBox.loadFromFile("assets/gfx/battleUI/playerBox.png")) {
-        std::cout << "Failed to load battle player box\n"; return false;
-    }
-    if (!battleEnemyBox.loadFromFile("assets/gfx/battleUI/enemyBox.png")) {
-        std::cout << "Failed to load battle enemy box\n"; return false;
-    }
-    if (!battleIconMale.loadFromFile("assets/gfx/battleUI/icon_male.png")) {
-        std::cout << "Failed to load battle male icon\n"; return false;
-    }
-    if (!battleIconFemale.loadFromFile("assets/gfx/battleUI/icon_female.png")) {
-        std::cout << "Failed to load battle female icon\n"; return false;
-    }
-    if (!skillSlashAir.loadFromFile("assets/gfx/menu/skills/skill_slash_air.png")) {
-        std::cout << "Failed to load skill slash air texture\n"; return false;
-    }
-    if (!skillSlashEarth.loadFromFile("assets/gfx/menu/skills/skill_slash_earth.png")) {
-        std::cout << "Failed to load skill slash earth texture\n"; return false;
-    }
-    if (!skillSlashFire.loadFromFile("assets/gfx/menu/skills/skill_slash_fire.png")) {
-        std::cout << "Failed to load skill slash fire texture\n"; return false;
-    }
-    if (!skillSlashWater.loadFromFile("assets/gfx/menu/skills/skill_slash_water.png")) {
-        std::cout << "Failed to load skill slash water texture\n"; return false;
-    }
-    if (!skillWeaponAir.loadFromFile("assets/gfx/menu/skills/skill_weapon_air.png")) {
-        std::cout << "Failed to load skill weapon air texture\n"; return false;
-    }
-    if (!skillWeaponEarth.loadFromFile("assets/gfx/menu/skills/skill_weapon_earth.png")) {
-        std::cout << "Failed to load skill weapon earth texture\n"; return false;
-    }
-    if (!skillWeaponFire.loadFromFile("assets/gfx/menu/skills/skill_weapon_fire.png")) {
-        std::cout << "Failed to load skill weapon fire texture\n"; return false;
-    }
-    if (!skillWeaponWater.loadFromFile("assets/gfx/menu/skills/skill_weapon_water.png")) {
-        std::cout << "Failed to load skill weapon water texture\n"; return false;
-    }
-    if (!skillMasterBatesPowerup.loadFromFile("assets/gfx/menu/skills/skill_master_bates_powerup.png")) {
-        std::cout << "Failed to load Master Bates powerup texture\n"; return false;
-    }
-    if (!skillMasterBatesMidnightRelease.loadFromFile("assets/gfx/menu/skills/skill_master_bates_midnight_release.png")) {
-        std::cout << "Failed to load Master Bates Midnight Release texture\n"; return false;
-    }
-    if (!skillMasterBatesBadHabit.loadFromFile("assets/gfx/menu/skills/skill_master_bates_bad_habit.png")) {
-        std::cout << "Failed to load Master Bates Bad Habit texture\n"; return false;
-    }
-    if (!skillMasterBatesShadowRoutine.loadFromFile("assets/gfx/menu/skills/skill_master_bates_shadow_routine.png")) {
-        std::cout << "Failed to load Master Bates Shadow Routine texture\n"; return false;
-    }
-    if (!skillMasterBatesGuiltyEmber.loadFromFile("assets/gfx/menu/skills/skill_master_bates_guilty_ember.png")) {
-        std::cout << "Failed to load Master Bates Guilty Ember texture\n"; return false;
+// Largest edge of an atlas cell. Menu slots draw icons at up to ~80px, so this leaves
+// headroom for larger windows while 70 icons still share a single 2048px page.
+constexpr unsigned int kIconCellSize = 160;
+} // namespace
+
+// Opens every font up front so the loading screen can draw text while the rest decodes.
+bool Resources::loadFonts() {
+    for (const auto& asset : kFontAssets) {
+        if (!assets::openFont(this->*asset.member, asset.path)) {
+            std::cout << "Failed to load " << asset.label << "\n";
+            return false;
+        }
+        if (assets::usageTracer().enabled())
+            assets::usageTracer().registerFont(this->*asset.member, asset.path);
     }
-    if (!hpBadgeShader.loadFromFile("assets/shaders/hp_badge.frag", sf::Shader::Type::Fragment)) {
+    return true;
+}
+
+// Attempts to load every font/texture/audio asset required for the game.
+bool Resources::loadAll(unsigned int threadCount, const assets::ProgressCallback& onProgress)
+{
+    if (!loadFonts())
+        return false;
+
+    // Shaders compile against the GL context, so they stay on the calling thread.
+    if (!assets::loadShader(hpBadgeShader, "assets/shaders/hp_badge.frag", sf::Shader::Type::Fragment)) {
         std::cout << "Failed to load hp badge shader\n"; return false;
     }
     hpBadgeShader.setUniform("texture", sf::Shader::CurrentTexture);
     hpBadgeShader.setUniform("diagonal", 0.25f);
-    if (!treasureChestAir.loadFromFile("assets/gfx/trophies/treasure_chest_air.png")) {
-        std::cout << "Failed to load treasure_chest_air.png\n"; return false;
-    }
-    if (!treasureChestEarth.loadFromFile("assets/gfx/trophies/treasure_chest_earth.png")) {
-        std::cout << "Failed to load treasure_chest_earth.png\n"; return false;
-    }
-    if (!treasureChestFire.loadFromFile("assets/gfx/trophies/treasure_chest_fire.png")) {
-        std::cout << "Failed to load treasure_chest_fire.png\n"; return false;
-    }
-    if (!treasureChestWater.loadFromFile("assets/gfx/trophies/treasure_chest_water.png")) {
-        std::cout << "Failed to load treasure_chest_water.png\n"; return false;
-    }
-    if (!trophyDragoncupAir.loadFromFile("assets/gfx/trophies/dragoncup_air.png")) {
-        std::cout << "Failed to load dragoncup_air.png\n"; return false;
-    }
-    if (!trophyDragoncupEarth.loadFromFile("assets/gfx/trophies/dragoncup_earth.png")) {
-        std::cout << "Failed to load dragoncup_earth.png\n"; return false;
-    }
-    if (!trophyDragoncupFire.loadFromFile("assets/gfx/trophies/dragoncup_fire.png")) {
-        std::cout << "Failed to load dragoncup_fire.png\n"; return false;
-    }
-    if (!trophyDragoncupWater.loadFromFile("assets/gfx/trophies/dragoncup_water.png")) {
-        std::cout << "Failed to load dragoncup_water.png\n"; return false;
-    }
-    if (!trophyDragoncupUmbra.loadFromFile("assets/gfx/trophies/dragoncup_umbra.png")) {
-        std::cout << "Failed to load dragoncup_umbra.png\n"; return false;
-    }
-    if (!emblemSoul.loadFromFile("assets/gfx/trophies/emblem_soul.png")) {
-        std::cout << "Failed to load emblem_soul.png\n"; return false;
-    }
-    if (!emblemBody.loadFromFile("assets/gfx/trophies/emblem_body.png")) {
-        std::cout << "Failed to load emblem_body.png\n"; return false;
-    }
-    if (!emblemResolve.loadFromFile("assets/gfx/trophies/emblem_resolve.png")) {
-        std::cout << "Failed to load emblem_resolve.png\n"; return false;
-    }
-    if (!emblemMind.loadFromFile("assets/gfx/trophies/emblem_mind.png")) {
-        std::cout << "Failed to load emblem_mind.png\n"; return false;
-    }
-    if (!emblemAscension.loadFromFile("assets/gfx/trophies/emblem_ascension.png")) {
-        std::cout << "Failed to load emblem_ascension.png\n"; return false;
-    }
-    if (!umbraUsseaOne.loadFromFile("assets/gfx/menu/map/Umbra_Ussea_one.png")) {
-        std::cout << "Failed to load Umbra_Ussea_one.png\n"; return false;
-    }
-    if (!umbraUsseaTwo.loadFromFile("assets/gfx/menu/map/Umbra_Ussea_two.png")) {
-        std::cout << "Failed to load Umbra_Ussea_two.png\n"; return false;
-    }
-    if (!umbraUsseaThree.loadFromFile("assets/gfx/menu/map/Umbra_Ussea_three.png")) {
-        std::cout << "Failed to load Umbra_Ussea_three.png\n"; return false;
-    }
-    if (!umbraUsseaFour.loadFromFile("assets/gfx/menu/map/Umbra_Ussea_four.png")) {
-        std::cout << "Failed to load Umbra_Ussea_four.png\n"; return false;
-    }
-    if (!umbraUsseaComplete.loadFromFile("assets/gfx/menu/map/Umbra_Ussea.png")) {
-        std::cout << "Failed to load Umbra_Ussea.png\n"; return false;
-    }
-    if (!creditActAsha.loadFromFile("assets/gfx/chars/credits/act_asha.png")) {
-        std::cout << "Failed to load act_asha.png\n"; return false;
-    }
-    if (!creditActEmber.loadFromFile("assets/gfx/chars/credits/act_ember.png")) {
-        std::cout << "Failed to load act_ember.png\n"; return false;
-    }
-    if (!creditActBates.loadFromFile("assets/gfx/chars/credits/act_bates.png")) {
-        std::cout << "Failed to load act_bates.png\n"; return false;
-    }
-    if (!creditActBatesDragon.loadFromFile("assets/gfx/chars/credits/act_bates_dragon.png")) {
-        std::cout << "Failed to load act_bates_dragon.png\n"; return false;
-    }
-    if (!creditActNoah.loadFromFile("assets/gfx/chars/credits/act_noah.png")) {
-        std::cout << "Failed to load act_noah.png\n"; return false;
-    }
-    if (!creditActWanda.loadFromFile("assets/gfx/chars/credits/act_wanda.png")) {
-        std::cout << "Failed to load act_wanda.png\n"; return false;
-    }
-    if (!creditActWill.loadFromFile("assets/gfx/chars/credits/act_will.png")) {
-        std::cout << "Failed to load act_will.png\n"; return false;
-    }
-    if (!creditActFlawtin.loadFromFile("assets/gfx/chars/credits/act_flawtin.png")) {
-        std::cout << "Failed to load act_flawtin.png\n"; return false;
-    }
-    if (!creditActGrounded.loadFromFile("assets/gfx/chars/credits/act_grounded.png")) {
-        std::cout << "Failed to load act_grounded.png\n"; return false;
-    }
-    if (!creditActGustavo.loadFromFile("assets/gfx/chars/credits/act_gustavo.png")) {
-        std::cout << "Failed to load act_gustavo.png\n"; return false;
-    }
-    if (!creditActRowsted.loadFromFile("assets/gfx/chars/credits/act_rowsted.png")) {
-        std::cout << "Failed to load act_rowsted.png\n"; return false;
-    }
-    if (!creditActTory.loadFromFile("assets/gfx/chars/credits/act_tory.png")) {
-        std::cout << "Failed to load act_tory.png\n"; return false;
-    }
-    if (!creditActKensen.loadFromFile("assets/gfx/chars/credits/act_kensen.png")) {
-        std::cout << "Failed to load act_kensen.png\n"; return false;
-    }
-    if (!creditBetaTesterAlex.loadFromFile("assets/gfx/chars/credits/beta_tester_alex.png")) {
-        std::cout << "Failed to load beta_tester_alex.png\n"; return false;
-    }
-    if (!returnSymbol.loadFromFile("assets/textures/returnSymbol.png")) { // Return Symbol
-        std::cout << "Failed to load Return Symbol Texture\n"; return false;
-    }
-    if (!boxBorder.loadFromFile("assets/textures/boxBorder.png")) { // boxBordet Asset
-        std::cout << "Failed to load Box Border Texture\n"; return false;
-    }
-    if (!dividerLeft.loadFromFile("assets/textures/divider_left.png")) {
-        std::cout << "Failed to load Divider Left Texture\n"; return false;
-    }
-    if (!dividerRight.loadFromFile("assets/textures/divider_right.png")) {
-        std::cout << "Failed to load Divider Right Texture\n"; return false;
-    }
-    if (!menuButton.loadFromFile("assets/gfx/buttons/button_menu.png")) {
-        std::cout << "Failed to load Menu Button Texture\n"; return false;
-    }
-    if (!buttonInventory.loadFromFile("assets/gfx/buttons/button_inventory.png")) {
-        std::cout << "Failed to load Inventory Button Texture\n"; return false;
-    }
-    if (!buttonSkills.loadFromFile("assets/gfx/buttons/button_skills.png")) {
-        std::cout << "Failed to load Skills Button Texture\n"; return false;
-    }
-    if (!buttonCharacter.loadFromFile("assets/gfx/buttons/button_character.png")) {
-        std::cout << "Failed to load Character Button Texture\n"; return false;
-    }
-    if (!buttonMap.loadFromFile("assets/gfx/buttons/button_map.png")) {
-        std::cout << "Failed to load Map Button Texture\n"; return false;
-    }
-    if (!buttonQuests.loadFromFile("assets/gfx/buttons/button_quests.png")) {
-        std::cout << "Failed to load Quests Button Texture\n"; return false;
-    }
-    if (!buttonSettings.loadFromFile("assets/gfx/buttons/button_settings.png")) {
-        std::cout << "Failed to load Settings Button Texture\n"; return false;
-    }
-    if (!buttonRankings.loadFromFile("assets/gfx/buttons/button_rankings.png")) {
-        std::cout << "Failed to load Rankings Button Texture\n"; return false;
-    }
-    if (!elementAirButton.loadFromFile("assets/gfx/buttons/element_air.png")) {
-        std::cout << "Failed to load Element Air Button\n"; return false;
-    }
-    if (!elementEarthButton.loadFromFile("assets/gfx/buttons/element_earth.png")) {
-        std::cout << "Failed to load Element Earth Button\n"; return false;
-    }
-    if (!elementFireButton.loadFromFile("assets/gfx/buttons/element_fire.png")) {
-        std::cout << "Failed to load Element Fire Button\n"; return false;
-    }
-    if (!elementWaterButton.loadFromFile("assets/gfx/buttons/element_water.png")) {
-        std::cout << "Failed to load Element Water Button\n"; return false;
-    }
-    if (!equipmentRingAir.loadFromFile("assets/gfx/menu/equipment/ring_air.png")) {
-        std::cout << "Failed to load Equipment Ring Air icon\n"; return false;
-    }
-    if (!equipmentRingEarth.loadFromFile("assets/gfx/menu/equipment/ring_earth.png")) {
-        std::cout << "Failed to load Equipment Ring Earth icon\n"; return false;
-    }
-    if (!equipmentRingFire.loadFromFile("assets/gfx/menu/equipment/ring_fire.png")) {
-        std::cout << "Failed to load Equipment Ring Fire icon\n"; return false;
-    }
-    if (!equipmentRingWater.loadFromFile("assets/gfx/menu/equipment/ring_water.png")) {
-        std::cout << "Failed to load Equipment Ring Water icon\n"; return false;
-    }
-    if (!questbookBackground.loadFromFile("assets/gfx/menu/quests/questbook.png")) {
-        std::cout << "Failed to load Questbook Background\n"; return false;
-    }
-    if (!skilltree.loadFromFile("assets/gfx/menu/skills/skilltree.png")) {
-        std::cout << "Failed to load Skilltree Texture\n"; return false;
-    }
-    if (!skillbar.loadFromFile("assets/gfx/menu/skills/Skillbar_DarkPurple.png")) {
-        std::cout << "Failed to load Skillbar Texture\n"; return false;
-    }
-    if (!buttonHelp.loadFromFile("assets/gfx/buttons/button_help.png")) {
-        std::cout << "Failed to load Help Button Texture\n"; return false;
-    }
 
-    // ----------------------------
-    //   Character menu assets
-    // ----------------------------
-    if (!charMenuLeftHand.loadFromFile("assets/gfx/menu/character/charMenu_lefthand.png")) {
-        std::cout << "Failed to load Character menu left hand slot\n"; return false;
-    }
-    if (!charMenuRightHand.loadFromFile("assets/gfx/menu/character/charMenu_righthand.png")) {
-        std::cout << "Failed to load Character menu right hand slot\n"; return false;
-    }
-    if (!charMenuRing.loadFromFile("assets/gfx/menu/character/charMenu_ring.png")) {
-        std::cout << "Failed to load Character menu ring slot\n"; return false;
-    }
-    if (!charMenuDragonstoneSlot.loadFromFile("assets/gfx/menu/character/charMenu_dragonstone.png")) {
-        std::cout << "Failed to load Character menu dragonstone slot\n"; return false;
-    }
-    if (!charMenuDragonclawSlot.loadFromFile("assets/gfx/menu/character/charMenu_dragonclaw.png")) {
-        std::cout << "Failed to load Character menu dragonclaw slot\n"; return false;
-    }
-    if (!charMenuDragonscaleSlot.loadFromFile("assets/gfx/menu/character/charMenu_dragonscale.png")) {
-        std::cout << "Failed to load Character menu dragonscale slot\n"; return false;
-    }
-    if (!charMenuLuckyCharmSlot.loadFromFile("assets/gfx/menu/character/charMenu_luckycharm.png")) {
-        std::cout << "Failed to load Character menu lucky charm slot\n"; return false;
-    }
-    if (!charMenuFemaleNoCape.loadFromFile("assets/gfx/menu/character/charMenu_female_nocape.png")) {
-        std::cout << "Failed to load Character menu female base portrait\n"; return false;
-    }
-    if (!charMenuMaleNoCape.loadFromFile("assets/gfx/menu/character/charMenu_male_nocape.png")) {
-        std::cout << "Failed to load Character menu male base portrait\n"; return false;
-    }
-    if (!charMenuFemaleCape.loadFromFile("assets/gfx/menu/character/charMenu_female_cape.png")) {
-        std::cout << "Failed to load Character menu female cloak portrait\n"; return false;
-    }
-    if (!charMenuMaleCape.loadFromFile("assets/gfx/menu/character/charMenu_male_cape.png")) {
-        std::cout << "Failed to load Character menu male cloak portrait\n"; return false;
-    }
-    if (!charMenuCloak.loadFromFile("assets/gfx/menu/character/glandular_cape.png")) {
-        std::cout << "Failed to load Character menu cloak icon\n"; return false;
+    // Cached textures load on first use, so only make sure the files are there.
+    for (std::size_t i = 0; i < assets::kTextureCount; ++i) {
+        const auto& asset = assets::kTextureManifest[i];
+        if (!asset.cached)
+            continue;
+        if (!assets::assetExists(asset.path)) {
+            std::cout << "Failed to load " << asset.label << "\n";
+            return false;
+        }
+        textureHandles[i] = textures.add(assets::resolveAssetPath(asset.path), asset.label, asset.trimMargins);
     }
 
-    // ----------------------------
-    //      Artifact icons
-    // ----------------------------
-    if (!artifactDragonscaleAir.loadFromFile("assets/gfx/menu/artifacts/dragonscale/dragonscale_air.png")) {
-        std::cout << "Failed to load Dragonscale Air icon\n"; return false;
-    }
-    if (!artifactDragonscaleEarth.loadFromFile("assets/gfx/menu/artifacts/dragonscale/dragonscale_earth.png")) {
-        std::cout << "Failed to load Dragonscale Earth icon\n"; return false;
-    }
-    if (!artifactDragonscaleFire.loadFromFile("assets/gfx/menu/artifacts/dragonscale/dragonscale_fire.png")) {
-        std::cout << "Failed to load Dragonscale Fire icon\n"; return false;
-    }
-    if (!artifactDragonscaleWater.loadFromFile("assets/gfx/menu/artifacts/dragonscale/dragonscale_water.png")) {
-        std::cout << "Failed to load Dragonscale Water icon\n"; return false;
-    }
-    if (!artifactDragonstoneAir.loadFromFile("assets/gfx/menu/artifacts/dragonstone/dragonstone_air.png")) {
-        std::cout << "Failed to load Dragonstone Air icon\n"; return false;
-    }
-    if (!artifactDragonstoneEarth.loadFromFile("assets/gfx/menu/artifacts/dragonstone/dragonstone_earth.png")) {
-        std::cout << "Failed to load Dragonstone Earth icon\n"; return false;
-    }
-    if (!artifactDragonstoneFire.loadFromFile("assets/gfx/menu/artifacts/dragonstone/dragonstone_fire.png")) {
-        std::cout << "Failed to load Dragonstone Fire icon\n"; return false;
-    }
-    if (!artifactDragonstoneWater.loadFromFile("assets/gfx/menu/artifacts/dragonstone/dragonstone_water.png")) {
-        std::cout << "Failed to load Dragonstone Water icon\n"; return false;
-    }
-    if (!artifactDragonclawAir.loadFromFile("assets/gfx/menu/artifacts/dragonclaw/dragonclaw_air.png")) {
-        std::cout << "Failed to load Dragonclaw Air icon\n"; return false;
-    }
-    if (!artifactDragonclawEarth.loadFromFile("assets/gfx/menu/artifacts/dragonclaw/dragonclaw_earth.png")) {
-        std::cout << "Failed to load Dragonclaw Earth icon\n"; return false;
-    }
-    if (!artifactDragonclawFire.loadFromFile("assets/gfx/menu/artifacts/dragonclaw/dragonclaw_fire.png")) {
-        std::cout << "Failed to load Dragonclaw Fire icon\n"; return false;
-    }
-    if (!artifactDragonclawWater.loadFromFile("assets/gfx/menu/artifacts/dragonclaw/dragonclaw_water.png")) {
-        std::cout << "Failed to load Dragonclaw Water icon\n"; return false;
-    }
-    if (!artifactLuckyCharmAir.loadFromFile("assets/gfx/menu/artifacts/luckycharm/luckyCharm_air.png")) {
-        std::cout << "Failed to load Lucky Charm Air icon\n"; return false;
-    }
-    if (!artifactLuckyCharmEarth.loadFromFile("assets/gfx/menu/artifacts/luckycharm/luckyCharm_earth.png")) {
-        std::cout << "Failed to load Lucky Charm Earth icon\n"; return false;
-    }
-    if (!artifactLuckyCharmFire.loadFromFile("assets/gfx/menu/artifacts/luckycharm/luckyCharm_fire.png")) {
-        std::cout << "Failed to load Lucky Charm Fire icon\n"; return false;
-    }
-    if (!artifactLuckyCharmWater.loadFromFile("assets/gfx/menu/artifacts/luckycharm/luckyCharm_water.png")) {
-        std::cout << "Failed to load Lucky Charm Water icon\n"; return false;
+    // Music is streamed later, so just make sure every track is there before play starts.
+    for (const auto& asset : kMusicAssets) {
+        if (!assets::assetExists(asset.path)) {
+            std::cout << "Failed to load " << asset.label << "\n";
+            return false;
+        }
+        this->*asset.member = asset.path;
+        if (assets::usageTracer().enabled())
+            assets::usageTracer().registerMusic(asset.path, asset.label);
     }
 
-    // ---------------------------
-    //       === Sounds ===
-    // ---------------------------
-    if (!acquire.loadFromFile("assets/audio/acquire.wav")) { // Acquiring Item
-        std::cout << "Failed to load Acquire Sound\n"; return false;
-    }
-    if (!confirm.loadFromFile("assets/audio/confirm.mp3")) { // Confirm Choice
-        std::cout << "Failed to load Confirm Sound\n"; return false;
-    }
-    if (!enterKey.loadFromFile("assets/audio/enterKey.mp3")) { // Pressing Enter Key
-        std::cout << "Failed to load Enter Key Sound\n"; return false;
-    }
-    if (!typewriter.loadFromFile("assets/audio/typewriter.mp3")) { // isTyping Sound
-        std::cout << "Failed to load Typewriter Sound\n"; return false;
-    }
-    if (!reject.loadFromFile("assets/audio/reject.mp3")) { // Reject Choice
-        std::cout << "Failed to load Reject Sound\n"; return false;
+    sf::Clock loadClock;
+    assets::ParallelLoader loader(threadCount);
+    // Every bounds slot is created before the workers start, so the map never rehashes under them.
+    for (std::size_t i = 0; i < assets::kTextureCount; ++i) {
+        const auto& asset = assets::kTextureManifest[i];
+        if (asset.cached)
+            continue;
+        sf::Texture& texture = loadedTextures[i];
+        loader.addTexture(texture, assets::resolveAssetPath(asset.path), asset.label, &textureBounds[&texture], &sharedTextures[i],
+                          asset.lod);
+    }
+    for (std::size_t i = 0; i < assets::kSoundCount; ++i) {
+        const auto& asset = assets::kSoundManifest[i];
+        if (assets::isSceneGroup(asset.group)) {
+            // Decoded by acquire(); only make sure the file is there.
+            if (!assets::assetExists(asset.path)) {
+                std::cout << "Failed to load " << asset.label << "\n";
+                return false;
+            }
+            continue;
+        }
+        loader.addSound(soundBuffers[i], asset.path, asset.label, &sharedSounds[i]);
     }
-    if (!startGame.loadFromFile("assets/audio/startGame.mp3")) { // Start Game
-        std::cout << "Failed to load Start Game Sound\n"; return false;
-    }
-    if (!teleportStart.loadFromFile("assets/audio/teleport_start.mp3")) { // Teleport Start
-        std::cout << "Failed to load Teleport Start Sound\n"; return false;
-    }
-    if (!teleportMiddle.loadFromFile("assets/audio/teleport_middle.mp3")) { // Teleport Middle
-        std::cout << "Failed to load Teleport Middle Sound\n"; return false;
-    }
-    if (!teleportStop.loadFromFile("assets/audio/teleport_stop.mp3")) { // Teleport Stop
-        std::cout << "Failed to load Teleport Stop Sound\n"; return false;
-    }
-    if (!healSound.loadFromFile(ResourceFiles::Items::kHealPotionSound)) { // Heal Potion Sound
-        std::cout << "Failed to load Heal Potion Sound\n"; return false;
-    }
-    if (!skillSlash.loadFromFile("assets/audio/skill_slash.mp3")) {
-        std::cout << "Failed to load Skill Slash Sound\n"; return false;
-    }
-    if (!skillAir.loadFromFile("assets/audio/skill_air.mp3")) {
-        std::cout << "Failed to load Air Skill Sound\n"; return false;
-    }
-    if (!skillEarth.loadFromFile("assets/audio/skill_earth.mp3")) {
-        std::cout << "Failed to load Earth Skill Sound\n"; return false;
-    }
-    if (!skillFire.loadFromFile("assets/audio/skill_fire.mp3")) {
-        std::cout << "Failed to load Fire Skill Sound\n"; return false;
-    }
-    if (!skillWater.loadFromFile("assets/audio/skill_water.mp3")) {
-        std::cout << "Failed to load Water Skill Sound\n"; return false;
-    }
-    if (!skillFriendship.loadFromFile("assets/audio/skill_friendship.mp3")) {
-        std::cout << "Failed to load Friendship Skill Sound\n"; return false;
-    }
-    if (!skillPowerUp.loadFromFile("assets/audio/skill_power_up.mp3")) {
-        std::cout << "Failed to load Master Bates powerup sound\n"; return false;
-    }
-    if (!chickSound.loadFromFile("assets/audio/chick_sound.mp3")) {
-        std::cout << "Failed to load Master Bates chick sound\n"; return false;
-    }
-    if (!awwSound.loadFromFile("assets/audio/aww_sound.mp3")) {
-        std::cout << "Failed to load Master Bates dragon sound\n"; return false;
-    }
-    if (!skillMidnightRelease.loadFromFile("assets/audio/skill_midnight_release.mp3")) {
-        std::cout << "Failed to load Midnight Release Sound\n"; return false;
-    }
-    if (!skillBadHabit.loadFromFile("assets/audio/skill_bad_habit.mp3")) {
-        std::cout << "Failed to load Bad Habit Sound\n"; return false;
-    }
-    if (!skillShadowRoutine.loadFromFile("assets/audio/skill_shadow_routine.mp3")) {
-        std::cout << "Failed to load Shadow Routine Sound\n"; return false;
-    }
-    if (!skillGuiltyEmber.loadFromFile("assets/audio/skill_guilty_ember.mp3")) {
-        std::cout << "Failed to load Guilty Ember Sound\n"; return false;
-    }
-    if (!masterBatesEvolution.loadFromFile("assets/audio/master_bates_evolution.mp3")) {
-        std::cout << "Failed to load Master Bates Evolution Sound\n"; return false;
-    }
-    if (!forgeSound.loadFromFile("assets/audio/forgeSound.mp3")) { // Forge Sleep Sound
-        std::cout << "Failed to load Forge Sound\n"; return false;
-    }
-    if (!levelUp.loadFromFile("assets/audio/level_up.mp3")) {
-        std::cout << "Failed to load Level Up Sound\n"; return false;
-    }
-    if (!locationMusicAerobronchi.loadFromFile("assets/audio/locationMusicAerobronchi.mp3")) { // Aerobronchi Location Sound
-        std::cout << "Failed to load Aerobronchi Location Music\n"; return false;
-    }
-    if (!locationMusicBlyathyroid.loadFromFile("assets/audio/locationMusicBlyathyroid.mp3")) { // Blyathyroid Location Sound
-        std::cout << "Failed to load Blyathyroid Location Music\n"; return false;
-    }
-    if (!locationMusicCladrenal.loadFromFile("assets/audio/locationMusicCladrenal.mp3")) { // Cladrenal Location Sound
-        std::cout << "Failed to load Cladrenal Location Music\n"; return false;
-    }
-    if (!locationMusicPerigonal.loadFromFile("assets/audio/locationMusicPerigonal.mp3")) { // Perigonal Location Sound
-        std::cout << "Failed to load Perigonal Location Music\n"; return false;
-    }
-    if (!locationMusicBlacksmith.loadFromFile("assets/audio/LocationMusicBlacksmith.mp3")) {
-        std::cout << "Failed to load Blacksmith Location Music\n"; return false;
-    }
-    if (!locationMusicGonad.loadFromFile("assets/audio/locationMusicGonad.mp3")) { // Gonad Location Sound
-        std::cout << "Failed to load Gonad Location Music\n"; return false;
-    }
-    if (!locationMusicLacrimere.loadFromFile("assets/audio/locationMusicLacrimere.mp3")) { // Lacrimere Location Sound
-        std::cout << "Failed to load Lacrimere Location Music\n"; return false;
-    }
-    if (!locationMusicSeminiferous.loadFromFile("assets/audio/locationMusicSeminiferous.mp3")) { // Seminiferous Location Sound
-        std::cout << "Failed to load Seminiferous Location Music\n"; return false;
-    }
-    if (!locationMusicUmbraOssea.loadFromFile("assets/audio/locationMusicUmbraOssea.mp3")) { // Umbra Ossea Location Sound
-        std::cout << "Failed to load Umbra Ossea Location Music\n"; return false;
-    }
-    if (!questStart.loadFromFile("assets/audio/quest_start.mp3")) {
-        std::cout << "Failed to load Quest Start Sound\n"; return false;
-    }
-    if (!questEnd.loadFromFile("assets/audio/quest_end.mp3")) {
-        std::cout << "Failed to load Quest End Sound\n"; return false;
-    }
-    if (!introTitle.loadFromFile("assets/audio/introTitle.mp3")) { // Intro Title Sound
-        std::cout << "Failed to load Intro Title Music\n"; return false;
-    }
-    if (!introDialogue.loadFromFile("assets/audio/introDialogue.mp3")) { // Intro Dialogue Sound
-        std::cout << "Failed to load Intro Dialogue Music\n"; return false;
-    }
-    if (!buttonHovered.loadFromFile("assets/audio/hoverButtons.mp3")) { // Button Hover Sound
-        std::cout << "Failed to load Button Hover Sound\n"; return false;
-    }
-    if (!openMenu.loadFromFile("assets/audio/open_menu.mp3")) {
-        std::cout << "Failed to load Open Menu Sound\n"; return false;
-    }
-    if (!closeMenu.loadFromFile("assets/audio/close_menu.mp3")) {
-        std::cout << "Failed to load Close Menu Sound\n"; return false;
-    }
-    if (!popup.loadFromFile("assets/audio/popup.mp3")) {
-        std::cout << "Failed to load Popup Sound\n"; return false;
-    }
-    if (!xpGain.loadFromFile("assets/audio/xp_gain.mp3")) {
-        std::cout << "Failed to load XP Gain Sound\n"; return false;
-    }
-    if (!titleButtons.loadFromFile("assets/audio/titleButtons.mp3")) { // Intro Title Button Hover
-        std::cout << "Failed to load Title Button Hover Sound\n"; return false;
-    }
-    if (!quizAnswerCorrect.loadFromFile("assets/audio/quizAnswerCorrect.mp3")) { // Answer Correct
-        std::cout << "Failed to load Answer Correct Sound\n"; return false;
-    }
-    if (!quizAnswerIncorrect.loadFromFile("assets/audio/quizAnswerIncorrect.mp3")) { // Answer Incorrect
-        std::cout << "Failed to load Answer Incorrect Sound\n"; return false;
-    }
-    if (!quizLoggingAnswer.loadFromFile("assets/audio/quizLoggingAnswer.mp3")) { // Logging Answer
-        std::cout << "Failed to load Logging Answer Sound\n"; return false;
-    }
-    if (!quizJokerAskAudience.loadFromFile("assets/audio/quizJokerAskAudience.mp3")) { // Ask Audience
-        std::cout << "Failed to load Ask Audience Sound\n"; return false;
-    }
-    if (!quizJokerCallFriend.loadFromFile("assets/audio/quizJokerCallFriend.mp3")) { // Call Friend
-        std::cout << "Failed to load Call Friend Sound\n"; return false;
-    }
-    if (!quizJokerFiftyFifty.loadFromFile("assets/audio/quizJokerFiftyFifty.mp3")) { // Fifty Fifty
-        std::cout << "Failed to load Fifty Fifty Sound\n"; return false;
-    }
-    if (!quizQuestionStart.loadFromFile("assets/audio/quizQuestionStart.mp3")) { // Question Start
-        std::cout << "Failed to load Question Start Sound\n"; return false;
-    }
-    if (!quizQuestionThinking.loadFromFile("assets/audio/quizQuestionThinking.mp3")) { // Question Thinking
-        std::cout << "Failed to load Question Thinking Sound\n"; return false;
+
+    bool loaded = loader.run(onProgress);
+    if (assets::usageTracer().enabled()) {
+        for (std::size_t i = 0; i < assets::kSoundCount; ++i)
+            assets::usageTracer().registerSoundBuffer(soundBuffers[i], i);
+    }
+    std::cout << "Loaded " << loader.jobCount() << " assets in "
+              << loadClock.getElapsedTime().asMilliseconds() << " ms using "
+              << loader.threadCount() << " decode thread(s)\n";
+
+    // Atlas pages are rendered on the GPU, so this needs the uploaded textures.
+    if (loaded) {
+        std::vector<const sf::Texture*> icons;
+        for (std::size_t i = 0; i < assets::kTextureCount; ++i) {
+            if (!assets::kTextureManifest[i].atlas)
+                continue;
+            // Atlas icons are never cached; read the slots directly so the usage trace does not count this.
+            const sf::Texture* icon = sharedTextures[i] ? sharedTextures[i] : &loadedTextures[i];
+            if (std::find(icons.begin(), icons.end(), icon) == icons.end())
+                icons.push_back(icon);
+        }
+        if (!iconAtlas.build(icons, kIconCellSize))
+            std::cout << "Failed to build icon atlas, drawing icons from their own textures\n";
     }
-    if (!quizStart.loadFromFile("assets/audio/quizStart.mp3")) { // Quiz Start
-        std::cout << "Failed to load Quiz Start Sound\n"; return false;
+
+    // All asset loads succeeded.
+    return loaded;
+}
+
+sf::Sprite Resources::canvasSprite(const sf::Texture& texture) const {
+    if (assets::TextureHandle handle = textures.handleOf(texture))
+        return sf::Sprite(texture, textures.canvasRect(handle));
+    return sf::Sprite(texture);
+}
+
+sf::Vector2u Resources::canvasSize(const sf::Texture& texture) const {
+    if (assets::TextureHandle handle = textures.handleOf(texture))
+        return sf::Vector2u(textures.canvasRect(handle).size);
+    return texture.getSize();
+}
+
+const assets::OpaqueBounds& Resources::opaqueBounds(const sf::Texture& texture) const {
+    auto found = textureBounds.find(&texture);
+    if (found != textureBounds.end())
+        return found->second;
+    if (assets::TextureHandle handle = textures.handleOf(texture))
+        return textures.bounds(handle);
+    return textureBounds.emplace(&texture, assets::computeOpaqueBounds(texture.copyToImage())).first->second;
+}
+
+std::vector<std::string> Resources::texturePaths() {
+    std::vector<std::string> paths;
+    for (const auto& asset : assets::kTextureManifest)
+        paths.emplace_back(asset.path);
+    return paths;
+}
+
+void Resources::acquire(AssetGroup group) {
+    if (groupHolds[static_cast<std::size_t>(group)]++ > 0)
+        return;
+    for (std::size_t i = 0; i < assets::kTextureCount; ++i) {
+        if (assets::kTextureManifest[i].group != group)
+            continue;
+        textures.pin(textureHandles[i]);
+        textures.prefetch(textureHandles[i]);
+    }
+    for (std::size_t i = 0; i < assets::kSoundCount; ++i) {
+        if (assets::kSoundManifest[i].group != group)
+            continue;
+        // A decode left over from a quick release/acquire is simply adopted.
+        if (std::any_of(pendingSounds.begin(), pendingSounds.end(), [i](const PendingSound& pending) { return pending.index == i; }))
+            continue;
+        std::string path = assets::kSoundManifest[i].path;
+        pendingSounds.push_back(PendingSound{ i, std::async(std::launch::async, [path]() {
+            auto buffer = std::make_unique<sf::SoundBuffer>();
+            if (!assets::loadSoundBuffer(*buffer, path))
+                buffer.reset();
+            return buffer;
+        }) });
     }
-    if (!quizEnd.loadFromFile("assets/audio/quizEnd.mp3")) { // Quiz End
-        std::cout << "Failed to load Sound\n"; return false;
+}
+
+void Resources::release(AssetGroup group) {
+    unsigned int& holds = groupHolds[static_cast<std::size_t>(group)];
+    if (holds == 0 || --holds > 0)
+        return;
+    for (std::size_t i = 0; i < assets::kTextureCount; ++i) {
+        if (assets::kTextureManifest[i].group == group)
+            textures.unpin(textureHandles[i]);
+    }
+    // Decodes still pending are dropped by collectGroups().
+    for (std::size_t i = 0; i < assets::kSoundCount; ++i) {
+        if (assets::kSoundManifest[i].group == group && soundBuffers[i].getSampleCount() > 1)
+            emptySoundBuffer(soundBuffers[i]);
     }
+}
 
-    // All asset loads succeeded.
-    return true;
+void Resources::installSound(PendingSound& pending) {
+    const auto& asset = assets::kSoundManifest[pending.index];
+    std::unique_ptr<sf::SoundBuffer> decoded = pending.decoded.get();
+    if (!decoded) {
+        std::cout << "Failed to load " << asset.label << "\n";
+        return;
+    }
+    if (!isHeld(asset.group))
+        return;
+    // Copied in on this thread: the buffer's sf::Sound objects are re-attached as part of the load.
+    sf::SoundBuffer& buffer = soundBuffers[pending.index];
+    if (!buffer.loadFromSamples(decoded->getSamples(), decoded->getSampleCount(), decoded->getChannelCount(),
+                                decoded->getSampleRate(), decoded->getChannelMap()))
+        std::cout << "Failed to load " << asset.label << "\n";
+}
+
+void Resources::noteHandleUse(assets::TextureHandle handle) const {
+    auto found = std::find(textureHandles.begin(), textureHandles.end(), handle);
+    if (found != textureHandles.end())
+        assets::usageTracer().noteTexture(static_cast<std::size_t>(found - textureHandles.begin()));
+}
+
+void Resources::collectGroups() {
+    std::erase_if(pendingSounds, [this](PendingSound& pending) {
+        if (pending.decoded.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return false;
+        installSound(pending);
+        return true;
+    });
+}
+
+void Resources::finishGroup(AssetGroup group) {
+    std::erase_if(pendingSounds, [this, group](PendingSound& pending) {
+        if (assets::kSoundManifest[pending.index].group != group)
+            return false;
+        installSound(pending);
+        return true;
+    });
 }
@@ -1,10 +1,23 @@
 #pragma once
 // === C++ Libraries ===
+#include <array>    // Stores the manifest's textures and sound buffers, indexed by id.
+#include <cstddef>  // Provides std::size_t for the id indexes.
+#include <future>   // Holds scene sound buffers decoding on a background thread.
 #include <map>      // Stores lookup tables for textures or sounds if needed in future helpers.
-#include <string>   // Holds asset path strings when loading resources (used by loadAll implementation).
+#include <memory>   // Hands a decoded scene sound buffer back from its thread.
+#include <string>   // Holds asset path strings, including the streamed music files.
+#include <unordered_map>  // Maps each loaded texture to its precomputed opaque bounds.
+#include <vector>   // Lists the texture paths handed to the asset baker.
 // === SFML Libraries ===
 #include <SFML/Graphics.hpp>  // Declares sf::Texture and sf::Font types that Resources stores.
 #include <SFML/Audio.hpp>     // Declares sf::SoundBuffer objects held in the resource bundle.
+// === Header Files ===
+#include "resources/assetLoader.hpp"  // Provides the progress callback reported while loading.
+#include "resources/assetManifest.hpp" // Generated TextureId/SoundId and the manifest rows behind them.
+#include "resources/assetUsage.hpp"    // Counts every texture lookup while --trace-asset-usage is active.
+#include "resources/opaqueBounds.hpp" // Declares the opaque-bounds metadata stored per texture.
+#include "resources/textureAtlas.hpp" // Packs the small UI icons onto shared pages.
+#include "resources/textureCache.hpp" // Loads the handle-based textures on demand.
 
 // Bundles every shared texture/font/sound buffer used by the game.
 struct Resources {
@@ -17,278 +30,134 @@ struct Resources {
     sf::Font battleFont; // Font used inside the battle overlay
     sf::Font battleFontBold; // Font used inside the battle overlay
 
-    // Textures
-    sf::Texture introBackground; // Background
-    sf::Texture returnSymbol; // Blinking return Symbol
-    sf::Texture boxBorder; // Box Asset
-    sf::Texture dividerLeft; // Divider asset used in location header
-    sf::Texture dividerRight; // Divider asset used in location header
-    sf::Texture menuButton; // Menu button graphic used for the overlay toggle
-    sf::Texture buttonInventory;
-    sf::Texture buttonSkills;
-    sf::Texture buttonCharacter;
-    sf::Texture buttonMap;
-    sf::Texture buttonQuests;
-    sf::Texture buttonSettings;
-    sf::Texture buttonRankings;
-    sf::Texture buttonHelp;
-    sf::Texture questbookBackground;
-    sf::Texture skilltree;
-    sf::Texture skillbar;
-    // Item Textures
-    sf::Texture dragonstoneAir; // Air Dragon Stone
-    sf::Texture dragonstoneEarth; // Earth Dragon Stone
-    sf::Texture dragonstoneFire; // Fire Dragon Stone
-    sf::Texture dragonstoneWater; // Water Dragon Stone
-    // Weapon Textures
-    sf::Texture weaponHolmabir;
-    sf::Texture weaponHolmabirBroken;
-    sf::Texture weaponKattkavar;
-    sf::Texture weaponKattkavarLeft;
-    sf::Texture weaponKattkavarBroken;
-    sf::Texture weaponStiggedin;
-    sf::Texture weaponStiggedinLeft;
-    sf::Texture weaponStiggedinBroken;
-    sf::Texture healPotion;
-    sf::Texture mapGlandular; // Map item texture
-    // Character Textures
-    sf::Texture airDragon; // Air Dragon Texture
-    sf::Texture earthDragon; // Earth Dragon Texture
-    sf::Texture fireDragon; // Fire Dragon Texture
-    sf::Texture waterDragon; // Water Dragon Texture
-    sf::Texture dragonbornMaleSprite; // Dragonborn Male Sprite for selection
-    sf::Texture dragonbornFemaleSprite; // Dragonborn Female Sprite for selection
-    sf::Texture dragonbornMaleHoveredSprite; // Hovered Dragonborn Male Sprite
-    sf::Texture dragonbornFemaleHoveredSprite; // Hovered Dragonborn Female Sprite
-    // Character Portraits
-    sf::Texture portraitStoryTeller; // Tory Tailor Portrait
-    sf::Texture portraitVillageElder; // Noah Lott Portrait
-    sf::Texture portraitVillageWanderer; // Wanda Rinn Portrait
-    sf::Texture portraitBlacksmith; // Will Figsid Portrait
-    sf::Texture portraitNoahBates; // Noah bates Portrait
-    sf::Texture portraitFireDragon; // Rowsted Sheacane Portrait
-    sf::Texture portraitWaterDragon; // Flawtin Seamen Portrait
-    sf::Texture portraitAirDragon; // Gustavo Windimaess Portrait
-    sf::Texture portraitEarthDragon; // Grounded Claymore Portrait
-    sf::Texture portraitMasterBates; // Master Bates Portrait
-    sf::Texture portraitMasterBatesDragon; // Dragon form of Master Bates
-    sf::Texture portraitDragonbornMaleCape; // Dragonborn Male Portrait with cape
-    sf::Texture portraitDragonbornMaleNoCape; // Dragonborn Male Portrait without cape
-    sf::Texture portraitDragonbornFemaleCape; // Dragonborn Female Portrait with cape
-    sf::Texture portraitDragonbornFemaleNoCape; // Dragonborn Female Portrait without cape
-    // Portrait Backgrounds
-    sf::Texture portraitBackgroundAerobronchi;
-    sf::Texture portraitBackgroundBlacksmith;
-    sf::Texture portraitBackgroundBlyathyroid;
-    sf::Texture portraitBackgroundCladrenal;
-    sf::Texture portraitBackgroundGonad;
-    sf::Texture portraitBackgroundLacrimere;
-    sf::Texture portraitBackgroundPetrigonal;
-    sf::Texture portraitBackgroundSeminiferous;
-    sf::Texture portraitBackgroundUmbraOssea;
-    sf::Texture portraitBackgroundToryTailor;
-    // Character Sprites (new)
-    sf::Texture spriteDragonbornBack;
-    sf::Texture spriteDragonbornFemaleBack;
-    sf::Texture spriteDragonbornMaleBack;
-    sf::Texture spriteDragonbornFemale;
-    sf::Texture spriteDragonbornFemaleNoCape;
-    sf::Texture spriteDragonbornMale;
-    sf::Texture spriteDragonbornMaleNoCape;
-    sf::Texture spriteDragonbornFemaleHovered;
-    sf::Texture spriteDragonbornMaleHovered;
-    sf::Texture spriteFlawtinSeamen;
-    sf::Texture spriteGlandularCape;
-    sf::Texture spriteGroundedClaymore;
-    sf::Texture spriteGustavoWindimaess;
-    sf::Texture spriteMasterBates;
-    sf::Texture spriteMasterBatesDragon;
-    sf::Texture spriteNoahLott;
-    sf::Texture spriteRowstedSheacane;
-    sf::Texture spriteWandaRinn;
-    sf::Texture spriteWillFigsid;
-    sf::Texture spriteWandaRinnBack;
-    sf::Texture spriteWillFigsidBack;
-    sf::Texture spriteNoahLottBack;
-    sf::Texture spriteRowstedSheacaneBack;
-    sf::Texture spriteFlawtinSeamenBack;
-    sf::Texture spriteGustavoWindimaessBack;
-    sf::Texture spriteGroundedClaymoreBack;
-    // Character menu helpers
-    sf::Texture charMenuLeftHand;
-    sf::Texture charMenuRightHand;
-    sf::Texture charMenuRing;
-    sf::Texture charMenuDragonstoneSlot;
-    sf::Texture charMenuDragonclawSlot;
-    sf::Texture charMenuDragonscaleSlot;
-    sf::Texture charMenuLuckyCharmSlot;
-    sf::Texture charMenuFemaleNoCape;
-    sf::Texture charMenuMaleNoCape;
-    sf::Texture charMenuFemaleCape;
-    sf::Texture charMenuMaleCape;
-    sf::Texture charMenuCloak;
-    sf::Texture elementAirButton;
-    sf::Texture elementEarthButton;
-    sf::Texture elementFireButton;
-    sf::Texture elementWaterButton;
-    sf::Texture equipmentRingAir;
-    sf::Texture equipmentRingEarth;
-    sf::Texture equipmentRingFire;
-    sf::Texture equipmentRingWater;
-
-    // Artifact menu icons
-    sf::Texture artifactDragonscaleAir;
-    sf::Texture artifactDragonscaleEarth;
-    sf::Texture artifactDragonscaleFire;
-    sf::Texture artifactDragonscaleWater;
-    sf::Texture artifactDragonstoneAir;
-    sf::Texture artifactDragonstoneEarth;
-    sf::Texture artifactDragonstoneFire;
-    sf::Texture artifactDragonstoneWater;
-    sf::Texture artifactDragonclawAir;
-    sf::Texture artifactDragonclawEarth;
-    sf::Texture artifactDragonclawFire;
-    sf::Texture artifactDragonclawWater;
-    sf::Texture artifactLuckyCharmAir;
-    sf::Texture artifactLuckyCharmEarth;
-    sf::Texture artifactLuckyCharmFire;
-    sf::Texture artifactLuckyCharmWater;
-    // Map Textures
-    sf::Texture menuMapBackground; // Menu map base art
-    sf::Texture menuMapGonad; // Gonad overlay
-    sf::Texture menuMapLacrimere; // Lacrimere overlay
-    sf::Texture menuMapBlyathyroid; // Blyathyroid overlay
-    sf::Texture menuMapCladrenal; // Cladrenal overlay
-    sf::Texture menuMapAerobronchi; // Aerobronchi overlay
-    sf::Texture menuMapPetrigonal; // Petrigonal overlay
-    sf::Texture menuMapUmbraOverlay; // Umbra Ossea overlay on the Glandular map
-    sf::Texture backgroundAerobronchi; // Air Dragon area background
-    sf::Texture backgroundBlacksmith; // Gonad blacksmith scene
-    sf::Texture backgroundBlyathyroid; // Blyathyroid background
-    sf::Texture backgroundCladrenal; // Cladrenal background
-    sf::Texture backgroundGonad; // Gonad background
-    sf::Texture backgroundLacrimere; // Lacrimere background
-    sf::Texture backgroundPetrigonal; // Perigonal area background
-    sf::Texture backgroundSeminiferous; // Seminiferous background
-    sf::Texture backgroundUmbraOssea; // Umbra Ossea background
-    sf::Texture backgroundToryTailor; // Tory Tailor narration background
-    sf::Texture battleBackgroundLayer; // Battle background layer
-    sf::Texture battleBeginsGlandular; // Battle intro badge
-    sf::Texture battlePlayerPlatform; // Battle player platform layer
-    sf::Texture battleEnemyPlatform; // Battle enemy platform layer
-    sf::Texture battleTextBox; // Battle dialogue text box
-    sf::Texture battleActionBox; // Battle action list box
-    sf::Texture battlePlayerBox; // Battle player info box
-    sf::Texture battleEnemyBox; // Battle enemy info box
-    sf::Texture battleIconMale; // Icon for male combatants
-    sf::Texture battleIconFemale; // Icon for female combatants
-    sf::Texture skillSlashAir;
-    sf::Texture skillSlashEarth;
-    sf::Texture skillSlashFire;
-    sf::Texture skillSlashWater;
-    sf::Texture skillWeaponAir;
-    sf::Texture skillWeaponEarth;
-    sf::Texture skillWeaponFire;
-    sf::Texture skillWeaponWater;
-    sf::Texture skillMasterBatesPowerup;
-    sf::Texture skillMasterBatesMidnightRelease;
-    sf::Texture skillMasterBatesBadHabit;
-    sf::Texture skillMasterBatesShadowRoutine;
-    sf::Texture skillMasterBatesGuiltyEmber;
     sf::Shader   hpBadgeShader; // Shader applied to health badge fills
-    sf::Texture treasureChestAir;
-    sf::Texture treasureChestEarth;
-    sf::Texture treasureChestFire;
-    sf::Texture treasureChestWater;
-    sf::Texture trophyDragoncupAir;
-    sf::Texture trophyDragoncupEarth;
-    sf::Texture trophyDragoncupFire;
-    sf::Texture trophyDragoncupWater;
-    sf::Texture trophyDragoncupUmbra;
-    sf::Texture emblemSoul;
-    sf::Texture emblemBody;
-    sf::Texture emblemResolve;
-    sf::Texture emblemMind;
-    sf::Texture emblemAscension;
-    sf::Texture umbraUsseaOne;
-    sf::Texture umbraUsseaTwo;
-    sf::Texture umbraUsseaThree;
-    sf::Texture umbraUsseaFour;
-    sf::Texture umbraUsseaComplete;
-    // Credits Textures
-    sf::Texture creditActAsha;
-    sf::Texture creditActEmber;
-    sf::Texture creditActBates;
-    sf::Texture creditActBatesDragon;
-    sf::Texture creditActNoah;
-    sf::Texture creditActWanda;
-    sf::Texture creditActWill;
-    sf::Texture creditActFlawtin;
-    sf::Texture creditActGrounded;
-    sf::Texture creditActGustavo;
-    sf::Texture creditActRowsted;
-    sf::Texture creditActTory;
-    sf::Texture creditActKensen;
-    sf::Texture creditBetaTesterAlex;
 
-    // Sound Buffers
-    sf::SoundBuffer acquire; // Sound played, when aquiring items
-    sf::SoundBuffer confirm; // Sound played, when confirming choices
-    sf::SoundBuffer enterKey; // Sound played when Enter Key is pressed
-    sf::SoundBuffer typewriter; // Typewriter Sound » isTyping
-    sf::SoundBuffer reject; // Sound played when rejecting choices
-    sf::SoundBuffer startGame; // Sound played when starting the Game
-    sf::SoundBuffer teleportStart; // Sound played at the beginning of a teleport
-    sf::SoundBuffer teleportMiddle; // Sound played during teleportation
-    sf::SoundBuffer teleportStop; // Sound played when teleportation ends
-    sf::SoundBuffer healSound; // Sound played when using the healing potion
-    sf::SoundBuffer skillSlash; // Skill slash SFX
-    sf::SoundBuffer skillAir; // Air element SFX
-    sf::SoundBuffer skillEarth; // Earth element SFX
-    sf::SoundBuffer skillFire; // Fire element SFX
-    sf::SoundBuffer skillWater; // Water element SFX
-    sf::SoundBuffer skillFriendship; // Friendship skill SFX
-    sf::SoundBuffer skillPowerUp; // Master Bates powerup SFX
-    sf::SoundBuffer chickSound; // Master Bates evolution pre-sound
-    sf::SoundBuffer awwSound; // Master Bates dragon celebration SFX
-    sf::SoundBuffer masterBatesEvolution; // Master Bates evolution SFX
-    sf::SoundBuffer skillMidnightRelease; // Master Bates skill
-    sf::SoundBuffer skillBadHabit; // Master Bates skill
-    sf::SoundBuffer skillShadowRoutine; // Dragon version skill
-    sf::SoundBuffer skillGuiltyEmber; // Dragon version skill
-    sf::SoundBuffer forgeSound; // Sound played during forging sleep timer
-    sf::SoundBuffer levelUp; // Sound played when levelling up
-    sf::SoundBuffer openMenu; // Sound when the menu opens
-    sf::SoundBuffer closeMenu; // Sound when the menu closes
-    sf::SoundBuffer popup; // Sound for modal popups
-    sf::SoundBuffer xpGain; // Sound played when XP bar fills
-    sf::SoundBuffer locationMusicPerigonal; // Sound played during the Perigonal dialogue
-    sf::SoundBuffer locationMusicGonad; // Sound played while in Gonad
-    sf::SoundBuffer locationMusicBlyathyroid; // Sound played while in Blyathyroid
-    sf::SoundBuffer locationMusicLacrimere; // Sound played while in Lacrimere
-    sf::SoundBuffer locationMusicCladrenal; // Sound played while in Cladrenal
-    sf::SoundBuffer locationMusicAerobronchi; // Sound played while in Aerobronchi
-    sf::SoundBuffer locationMusicSeminiferous; // Sound played while in Seminiferous
-    sf::SoundBuffer locationMusicUmbraOssea; // Sound played while in Umbra Ossea
-    sf::SoundBuffer locationMusicBlacksmith; // Sound played while at Figsid's Forge
-    sf::SoundBuffer introTitle; // Sound played while on the intro title
-    sf::SoundBuffer introDialogue; // Sound played during the intro dialogue
-    sf::SoundBuffer buttonHovered; // Sound played when hovering buttons
-    sf::SoundBuffer quizAnswerCorrect;
-    sf::SoundBuffer quizAnswerIncorrect;
-    sf::SoundBuffer quizLoggingAnswer;
-    sf::SoundBuffer quizJokerAskAudience;
-    sf::SoundBuffer quizJokerCallFriend;
-    sf::SoundBuffer quizJokerFiftyFifty;
-    sf::SoundBuffer quizQuestionStart;
-    sf::SoundBuffer quizQuestionThinking;
-    sf::SoundBuffer quizStart;
-    sf::SoundBuffer quizEnd;
-    sf::SoundBuffer questStart; // Sound played when a new quest begins
-    sf::SoundBuffer questEnd; // Sound played when a quest completes
-    sf::SoundBuffer titleButtons; // Sound played when hovering intro title options
+    // Music (file paths only; AudioManager streams these with sf::Music)
+    std::string locationMusicPerigonal; // Sound played during the Perigonal dialogue
+    std::string locationMusicGonad; // Sound played while in Gonad
+    std::string locationMusicBlyathyroid; // Sound played while in Blyathyroid
+    std::string locationMusicLacrimere; // Sound played while in Lacrimere
+    std::string locationMusicCladrenal; // Sound played while in Cladrenal
+    std::string locationMusicAerobronchi; // Sound played while in Aerobronchi
+    std::string locationMusicSeminiferous; // Sound played while in Seminiferous
+    std::string locationMusicUmbraOssea; // Sound played while in Umbra Ossea
+    std::string locationMusicBlacksmith; // Sound played while at Figsid's Forge
+    std::string introTitle; // Sound played while on the intro title
+    std::string introDialogue; // Sound played during the intro dialogue
+
+    // Every texture and sound buffer listed in src/resources/assets.manifest, indexed by the
+    // generated TextureId / SoundId. Cached textures (portraits, location backgrounds, battle
+    // art, credits) are only registered with `textures`; they load on first use and may be
+    // evicted again when the VRAM budget is exceeded. Lookups load lazily, so const callers
+    // can resolve them too. Files with the same bytes as one loaded earlier resolve to that
+    // texture or buffer (see resources/contentStore.hpp), so compare them by id, not address.
+    const sf::Texture& texture(TextureId id) const {
+        const std::size_t index = assets::indexOf(id);
+        if (assets::usageTracer().enabled())
+            assets::usageTracer().noteTexture(index);
+        if (assets::kTextureManifest[index].cached)
+            return textures.get(textureHandles[index]);
+        return sharedTextures[index] ? *sharedTextures[index] : loadedTextures[index];
+    }
+    // Cache handle of a cached texture; invalid for textures loaded by loadAll.
+    assets::TextureHandle handle(TextureId id) const { return textureHandles[assets::indexOf(id)]; }
+    const sf::SoundBuffer& sound(SoundId id) const {
+        const std::size_t index = assets::indexOf(id);
+        return sharedSounds[index] ? *sharedSounds[index] : soundBuffers[index];
+    }
+
+    std::array<sf::Texture, assets::kTextureCount> loadedTextures;             // Slots of cached ids stay empty.
+    std::array<const sf::Texture*, assets::kTextureCount> sharedTextures{};    // Set where loadAll found a duplicate.
+    std::array<assets::TextureHandle, assets::kTextureCount> textureHandles;   // Valid for cached ids only.
+    std::array<sf::SoundBuffer, assets::kSoundCount> soundBuffers;
+    std::array<const sf::SoundBuffer*, assets::kSoundCount> sharedSounds{};    // Set where loadAll found a duplicate.
+
+    mutable assets::TextureCache textures;
+    const sf::Texture& texture(assets::TextureHandle handle) const {
+        if (assets::usageTracer().enabled())
+            noteHandleUse(handle);
+        return textures.get(handle);
+    }
+    // Sprites, portraits and credits art lose their transparent margins at load time. These
+    // return the original canvas, so placement code can size and anchor them as before.
+    sf::Sprite canvasSprite(const sf::Texture& texture) const;
+    sf::Vector2u canvasSize(const sf::Texture& texture) const;
+
+    // Downscaled copies of the manifest's atlas icons on shared pages; look one up with
+    // iconAtlas.find(resources.texture(TextureId::HealPotion)) and draw it through an IconBatch.
+    assets::TextureAtlas iconAtlas;
+
+    // Opaque bounds of every texture, measured on the decoded image during loadAll.
+    // Textures loaded elsewhere are read back from the GPU once on first lookup.
+    mutable std::unordered_map<const sf::Texture*, assets::OpaqueBounds> textureBounds;
+    const assets::OpaqueBounds& opaqueBounds(const sf::Texture& texture) const;
 
     // Central Loader
-    // Loads all assets from disk and returns true on success.
-    bool loadAll();
+    // Opens the fonts only; loadAll calls this first so the loading screen can draw text.
+    bool loadFonts();
+    // Loads all assets from disk and returns true on success. Images and audio decode on
+    // threadCount workers (0 = auto); onProgress runs on the calling thread after each asset.
+    bool loadAll(unsigned int threadCount = 0, const assets::ProgressCallback& onProgress = {});
+
+    // Every texture path loadAll references; glandular_bake reads this as its manifest.
+    static std::vector<std::string> texturePaths();
+
+    // Scene groups (assets::isSceneGroup) are not loaded by loadAll. The first acquire of a
+    // group pins its textures and starts decoding them and its sound buffers on background
+    // threads; the last release unpins the textures, so trim() evicts them once unused, and
+    // empties the sound buffers. Holds are counted per group; scenes use GroupLease.
+    void acquire(AssetGroup group);
+    void release(AssetGroup group);
+    bool isHeld(AssetGroup group) const { return groupHolds[static_cast<std::size_t>(group)] > 0; }
+    // Installs the scene sound buffers that finished decoding. Call once per frame.
+    void collectGroups();
+    // Blocks until every sound buffer of group is installed.
+    void finishGroup(AssetGroup group);
+
+    struct PendingSound {
+        std::size_t index = 0;
+        std::future<std::unique_ptr<sf::SoundBuffer>> decoded;  // Null when the file failed to load.
+    };
+    std::array<unsigned int, assets::kAssetGroupCount> groupHolds{};
+    std::vector<PendingSound> pendingSounds;
+
+private:
+    void installSound(PendingSound& pending);
+    void noteHandleUse(assets::TextureHandle handle) const;
+};
+
+namespace assets {
+
+// One scene's hold on a scene group. acquire() and release() may be called from every entry
+// and exit path of the scene; only the first of each counts. Releases on destruction.
+class GroupLease {
+public:
+    GroupLease(Resources& resources, AssetGroup group) : resources(resources), group(group) {}
+    ~GroupLease() { release(); }
+    GroupLease(const GroupLease&) = delete;
+    GroupLease& operator=(const GroupLease&) = delete;
+
+    void acquire() {
+        if (!held)
+            resources.acquire(group);
+        held = true;
+    }
+    void release() {
+        if (held)
+            resources.release(group);
+        held = false;
+    }
+    // Acquires and waits for the group's sound buffers; textures still load on first use.
+    void finish() {
+        acquire();
+        resources.finishGroup(group);
+    }
+    bool isHeld() const { return held; }
+
+private:
+    Resources& resources;
+    AssetGroup group;
+    bool held = false;
 };
+
+} // namespace assets
@@ -0,0 +1,117 @@
+// === C++ Libraries ===
+#include <algorithm>  // Sorts the icons by height and clamps the cell size.
+#include <cmath>      // Rounds the scaled icon sizes.
+#include <iostream>   // Reports pages that could not be created.
+// === SFML Libraries ===
+#include <SFML/Graphics/RenderTexture.hpp>  // Renders the scaled icons onto each page.
+#include <SFML/Graphics/Sprite.hpp>         // Places one icon on the page being rendered.
+// === Header Files ===
+#include "resources/textureAtlas.hpp"  // Declares TextureAtlas implemented below.
+
+namespace assets {
+namespace {
+// Holds every menu icon at the default cell size on one page; smaller GL limits are respected.
+constexpr unsigned int kPageSize = 2048;
+// Transparent gap around every icon, so smooth sampling never picks up a neighbour.
+constexpr int kGutter = 2;
+
+struct Placement {
+    const sf::Texture* source = nullptr;
+    sf::Vector2i size;
+    sf::Vector2i position;
+    std::size_t page = 0;
+};
+} // namespace
+
+bool TextureAtlas::build(std::span<const sf::Texture* const> sources, unsigned int maxCellSize) {
+    pages.clear();
+    regions.clear();
+
+    const int pageSize = static_cast<int>(std::min(kPageSize, sf::Texture::getMaximumSize()));
+    const float cellLimit = static_cast<float>(std::min(static_cast<int>(maxCellSize), pageSize - (kGutter * 2)));
+    std::vector<Placement> placements;
+    for (const sf::Texture* source : sources) {
+        if (!source || source->getSize().x == 0 || source->getSize().y == 0)
+            continue;
+        sf::Vector2f size(source->getSize());
+        float scale = std::min(1.f, cellLimit / std::max(size.x, size.y));
+        Placement placement;
+        placement.source = source;
+        placement.size = {
+            std::max(1, static_cast<int>(std::lround(size.x * scale))),
+            std::max(1, static_cast<int>(std::lround(size.y * scale)))
+        };
+        placements.push_back(placement);
+    }
+
+    // Shelf packing, tallest icons first so each shelf wastes little height.
+    std::stable_sort(placements.begin(), placements.end(), [](const Placement& a, const Placement& b) {
+        return a.size.y > b.size.y;
+    });
+    sf::Vector2i cursor{ kGutter, kGutter };
+    int shelfHeight = 0;
+    std::size_t page = 0;
+    for (Placement& placement : placements) {
+        if (cursor.x + placement.size.x + kGutter > pageSize) {
+            cursor = { kGutter, cursor.y + shelfHeight + kGutter };
+            shelfHeight = 0;
+        }
+        if (cursor.y + placement.size.y + kGutter > pageSize) {
+            cursor = { kGutter, kGutter };
+            shelfHeight = 0;
+            ++page;
+        }
+        placement.position = cursor;
+        placement.page = page;
+        cursor.x += placement.size.x + kGutter;
+        shelfHeight = std::max(shelfHeight, placement.size.y);
+    }
+
+    std::size_t next = 0;
+    while (next < placements.size()) {
+        sf::RenderTexture canvas;
+        if (!canvas.resize({ static_cast<unsigned int>(pageSize), static_cast<unsigned int>(pageSize) })) {
+            std::cout << "Failed to create icon atlas page " << pages.size() << "\n";
+            return false;
+        }
+        canvas.clear(sf::Color::Transparent);
+        const std::size_t first = next;
+        for (; next < placements.size() && placements[next].page == placements[first].page; ++next) {
+            const Placement& placement = placements[next];
+            // Mipmapped copy so 2048px art shrinks without aliasing; the source keeps its settings.
+            sf::Texture scaled(*placement.source);
+            scaled.setSmooth(true);
+            (void)scaled.generateMipmap();
+            sf::Sprite sprite(scaled);
+            sprite.setScale({
+                static_cast<float>(placement.size.x) / static_cast<float>(scaled.getSize().x),
+                static_cast<float>(placement.size.y) / static_cast<float>(scaled.getSize().y)
+            });
+            sprite.setPosition(sf::Vector2f(placement.position));
+            // Replace instead of blend, so the page keeps the icon's own alpha.
+            canvas.draw(sprite, sf::RenderStates(sf::BlendNone));
+        }
+        canvas.display();
+
+        auto texture = std::make_unique<sf::Texture>(canvas.getTexture());
+        texture->setSmooth(true);
+        for (std::size_t i = first; i < next; ++i)
+            regions[placements[i].source] = { texture.get(), { placements[i].position, placements[i].size }, placements[i].source };
+        pages.push_back(std::move(texture));
+    }
+    return true;
+}
+
+const AtlasRegion* TextureAtlas::find(const sf::Texture& source) const {
+    auto found = regions.find(&source);
+    return found != regions.end() ? &found->second : nullptr;
+}
+
+std::size_t TextureAtlas::residentBytes() const {
+    std::size_t bytes = 0;
+    for (const auto& page : pages)
+        bytes += static_cast<std::size_t>(page->getSize().x) * page->getSize().y * 4;
+    return bytes;
+}
+
+} // namespace assets
@@ -0,0 +1,43 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>        // Provides std::size_t for the page count.
+#include <memory>         // Keeps every atlas page at a stable address.
+#include <span>           // Takes the list of source textures.
+#include <unordered_map>  // Maps source textures to their packed regions.
+#include <vector>         // Stores the atlas pages.
+// === SFML Libraries ===
+#include <SFML/Graphics/Rect.hpp>     // Stores where an icon lies on its page.
+#include <SFML/Graphics/Texture.hpp>  // Declares the source textures and the atlas pages.
+
+namespace assets {
+
+// Where one packed icon lives: the atlas page and its pixel rect on that page.
+struct AtlasRegion {
+    const sf::Texture* page = nullptr;
+    sf::IntRect rect;
+    const sf::Texture* source = nullptr;  // Texture the icon was copied from.
+};
+
+// Packs many small UI icons onto a few shared pages so a whole inventory grid or tab bar
+// can be drawn with one vertex array (see rendering/iconBatch.hpp). Icons are looked up by
+// the Resources texture they were copied from, which stays loaded for other uses.
+class TextureAtlas {
+public:
+    // Copies every source onto the pages, scaled down (mipmapped) to fit maxCellSize while
+    // keeping its aspect ratio. Replaces any previous contents. Returns false if a page
+    // could not be created; icons packed before that point stay usable.
+    bool build(std::span<const sf::Texture* const> sources, unsigned int maxCellSize);
+
+    // Region of the icon copied from source, or nullptr if source was not packed.
+    const AtlasRegion* find(const sf::Texture& source) const;
+
+    std::size_t pageCount() const { return pages.size(); }
+    // Estimated VRAM of every page.
+    std::size_t residentBytes() const;
+
+private:
+    std::vector<std::unique_ptr<sf::Texture>> pages;
+    std::unordered_map<const sf::Texture*, AtlasRegion> regions;
+};
+
+} // namespace assets
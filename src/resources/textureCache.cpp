@@ -0,0 +1,312 @@
+// === C++ Libraries ===
+#include <algorithm>  // Sorts the eviction candidates by last use.
+#include <cmath>      // Rounds the normalized opaque bounds back to pixels.
+#include <chrono>     // Polls prefetches without blocking.
+#include <iostream>   // Reports textures that failed to load.
+#include <utility>    // Moves paths and labels into the entries and hands pins to shared entries.
+// === SFML Libraries ===
+#include <SFML/Graphics/Image.hpp>  // Decodes on the CPU so the bounds can be measured before upload.
+#include <SFML/System/Clock.hpp>    // Times the decode and the upload for the asset profiler.
+// === Header Files ===
+#include "resources/textureCache.hpp"  // Declares TextureCache implemented below.
+#include "resources/assetFiles.hpp"    // Reads the file from the asset pack or the loose tree.
+#include "resources/contentStore.hpp"  // Resolves byte-identical files to the entry that decoded first.
+#include "resources/qoiImage.hpp"      // Decodes baked QOI art as well as PNG/JPEG.
+
+namespace assets {
+namespace {
+double elapsedMs(const sf::Clock& clock) {
+    return static_cast<double>(clock.getElapsedTime().asMicroseconds()) / 1000.0;
+}
+
+// Cuts image down to its visible pixels and returns the rect that maps the original canvas onto
+// the trimmed image. Trimmed sides keep one transparent pixel, so a sprite whose texture rect
+// reaches past the image samples transparency there instead of a smeared edge pixel.
+sf::IntRect trimToVisible(sf::Image& image, const sf::FloatRect& visible) {
+    const sf::Vector2u size = image.getSize();
+    const sf::IntRect canvas{ { 0, 0 }, sf::Vector2i(size) };
+    const sf::Vector2f canvasSize(size);
+    const int left = static_cast<int>(std::lround(visible.position.x * canvasSize.x));
+    const int top = static_cast<int>(std::lround(visible.position.y * canvasSize.y));
+    const int right = static_cast<int>(std::lround((visible.position.x + visible.size.x) * canvasSize.x));
+    const int bottom = static_cast<int>(std::lround((visible.position.y + visible.size.y) * canvasSize.y));
+
+    const int padLeft = left > 0 ? 1 : 0;
+    const int padTop = top > 0 ? 1 : 0;
+    const int padRight = right < canvas.size.x ? 1 : 0;
+    const int padBottom = bottom < canvas.size.y ? 1 : 0;
+    const sf::Vector2i trimmedSize{ right - left + padLeft + padRight, bottom - top + padTop + padBottom };
+    if (trimmedSize.x >= canvas.size.x && trimmedSize.y >= canvas.size.y)
+        return canvas;
+
+    sf::Image trimmed(sf::Vector2u(trimmedSize), sf::Color::Transparent);
+    const sf::IntRect opaque{ { left, top }, { right - left, bottom - top } };
+    if (!trimmed.copy(image, { static_cast<unsigned int>(padLeft), static_cast<unsigned int>(padTop) }, opaque))
+        return canvas;
+
+    image = std::move(trimmed);
+    return sf::IntRect{ { padLeft - left, padTop - top }, canvas.size };
+}
+} // namespace
+
+TextureHandle TextureCache::add(std::string path, std::string label, bool trimMargins) {
+    TextureHandle handle{ static_cast<std::uint32_t>(entries.size()) };
+    Entry entry;
+    entry.path = std::move(path);
+    entry.label = std::move(label);
+    entry.trimMargins = trimMargins;
+    entry.texture = std::make_unique<sf::Texture>();
+    handleByTexture.emplace(entry.texture.get(), handle.index);
+    entries.push_back(std::move(entry));
+    return handle;
+}
+
+// Runs on prefetch threads too, so it only touches its arguments and the locked content store.
+TextureCache::Decoded TextureCache::decode(const std::string& path, bool trimMargins, const sf::Texture* target) {
+    Decoded decoded;
+    sf::Clock clock;
+    AssetBytes bytes;
+    if (!readAssetBytes(path, bytes))
+        return decoded;
+    const ContentVariant variant = trimMargins ? ContentVariant::TrimmedTexture : ContentVariant::CachedTexture;
+    if (const sf::Texture* original = contentStore().claim(contentKey(bytes.view, variant), path, target); original != target) {
+        decoded.original = original;
+        decoded.ok = true;
+        return decoded;
+    }
+    decoded.report.readMs = elapsedMs(clock);
+    decoded.report.fileBytes = bytes.view.size();
+
+    clock.restart();
+    if (!decodeImage(bytes.view, decoded.image))
+        return decoded;
+    // Bounds are measured before trimming so callers keep working in canvas space.
+    decoded.bounds = computeOpaqueBounds(decoded.image);
+    decoded.canvasRect = sf::IntRect{ { 0, 0 }, sf::Vector2i(decoded.image.getSize()) };
+    if (trimMargins && decoded.bounds.visible)
+        decoded.canvasRect = trimToVisible(decoded.image, *decoded.bounds.visible);
+    decoded.report.decodeMs = elapsedMs(clock);
+    decoded.ok = true;
+    return decoded;
+}
+
+void TextureCache::upload(Entry& entry, Decoded decoded) {
+    if (decoded.original) {
+        entry.sharedWith = handleOf(*decoded.original).index;
+        // Pins taken before the load landed on this entry; from now on pin/unpin resolve to the original.
+        Entry& original = entries[entry.sharedWith];
+        original.pins += std::exchange(entry.pins, 0);
+        if (original.pins > 0)
+            original.dropWhenUnused = false;
+        else if (entry.dropWhenUnused)
+            original.dropWhenUnused = true;
+        entry.dropWhenUnused = false;
+        return;
+    }
+    sf::Clock clock;
+    const bool ok = decoded.ok && entry.texture->loadFromImage(decoded.image);
+    finishLoad(entry, std::move(decoded), ok, elapsedMs(clock));
+}
+
+void TextureCache::finishLoad(Entry& entry, Decoded decoded, bool ok, double uploadMs) {
+    if (!ok) {
+        std::cout << "Failed to load " << entry.label << "\n";
+        entry.failed = true;
+        return;
+    }
+    entry.bounds = decoded.bounds;
+    entry.canvasRect = decoded.canvasRect;
+    auto size = entry.texture->getSize();
+    entry.bytes = static_cast<std::size_t>(size.x) * size.y * 4;
+    entry.loaded = true;
+    resident += entry.bytes;
+    decoded.report.uploadMs = uploadMs;
+    contentStore().recordCost(entry.texture.get(), decoded.report.decodeMs + decoded.report.uploadMs, entry.bytes);
+
+    if (profiler().enabled()) {
+        decoded.report.path = entry.path;
+        decoded.report.label = entry.label;
+        decoded.report.kind = "cached texture";
+        decoded.report.dimensions = size;
+        decoded.report.decodedBytes = entry.bytes;
+        profiler().record(std::move(decoded.report), entry.texture.get());
+    }
+}
+
+void TextureCache::startUpload(std::uint32_t index, Decoded decoded) {
+    Entry& entry = entries[index];
+    if (!uploader || decoded.original || !decoded.ok) {
+        upload(entry, std::move(decoded));
+        return;
+    }
+    uploader->submit(index, std::move(decoded.image));
+    decoded.image = sf::Image();
+    entry.uploading = std::move(decoded);
+}
+
+void TextureCache::adoptUpload(TextureUploader::Finished finished) {
+    Entry& entry = entries[finished.ticket];
+    Decoded decoded = std::move(*entry.uploading);
+    entry.uploading.reset();
+    // Move-assigning keeps the sf::Texture address that sprites and handleOf() rely on.
+    if (finished.ok)
+        *entry.texture = std::move(finished.texture);
+    finishLoad(entry, std::move(decoded), finished.ok, finished.uploadMs);
+}
+
+void TextureCache::load(Entry& entry) {
+    if (entry.uploading) {
+        entry.stalled = true;
+        adoptUpload(uploader->wait(static_cast<std::uint32_t>(&entry - entries.data())));
+        return;
+    }
+    if (entry.prefetched.valid()) {
+        if (entry.prefetched.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            entry.stalled = true;
+        upload(entry, entry.prefetched.get());
+        return;
+    }
+    upload(entry, decode(entry.path, entry.trimMargins, entry.texture.get()));
+}
+
+const TextureCache::Entry& TextureCache::resolve(TextureHandle handle) const {
+    const Entry& entry = entries[handle.index];
+    return entry.sharedWith == TextureHandle::kInvalid ? entry : entries[entry.sharedWith];
+}
+
+TextureCache::Entry& TextureCache::resolve(TextureHandle handle) {
+    Entry& entry = entries[handle.index];
+    return entry.sharedWith == TextureHandle::kInvalid ? entry : entries[entry.sharedWith];
+}
+
+TextureCache::Entry& TextureCache::touch(TextureHandle handle) {
+    Entry& entry = entries[handle.index];
+    if (entry.sharedWith == TextureHandle::kInvalid) {
+        entry.lastUsedFrame = frame;
+        if (!entry.loaded && !entry.failed)
+            load(entry);
+    }
+    // load() may just have found that the file is identical to another entry's.
+    if (entry.sharedWith != TextureHandle::kInvalid)
+        return touch(TextureHandle{ entry.sharedWith });
+    return entry;
+}
+
+void TextureCache::prefetch(TextureHandle handle) {
+    if (std::uint32_t shared = entries[handle.index].sharedWith; shared != TextureHandle::kInvalid)
+        handle = TextureHandle{ shared };
+    Entry& entry = entries[handle.index];
+    entry.stalled = false;
+    if (entry.loaded || entry.failed || entry.prefetched.valid() || entry.uploading)
+        return;
+    entry.prefetched = std::async(std::launch::async, &TextureCache::decode, entry.path, entry.trimMargins, entry.texture.get());
+    pendingPrefetches.push_back(handle.index);
+}
+
+void TextureCache::enableBackgroundUploads() {
+    if (!uploader)
+        uploader = std::make_unique<TextureUploader>();
+}
+
+void TextureCache::collectPrefetched() {
+    std::erase_if(pendingPrefetches, [&](std::uint32_t index) {
+        Entry& entry = entries[index];
+        if (!entry.prefetched.valid())
+            return true;  // get() already waited for it.
+        if (entry.prefetched.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return false;
+        startUpload(index, entry.prefetched.get());
+        entry.lastUsedFrame = frame;  // Survive this frame's trim(); the caller retains it after that.
+        return true;
+    });
+    if (!uploader)
+        return;
+    for (auto& finished : uploader->collect()) {
+        entries[finished.ticket].lastUsedFrame = frame;
+        adoptUpload(std::move(finished));
+    }
+}
+
+const sf::Texture& TextureCache::get(TextureHandle handle) {
+    return *touch(handle).texture;
+}
+
+void TextureCache::retain(TextureHandle handle) {
+    Entry& entry = resolve(handle);
+    if (entry.loaded)
+        entry.lastUsedFrame = frame;
+}
+
+const OpaqueBounds& TextureCache::bounds(TextureHandle handle) {
+    return touch(handle).bounds;
+}
+
+TextureHandle TextureCache::handleOf(const sf::Texture& texture) const {
+    auto found = handleByTexture.find(&texture);
+    if (found == handleByTexture.end())
+        return {};
+    return TextureHandle{ found->second };
+}
+
+sf::IntRect TextureCache::canvasRect(TextureHandle handle) const {
+    const Entry& entry = resolve(handle);
+    return entry.loaded ? entry.canvasRect : sf::IntRect{};
+}
+
+void TextureCache::pin(TextureHandle handle) {
+    Entry& entry = resolve(handle);
+    ++entry.pins;
+    entry.dropWhenUnused = false;
+}
+
+void TextureCache::unpin(TextureHandle handle) {
+    Entry& entry = resolve(handle);
+    if (entry.pins == 0)
+        return;
+    if (--entry.pins == 0)
+        entry.dropWhenUnused = true;
+}
+
+void TextureCache::evict(Entry& entry) {
+    // Reassign instead of destroying so sprites that still point here stay valid.
+    *entry.texture = sf::Texture();
+    entry.loaded = false;
+    resident -= entry.bytes;
+    entry.bytes = 0;
+}
+
+std::size_t TextureCache::residentCount() const {
+    return static_cast<std::size_t>(std::count_if(entries.begin(), entries.end(),
+                                                  [](const Entry& entry) { return entry.loaded; }));
+}
+
+void TextureCache::trim() {
+    for (auto& entry : entries) {
+        if (!entry.dropWhenUnused || entry.lastUsedFrame >= frame)
+            continue;
+        if (entry.loaded)
+            evict(entry);
+        // A prefetch still in flight keeps the flag, so its texture goes as soon as it lands.
+        if (!entry.prefetched.valid() && !entry.uploading)
+            entry.dropWhenUnused = false;
+    }
+    if (budgetBytes == 0 || resident <= budgetBytes)
+        return;
+
+    std::vector<Entry*> candidates;
+    for (auto& entry : entries) {
+        if (entry.loaded && entry.pins == 0 && entry.lastUsedFrame < frame)
+            candidates.push_back(&entry);
+    }
+    std::sort(candidates.begin(), candidates.end(), [](const Entry* a, const Entry* b) {
+        return a->lastUsedFrame < b->lastUsedFrame;
+    });
+
+    for (Entry* entry : candidates) {
+        if (resident <= budgetBytes)
+            break;
+        evict(*entry);
+    }
+}
+
+} // namespace assets
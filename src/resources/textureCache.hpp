@@ -0,0 +1,143 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>        // Provides std::size_t for byte counts.
+#include <cstdint>        // Stores handle indexes and frame numbers.
+#include <future>         // Holds images decoding on a background thread.
+#include <limits>         // Marks the invalid handle index.
+#include <memory>         // Keeps every sf::Texture at a stable address.
+#include <optional>       // Holds the metadata of a texture while its pixels upload.
+#include <string>         // Holds the path and label of each cached texture.
+#include <unordered_map>  // Maps texture addresses back to their handles.
+#include <vector>         // Stores the registered entries, indexed by handle.
+// === SFML Libraries ===
+#include <SFML/Graphics/Image.hpp>    // Carries prefetched pixels from the decode thread to the upload.
+#include <SFML/Graphics/Rect.hpp>     // Stores where the original canvas lies relative to a trimmed texture.
+#include <SFML/Graphics/Texture.hpp>  // Declares the sf::Texture objects the cache owns.
+// === Header Files ===
+#include "resources/assetProfiler.hpp"  // Carries the load timings reported under --asset-report.
+#include "resources/opaqueBounds.hpp"   // Measures each texture when it is (re)loaded.
+#include "resources/textureUploader.hpp" // Uploads prefetched images off the render thread.
+
+namespace assets {
+
+// Stable id of a texture owned by TextureCache. Stays valid across evictions.
+struct TextureHandle {
+    static constexpr std::uint32_t kInvalid = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index = kInvalid;
+
+    explicit operator bool() const { return index != kInvalid; }
+    friend bool operator==(TextureHandle, TextureHandle) = default;
+};
+
+// Loads textures on first use and evicts the least recently used ones once their GPU size
+// exceeds the budget. Textures used during the current frame are never evicted, and every
+// sf::Texture keeps its address for the whole run, so an evicted texture is simply reloaded
+// into the same object the next time get() is called. An entry whose file turns out to be
+// byte-identical to another entry's (same trim setting) resolves to that entry from then on.
+class TextureCache {
+public:
+    // Registers a file without loading it. With trimMargins the fully transparent border is
+    // cut off at load time; canvasRect() then tells how to draw the original canvas.
+    TextureHandle add(std::string path, std::string label, bool trimMargins = false);
+
+    // Returns the texture, loading it if needed, and marks it as used in the current frame.
+    const sf::Texture& get(TextureHandle handle);
+    // Marks the texture as used if it is loaded, without loading it. Lets scenes that keep
+    // sf::Texture pointers across frames protect them from eviction.
+    void retain(TextureHandle handle);
+    // Keeps the texture out of eviction until the matching unpin(); pins nest. Once the last pin
+    // is gone the texture is evicted by the first trim() of a frame that did not use it, even
+    // under budget.
+    void pin(TextureHandle handle);
+    void unpin(TextureHandle handle);
+    // Starts decoding the file on a background thread unless it is loaded or already pending.
+    // collectPrefetched() uploads it once done; a get() that arrives first waits for the decode
+    // instead of starting a second one and records a stall.
+    void prefetch(TextureHandle handle);
+    // Moves prefetched uploads onto a thread with a shared GL context. Call once the window
+    // exists; without it collectPrefetched() uploads on the calling thread.
+    void enableBackgroundUploads();
+    // Uploads every prefetched image that finished decoding, or hands it to the upload thread and
+    // publishes the uploads that finished there. Call once per frame on the GL thread.
+    void collectPrefetched();
+    bool isResident(TextureHandle handle) const { return resolve(handle).loaded; }
+    // True if a get() had to wait for this texture's prefetch since prefetch() was last called.
+    bool stalledOnPrefetch(TextureHandle handle) const { return resolve(handle).stalled; }
+    const std::string& label(TextureHandle handle) const { return entries[handle.index].label; }
+    // Opaque bounds measured when the texture was loaded (loads it if needed).
+    const OpaqueBounds& bounds(TextureHandle handle);
+    // Handle of a texture returned by get(); invalid for textures the cache does not own.
+    TextureHandle handleOf(const sf::Texture& texture) const;
+    // Texture rect that spans the original canvas of a loaded texture (empty while unloaded).
+    // Equals the texture size when nothing was trimmed; otherwise it starts at the negative
+    // trim offset.
+    sf::IntRect canvasRect(TextureHandle handle) const;
+
+    // Budget in bytes for resident textures; 0 disables eviction.
+    void setBudget(std::size_t bytes) { budgetBytes = bytes; }
+    // Starts a new frame for last-used tracking.
+    void beginFrame() { ++frame; }
+    // Evicts unpinned textures no scene wants any more, then least recently used textures until
+    // the resident size fits the budget.
+    void trim();
+
+    std::size_t residentBytes() const { return resident; }
+    // Number of textures currently uploaded.
+    std::size_t residentCount() const;
+    std::size_t budget() const { return budgetBytes; }
+
+private:
+    // Everything load() needs before the upload; produced on the calling or a prefetch thread.
+    struct Decoded {
+        sf::Image image;
+        OpaqueBounds bounds;
+        sf::IntRect canvasRect;
+        AssetLoadRecord report;  // Read/decode timings; only filled while the profiler is on.
+        const sf::Texture* original = nullptr;  // Set instead of the image when the bytes were claimed before.
+        bool ok = false;
+    };
+
+    struct Entry {
+        std::string path;
+        std::string label;
+        std::unique_ptr<sf::Texture> texture;
+        OpaqueBounds bounds;   // Normalized to the original canvas, not the trimmed texture.
+        sf::IntRect canvasRect;
+        std::size_t bytes = 0;
+        std::uint64_t lastUsedFrame = 0;
+        bool loaded = false;
+        bool failed = false;   // Reported once; the empty texture is returned afterwards.
+        bool trimMargins = false;
+        bool stalled = false;  // A get() waited on the prefetch below.
+        bool dropWhenUnused = false;  // The last pin went away; evict regardless of the budget.
+        std::uint32_t pins = 0;
+        std::uint32_t sharedWith = TextureHandle::kInvalid;  // Identical entry this one resolves to.
+        std::future<Decoded> prefetched;
+        std::optional<Decoded> uploading;  // Bounds and timings while the upload thread has the pixels.
+    };
+
+    static Decoded decode(const std::string& path, bool trimMargins, const sf::Texture* target);
+    // The entry that actually holds handle's texture: itself, or the identical one it shares.
+    const Entry& resolve(TextureHandle handle) const;
+    Entry& resolve(TextureHandle handle);
+    Entry& touch(TextureHandle handle);
+    void load(Entry& entry);
+    void evict(Entry& entry);
+    void upload(Entry& entry, Decoded decoded);
+    // Uploads on the upload thread when enabled, otherwise right here.
+    void startUpload(std::uint32_t index, Decoded decoded);
+    void adoptUpload(TextureUploader::Finished finished);
+    // Bookkeeping shared by both upload paths once the pixels are on the GPU (or failed to get there).
+    void finishLoad(Entry& entry, Decoded decoded, bool ok, double uploadMs);
+
+    std::vector<Entry> entries;
+    std::unordered_map<const sf::Texture*, std::uint32_t> handleByTexture;
+    std::vector<std::uint32_t> pendingPrefetches;  // Entries whose prefetch has not been uploaded yet.
+    std::unique_ptr<TextureUploader> uploader;     // Null until enableBackgroundUploads().
+    std::size_t budgetBytes = 0;
+    std::size_t resident = 0;
+    std::uint64_t frame = 1;
+};
+
+} // namespace assets
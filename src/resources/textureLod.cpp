@@ -0,0 +1,115 @@
+// === C++ Libraries ===
+#include <algorithm>  // Clamps the selected level.
+#include <cmath>      // Picks the level from the log2 of the minification.
+#include <cstdint>    // Reads and writes 8-bit RGBA channels.
+#include <iostream>   // Reports levels that fail to upload.
+#include <utility>    // Moves each level into the chain.
+// === Header Files ===
+#include "resources/textureLod.hpp"  // Declares the LOD helpers implemented below.
+
+namespace assets {
+
+sf::Image halveImage(const sf::Image& image) {
+    const sf::Vector2u size = image.getSize();
+    const sf::Vector2u half{ std::max(1u, size.x / 2), std::max(1u, size.y / 2) };
+    std::vector<std::uint8_t> pixels(static_cast<std::size_t>(half.x) * half.y * 4);
+    const std::uint8_t* source = image.getPixelsPtr();
+    const std::size_t stride = static_cast<std::size_t>(size.x) * 4;
+    // A 1px edge repeats itself instead of reading past the row or column.
+    const std::size_t stepX = size.x > 1 ? 4 : 0;
+    const std::size_t stepY = size.y > 1 ? stride : 0;
+
+    std::uint8_t* out = pixels.data();
+    for (unsigned int y = 0; y < half.y; ++y) {
+        const std::uint8_t* top = source + static_cast<std::size_t>(y) * 2 * stride;
+        const std::uint8_t* bottom = top + stepY;
+        for (unsigned int x = 0; x < half.x; ++x, top += 2 * stepX, bottom += 2 * stepX, out += 4) {
+            const std::uint8_t* quad[4] = { top, top + stepX, bottom, bottom + stepX };
+            std::uint32_t alpha = 0;
+            std::uint32_t rgb[3] = {};
+            for (const std::uint8_t* p : quad) {
+                alpha += p[3];
+                for (int c = 0; c < 3; ++c)
+                    rgb[c] += static_cast<std::uint32_t>(p[c]) * p[3];
+            }
+            for (int c = 0; c < 3; ++c)
+                out[c] = static_cast<std::uint8_t>(alpha ? (rgb[c] + alpha / 2) / alpha : 0);
+            out[3] = static_cast<std::uint8_t>((alpha + 2) / 4);
+        }
+    }
+    return sf::Image(half, pixels.data());
+}
+
+std::vector<sf::Image> buildLodImages(const sf::Image& image) {
+    std::vector<sf::Image> levels;
+    const sf::Image* previous = &image;
+    while (levels.size() < kMaxLodLevels) {
+        const sf::Vector2u size = previous->getSize();
+        if (std::max(size.x, size.y) / 2 < kMinLodEdge)
+            break;
+        levels.push_back(halveImage(*previous));
+        previous = &levels.back();
+    }
+    return levels;
+}
+
+void TextureLods::add(const sf::Texture& texture, const std::vector<sf::Image>& images) {
+    if (images.empty() || chains.contains(&texture))
+        return;
+    std::vector<sf::Texture> levels;
+    levels.reserve(images.size());
+    for (const sf::Image& image : images) {
+        sf::Texture& level = levels.emplace_back();
+        if (!level.loadFromImage(image)) {
+            std::cout << "Failed to load texture LOD level " << levels.size() << "\n";
+            levels.pop_back();
+            break;
+        }
+        level.setSmooth(texture.isSmooth());
+    }
+    if (!levels.empty())
+        chains.emplace(&texture, std::move(levels));
+}
+
+const sf::Texture& TextureLods::select(const sf::Texture& texture, float scale, float& texelSize) const {
+    texelSize = 1.0f;
+    auto found = chains.find(&texture);
+    if (found == chains.end() || scale <= 0.0f || scale >= 0.5f)
+        return texture;
+    // Level L is 2^L times smaller; flooring keeps the level at or above the drawn size.
+    const int level = std::min(static_cast<int>(std::floor(std::log2(1.0f / scale))),
+                               static_cast<int>(found->second.size()));
+    if (level < 1)
+        return texture;
+    const sf::Texture& chosen = found->second[static_cast<std::size_t>(level - 1)];
+    // Levels drop odd edges, so the ratio comes from the real sizes rather than 2^L.
+    texelSize = static_cast<float>(texture.getSize().x) / static_cast<float>(chosen.getSize().x);
+    return chosen;
+}
+
+std::size_t TextureLods::levelCount(const sf::Texture& texture) const {
+    auto found = chains.find(&texture);
+    return found == chains.end() ? 0 : found->second.size();
+}
+
+std::size_t TextureLods::residentBytes() const {
+    std::size_t bytes = 0;
+    for (const auto& [texture, levels] : chains)
+        for (const sf::Texture& level : levels)
+            bytes += static_cast<std::size_t>(level.getSize().x) * level.getSize().y * 4;
+    return bytes;
+}
+
+TextureLods& textureLods() {
+    static TextureLods instance;
+    return instance;
+}
+
+sf::Sprite lodSprite(const sf::Texture& texture, float scale) {
+    float texelSize = 1.0f;
+    sf::Sprite sprite(textureLods().select(texture, scale, texelSize));
+    sprite.setScale({ scale * texelSize, scale * texelSize });
+    return sprite;
+}
+
+} // namespace assets
@@ -0,0 +1,49 @@
+#pragma once
+// === C++ Libraries ===
+#include <cstddef>        // Provides std::size_t for level counts and byte sizes.
+#include <unordered_map>  // Finds the chain of a texture by its address.
+#include <vector>         // Holds the levels of each chain.
+// === SFML Libraries ===
+#include <SFML/Graphics/Image.hpp>    // Levels are filtered on the decoded CPU-side pixels.
+#include <SFML/Graphics/Sprite.hpp>   // Returned by lodSprite, already scaled.
+#include <SFML/Graphics/Texture.hpp>  // Declares the level textures.
+
+namespace assets {
+
+// Levels stop once the longer edge would drop below this, or after kMaxLodLevels halvings.
+inline constexpr unsigned int kMinLodEdge = 64;
+inline constexpr std::size_t kMaxLodLevels = 4;
+
+// Halves image with a 2x2 box filter. Colours are weighted by alpha, so transparent pixels
+// do not darken the edges of the art; odd last rows and columns are dropped.
+sf::Image halveImage(const sf::Image& image);
+// Every level below image: half size, quarter size, ... Safe to call on a decode thread.
+std::vector<sf::Image> buildLodImages(const sf::Image& image);
+
+// Pre-scaled copies of full-size textures that are drawn both large and small (manifest flag
+// `lod`, weapon cards). Small draws sample a level close to their on-screen size instead of
+// minifying 2048px art, which shimmers without mipmaps and reads far more texels.
+// Levels are uploaded on the GL thread and kept for the whole run.
+class TextureLods {
+public:
+    // Uploads images (from buildLodImages) as the levels of texture.
+    void add(const sf::Texture& texture, const std::vector<sf::Image>& images);
+    // Level to sample when texture is drawn at scale (screen pixels per texel), and how many
+    // full-size texels one level texel covers. The texture itself when it has no chain.
+    const sf::Texture& select(const sf::Texture& texture, float scale, float& texelSize) const;
+    // Number of levels uploaded for texture; 0 when it has no chain.
+    std::size_t levelCount(const sf::Texture& texture) const;
+    // GPU bytes of every level.
+    std::size_t residentBytes() const;
+
+private:
+    std::unordered_map<const sf::Texture*, std::vector<sf::Texture>> chains;
+};
+
+TextureLods& textureLods();
+
+// Sprite that draws texture at scale through the closest level that is still at least as
+// large as the drawn size. The scale is already applied; don't call setScale on it again.
+sf::Sprite lodSprite(const sf::Texture& texture, float scale);
+
+} // namespace assets
@@ -0,0 +1,142 @@
+// === C++ Libraries ===
+#include <algorithm>  // Finds a waited-for ticket among the finished uploads.
+#include <cstdint>    // Declares the GL sync types without pulling in GL headers.
+#include <utility>    // Moves images and textures between the threads.
+// === SFML Libraries ===
+#include <SFML/System/Clock.hpp>   // Times the upload and fence wait.
+#include <SFML/Window/Context.hpp> // Gives the upload thread a context shared with the window.
+// === Header Files ===
+#include "resources/textureUploader.hpp"  // Declares TextureUploader implemented below.
+
+namespace assets {
+namespace {
+#if defined(_WIN32) && !defined(_WIN64)
+#define GLANDULAR_GL_CALL __stdcall
+#else
+#define GLANDULAR_GL_CALL
+#endif
+
+// GL 3.2 / ARB_sync, resolved at run time through SFML so no GL headers or libraries are needed.
+using GlSync = void*;
+using FenceSyncFn = GlSync (GLANDULAR_GL_CALL*)(unsigned int condition, unsigned int flags);
+using ClientWaitSyncFn = unsigned int (GLANDULAR_GL_CALL*)(GlSync sync, unsigned int flags, std::uint64_t timeout);
+using DeleteSyncFn = void (GLANDULAR_GL_CALL*)(GlSync sync);
+using FinishFn = void (GLANDULAR_GL_CALL*)();
+
+constexpr unsigned int kSyncGpuCommandsComplete = 0x9117;
+constexpr unsigned int kSyncFlushCommandsBit = 0x00000001;
+constexpr unsigned int kTimeoutExpired = 0x911B;
+constexpr std::uint64_t kWaitSliceNs = 1'000'000;
+
+struct GpuSync {
+    FenceSyncFn fenceSync = nullptr;
+    ClientWaitSyncFn clientWaitSync = nullptr;
+    DeleteSyncFn deleteSync = nullptr;
+    FinishFn finish = nullptr;
+
+    // Needs the calling thread's context to be active.
+    static GpuSync load() {
+        GpuSync sync;
+        sync.fenceSync = reinterpret_cast<FenceSyncFn>(sf::Context::getFunction("glFenceSync"));
+        sync.clientWaitSync = reinterpret_cast<ClientWaitSyncFn>(sf::Context::getFunction("glClientWaitSync"));
+        sync.deleteSync = reinterpret_cast<DeleteSyncFn>(sf::Context::getFunction("glDeleteSync"));
+        sync.finish = reinterpret_cast<FinishFn>(sf::Context::getFunction("glFinish"));
+        return sync;
+    }
+
+    // Returns once every command issued on this thread so far has executed on the GPU.
+    void waitForGpu() const {
+        if (fenceSync && clientWaitSync && deleteSync) {
+            GlSync fence = fenceSync(kSyncGpuCommandsComplete, 0);
+            if (fence) {
+                // Only the first wait flushes; later slices just keep waiting.
+                unsigned int flags = kSyncFlushCommandsBit;
+                while (clientWaitSync(fence, flags, kWaitSliceNs) == kTimeoutExpired)
+                    flags = 0;
+                deleteSync(fence);
+                return;
+            }
+        }
+        if (finish)
+            finish();
+    }
+};
+
+#undef GLANDULAR_GL_CALL
+} // namespace
+
+TextureUploader::TextureUploader()
+: worker([this]() { run(); })
+{}
+
+TextureUploader::~TextureUploader() {
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+        jobs.clear();
+    }
+    jobAdded.notify_one();
+    worker.join();
+}
+
+void TextureUploader::submit(std::uint32_t ticket, sf::Image image) {
+    {
+        std::lock_guard lock(mutex);
+        jobs.push_back(Job{ ticket, std::move(image) });
+    }
+    jobAdded.notify_one();
+}
+
+std::vector<TextureUploader::Finished> TextureUploader::collect() {
+    std::vector<Finished> done;
+    std::lock_guard lock(mutex);
+    while (!finished.empty()) {
+        done.push_back(std::move(finished.front()));
+        finished.pop_front();
+    }
+    return done;
+}
+
+TextureUploader::Finished TextureUploader::wait(std::uint32_t ticket) {
+    std::unique_lock lock(mutex);
+    auto isTicket = [ticket](const Finished& upload) { return upload.ticket == ticket; };
+    jobFinished.wait(lock, [&]() { return std::any_of(finished.begin(), finished.end(), isTicket); });
+    auto found = std::find_if(finished.begin(), finished.end(), isTicket);
+    Finished upload = std::move(*found);
+    finished.erase(found);
+    return upload;
+}
+
+void TextureUploader::run() {
+    // Active on this thread for its whole life; SFML shares its objects with every other context.
+    sf::Context context;
+    const GpuSync sync = GpuSync::load();
+
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lock(mutex);
+            jobAdded.wait(lock, [this]() { return stopping || !jobs.empty(); });
+            if (stopping)
+                return;
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        Finished upload;
+        upload.ticket = job.ticket;
+        sf::Clock clock;
+        upload.ok = upload.texture.loadFromImage(job.image);
+        if (upload.ok)
+            sync.waitForGpu();
+        upload.uploadMs = static_cast<double>(clock.getElapsedTime().asMicroseconds()) / 1000.0;
+
+        {
+            std::lock_guard lock(mutex);
+            finished.push_back(std::move(upload));
+        }
+        jobFinished.notify_all();
+    }
+}
+
+} // namespace assets
@@ -0,0 +1,57 @@
+#pragma once
+// === C++ Libraries ===
+#include <condition_variable>  // Wakes the upload thread and callers waiting for a result.
+#include <cstdint>             // Identifies uploads by the caller's ticket.
+#include <deque>               // Queues pending and finished uploads in order.
+#include <mutex>               // Guards the queues shared with the upload thread.
+#include <thread>              // Runs the uploads next to the render thread.
+#include <vector>              // Returns the finished uploads of a frame.
+// === SFML Libraries ===
+#include <SFML/Graphics/Image.hpp>    // Carries the decoded pixels to the upload thread.
+#include <SFML/Graphics/Texture.hpp>  // Receives the uploaded pixels.
+
+namespace assets {
+
+// Uploads decoded images on its own thread with its own sf::Context, which SFML shares with the
+// window's, so loadFromImage never blocks the frame. After each upload the thread waits on a GL
+// fence (glFinish where sync objects are missing), so a published texture is complete on the GPU
+// and the render thread can draw it without an implicit wait.
+class TextureUploader {
+public:
+    struct Finished {
+        std::uint32_t ticket = 0;
+        sf::Texture texture;
+        double uploadMs = 0.0;  // Upload plus fence wait, on the upload thread.
+        bool ok = false;
+    };
+
+    TextureUploader();
+    ~TextureUploader();
+    TextureUploader(const TextureUploader&) = delete;
+    TextureUploader& operator=(const TextureUploader&) = delete;
+
+    // Queues image for upload; ticket comes back with the result.
+    void submit(std::uint32_t ticket, sf::Image image);
+    // Every upload that finished since the last call, in completion order. Never blocks.
+    std::vector<Finished> collect();
+    // Blocks until ticket is done and returns it; for callers that need the texture this frame.
+    Finished wait(std::uint32_t ticket);
+
+private:
+    struct Job {
+        std::uint32_t ticket = 0;
+        sf::Image image;
+    };
+
+    void run();
+
+    std::mutex mutex;
+    std::condition_variable jobAdded;
+    std::condition_variable jobFinished;
+    std::deque<Job> jobs;
+    std::deque<Finished> finished;
+    bool stopping = false;
+    std::thread worker;  // Declared last so it starts after the queues exist.
+};
+
+} // namespace assets
@@ -1,10 +1,13 @@
 #pragma once
 #include <algorithm>  // Used for removing icons and clamping values.
 #include <cctype>
+#include <cstdint>    // Stores the dialogue context version.
+#include <optional>   // Holds the last dialogue context snapshot.
 // === Header Files ===
 #include "core/game.hpp"              // Accesses Game state manipulated while handling dialogue.
 #include "core/itemActivation.hpp"
 #include "dialogueLine.hpp"           // Uses DialogueLine metadata processed on Enter.
+#include "dialogueTemplate.hpp"       // Parses dialogue placeholders once and caches their expansion.
 #include "textStyles.hpp"             // Formats speaker names and checks speaker IDs.
 #include "ui/confirmationUI.hpp"      // Shows the name-confirmation modal.
 #include "ui/quizUI.hpp"              // References quiz controls triggered mid-dialogue.
@@ -13,6 +16,7 @@
 #include "helper/healingPotion.hpp"    // Starts the potion timer that restores health.
 #include "mapTutorial.hpp"            // Defines Tory Tailor map tutorial steps.
 #include "story/quests.hpp"           // Knows which quest should fire at each dialogue line.
+#include "resources/assetUsage.hpp"   // Notes dialogue sound plays for --trace-asset-usage.
 
 // Collects the actions triggered by pressing Enter during dialogue or name entry.
 struct EnterAction {
@@ -41,15 +45,16 @@ constexpr char kUmbraMapRevealLineText[] = "The Umbra Ossea map is finally clear
 
 inline void removeBrokenWeaponIcons(Game& game) {
     auto& icons = game.itemController.icons();
-    icons.erase(
-        std::remove_if(icons.begin(), icons.end(), [&](const core::ItemIcon& icon) {
-            const sf::Texture& texture = icon.sprite.getTexture();
-            return &texture == &game.resources.weaponHolmabirBroken
-                || &texture == &game.resources.weaponKattkavarBroken
-                || &texture == &game.resources.weaponStiggedinBroken;
-        }),
-        icons.end()
-    );
+    auto firstRemoved = std::remove_if(icons.begin(), icons.end(), [&](const core::ItemIcon& icon) {
+        const sf::Texture& texture = icon.sprite.getTexture();
+        return &texture == &game.resources.texture(TextureId::WeaponHolmabirBroken)
+            || &texture == &game.resources.texture(TextureId::WeaponKattkavarBroken)
+            || &texture == &game.resources.texture(TextureId::WeaponStiggedinBroken);
+    });
+    if (firstRemoved == icons.end())
+        return;
+    icons.erase(firstRemoved, icons.end());
+    game.layoutDirty.items = true;
 }
 
 inline void openBlacksmithWeaponSelection(Game& game, const std::string& processed) {
@@ -94,7 +99,7 @@ inline void giveForgedWeapon(Game& game) {
         return key;
     };
     std::string key = makeItemKey(game.weaponOptions[game.selectedWeaponIndex].displayName);
-    game.itemController.addItem(tex, key);
+    game.itemController.addItem(*tex, key);
     game.weaponItemAdded = true;
     core::itemActivation::activateItem(game, key);
 }
@@ -102,12 +107,12 @@ inline void giveForgedWeapon(Game& game) {
 inline void giveMapItem(Game& game) {
     if (game.mapItemCollected)
         return;
-    game.itemController.addItem(game.resources.mapGlandular, "map_glandular");
+    game.itemController.addItem(game.resources.texture(TextureId::MapGlandular), "map_glandular");
     game.mapItemCollected = true;
 }
 
 // Replaces placeholder tokens with the correct speaker names (e.g., player input).
-inline std::string injectSpeakerNames(const std::string& text, const Game& game);
+inline const std::string& injectSpeakerNames(const std::string& text, const Game& game);
 
 inline void endMapTutorial(Game& game) {
     if (!game.mapTutorialActive)
@@ -274,6 +279,8 @@ inline void startQuizIntroSequence(Game& game, std::size_t questionIndex) {
     if (quiz.intro.active)
         return;
 
+    // The quiz sounds decode during the intro delay, before startQuiz needs them.
+    game.quizAssets.acquire();
     // Start the intro fade/clocks so the quiz transition can animate.
     quiz.intro.active = true;
     quiz.intro.clock.restart();
@@ -292,6 +299,7 @@ inline void startQuizIntroSequence(Game& game, std::size_t questionIndex) {
     game.audioManager.cancelLocationMusicFade();
     if (game.quizStartSound) {
         game.quizStartSound->stop();
+        assets::notePlay(*game.quizStartSound);
         game.quizStartSound->play();
     }
 }
@@ -314,6 +322,7 @@ inline void maybeTriggerFinalCheer(Game& game, const DialogueLine* activeLine) {
     stopQuestionAudio(game);
     if (game.quizEndSound) {
         game.quizEndSound->stop();
+        assets::notePlay(*game.quizEndSound);
         game.quizEndSound->play();
     }
     if (game.audioManager.hasLocationMusic() && quiz.locationMusicMuted) {
@@ -347,6 +356,7 @@ inline bool advanceDialogueLine(Game& game) {
     game.typewriterClock.restart();
     if (game.enterSound) {
         game.enterSound->stop();
+        assets::notePlay(*game.enterSound);
         game.enterSound->play();
     }
     if (isDragonDialogue(game.currentDialogue)) {
@@ -396,9 +406,9 @@ inline bool advanceDialogueLine(Game& game) {
             // Broken Weapon Popup
             ui::brokenweapon::showPreview(game);
             if (!game.brokenWeaponsStored) {
-                game.itemController.addItem(game.resources.weaponHolmabirBroken, "weapon_holmabir_broken");
-                game.itemController.addItem(game.resources.weaponKattkavarBroken, "weapon_kattkavar_broken");
-                game.itemController.addItem(game.resources.weaponStiggedinBroken, "weapon_stiggedin_broken");
+                game.itemController.addItem(game.resources.texture(TextureId::WeaponHolmabirBroken), "weapon_holmabir_broken");
+                game.itemController.addItem(game.resources.texture(TextureId::WeaponKattkavarBroken), "weapon_kattkavar_broken");
+                game.itemController.addItem(game.resources.texture(TextureId::WeaponStiggedinBroken), "weapon_stiggedin_broken");
                 game.brokenWeaponsStored = true;
             }
         }
@@ -584,6 +594,7 @@ inline bool waitForEnter(Game& game, const DialogueLine& line) {
             game.typewriterClock.restart();
             if (game.enterSound) {
                 game.enterSound->stop();
+                assets::notePlay(*game.enterSound);
                 game.enterSound->play();
             }
             return true;
@@ -748,7 +759,7 @@ inline bool waitForEnter(Game& game, const DialogueLine& line) {
         game.introDialogueFinished = true;
         game.audioManager.stopIntroDialogueMusic();
         game.pendingPerigonalDialogue = true;
-        game.queuedBackgroundTexture = &game.resources.backgroundPetrigonal;
+        game.queuedBackgroundTexture = game.resources.handle(TextureId::BackgroundPetrigonal);
         game.uiFadeOutActive = true;
         game.uiFadeClock.restart();
         // Clear any lingering speaker/text so no portrait/name shows during the transition.
@@ -761,7 +772,7 @@ inline bool waitForEnter(Game& game, const DialogueLine& line) {
     else if (game.currentDialogue == &perigonal) {
         game.introDialogueFinished = true;
         game.pendingGonadPartOneDialogue = true;
-        game.queuedBackgroundTexture = &game.resources.backgroundGonad;
+        game.queuedBackgroundTexture = game.resources.handle(TextureId::BackgroundGonad);
         game.uiFadeOutActive = true;
         game.uiFadeClock.restart();
         // Clear any lingering speaker/text so no portrait/name shows during the transition.
@@ -774,7 +785,7 @@ inline bool waitForEnter(Game& game, const DialogueLine& line) {
     else if (game.currentDialogue == &gonad_part_one) {
         game.introDialogueFinished = true;
         game.pendingBlacksmithDialogue = true;
-        game.queuedBackgroundTexture = &game.resources.backgroundBlacksmith;
+        game.queuedBackgroundTexture = game.resources.handle(TextureId::BackgroundBlacksmith);
         game.uiFadeOutActive = true;
         game.uiFadeClock.restart();
         game.currentDialogue = nullptr;
@@ -786,7 +797,7 @@ inline bool waitForEnter(Game& game, const DialogueLine& line) {
     else if (game.currentDialogue == &blacksmith) {
         game.introDialogueFinished = true;
         game.pendingGonadPartTwoDialogue = true;
-        game.queuedBackgroundTexture = &game.resources.backgroundGonad;
+        game.queuedBackgroundTexture = game.resources.handle(TextureId::BackgroundGonad);
         game.uiFadeOutActive = true;
         game.uiFadeClock.restart();
         game.currentDialogue = nullptr;
@@ -852,6 +863,7 @@ inline bool waitForEnter(Game& game, const DialogueLine& line) {
     // If startDialogue was called (we transitioned to a new dialogue), play enter sound.
     if (transitioned && game.enterSound) {
         game.enterSound->stop();
+        assets::notePlay(*game.enterSound);
         game.enterSound->play();
     }
 
@@ -870,10 +882,11 @@ inline void updateWeaponForging(Game& game) {
                 forging.phase = Game::WeaponForgingState::Phase::Sleeping;
                 forging.clock.restart();
                 if (!game.forgeSound)
-                    game.forgeSound.emplace(game.resources.forgeSound);
+                    game.forgeSound.emplace(game.resources.sound(SoundId::ForgeSound));
                 else
-                    game.forgeSound->setBuffer(game.resources.forgeSound);
+                    game.forgeSound->setBuffer(game.resources.sound(SoundId::ForgeSound));
                 game.forgeSound->setLooping(true);
+                assets::notePlay(*game.forgeSound);
                 game.forgeSound->play();
             }
             break;
@@ -916,9 +929,46 @@ inline bool weaponForgingOverlayVisible(const Game& game) {
     return game.weaponForging.phase != Game::WeaponForgingState::Phase::Idle;
 }
 
-// Replace tokens such as {player} or {weapon} with dynamic names before displaying text.
-inline std::string injectSpeakerNames(const std::string& text, const Game& game) {
-    std::string out = text;
+// Placeholder values plus the version they belong to; see dialogueContext().
+struct DialogueContext {
+    std::uint64_t version = 0;
+    Story::DialoguePlaceholderValues values;
+};
+
+// Returns the placeholder values for the current game state. The version only changes when the
+// player name, gender, weapon, last dragon or last location changed since the previous call.
+inline const DialogueContext& dialogueContext(const Game& game) {
+    struct Snapshot {
+        std::string playerName;
+        Game::DragonbornGender playerGender = Game::DragonbornGender::Female;
+        int selectedWeaponIndex = -1;
+        std::size_t weaponOptionCount = 0;
+        std::string forgedWeaponName;
+        std::string lastDragonName;
+        std::optional<LocationId> lastCompletedLocation;
+    };
+    static DialogueContext context;
+    static std::optional<Snapshot> snapshot;
+
+    if (snapshot
+        && snapshot->playerName == game.playerName
+        && snapshot->playerGender == game.playerGender
+        && snapshot->selectedWeaponIndex == game.selectedWeaponIndex
+        && snapshot->weaponOptionCount == game.weaponOptions.size()
+        && snapshot->forgedWeaponName == game.forgedWeaponName
+        && snapshot->lastDragonName == game.lastDragonName
+        && snapshot->lastCompletedLocation == game.lastCompletedLocation)
+        return context;
+
+    snapshot = Snapshot{
+        game.playerName,
+        game.playerGender,
+        game.selectedWeaponIndex,
+        game.weaponOptions.size(),
+        game.forgedWeaponName,
+        game.lastDragonName,
+        game.lastCompletedLocation
+    };
 
     // Helper that returns the display name of the currently selected weapon (or placeholder).
     auto selectedWeaponName = [&]() -> std::string {
@@ -941,29 +991,6 @@ inline std::string injectSpeakerNames(const std::string& text, const Game& game)
         return "";
     };
 
-    // Replaces every occurrence of a placeholder token with the provided value.
-    auto replaceToken = [&](const std::string& token, const std::string& value) {
-        if (value.empty())
-            return;
-
-        std::size_t pos = 0;
-        while ((pos = out.find(token, pos)) != std::string::npos) {
-            out.replace(pos, token.size(), value);
-            pos += value.size();
-        }
-    };
-
-    // Expand each known placeholder with its current runtime value.
-    replaceToken("{player}", game.playerName);
-    replaceToken("{playerName}", game.playerName);
-    replaceToken("{fireDragon}", TextStyles::speakerStyle(TextStyles::SpeakerId::FireDragon).name);
-    replaceToken("{waterDragon}", TextStyles::speakerStyle(TextStyles::SpeakerId::WaterDragon).name);
-    replaceToken("{earthDragon}", TextStyles::speakerStyle(TextStyles::SpeakerId::EarthDragon).name);
-    replaceToken("{airDragon}", TextStyles::speakerStyle(TextStyles::SpeakerId::AirDragon).name);
-    replaceToken("{lastDragonName}", game.lastDragonName);
-    replaceToken("{weapon}", selectedWeaponName());
-    replaceToken("{lastLocation}", lastLocationName());
-    replaceToken("{weaponName}", forgedWeaponName());
     auto otherGender = (game.playerGender == Game::DragonbornGender::Male)
         ? Game::DragonbornGender::Female
         : Game::DragonbornGender::Male;
@@ -992,14 +1019,36 @@ inline std::string injectSpeakerNames(const std::string& text, const Game& game)
         ownPossessive,
         playerSibling
     );
-    replaceToken("{dragonbornName}", otherName);
-    replaceToken("{dragonbornSubject}", otherSubject);
-    replaceToken("{dragonbornObject}", otherObject);
-    replaceToken("{dragonbornPossessive}", otherPossessive);
-    replaceToken("{dragonbornPossessivePronoun}", otherPossessivePronoun);
-    replaceToken("{dragonbornSibling}", otherSibling);
-    replaceToken("{dragonbornSiblingName}", otherSiblingName);
-    replaceToken("{dragonbornOwnPossessive}", ownPossessive);
-    replaceToken("{playerSibling}", playerSibling);
-    return out;
+
+    using Story::DialoguePlaceholder;
+    auto set = [&](DialoguePlaceholder placeholder, std::string value) {
+        context.values[static_cast<std::size_t>(placeholder)] = std::move(value);
+    };
+    set(DialoguePlaceholder::Player, game.playerName);
+    set(DialoguePlaceholder::FireDragon, TextStyles::speakerStyle(TextStyles::SpeakerId::FireDragon).name);
+    set(DialoguePlaceholder::WaterDragon, TextStyles::speakerStyle(TextStyles::SpeakerId::WaterDragon).name);
+    set(DialoguePlaceholder::EarthDragon, TextStyles::speakerStyle(TextStyles::SpeakerId::EarthDragon).name);
+    set(DialoguePlaceholder::AirDragon, TextStyles::speakerStyle(TextStyles::SpeakerId::AirDragon).name);
+    set(DialoguePlaceholder::LastDragonName, game.lastDragonName);
+    set(DialoguePlaceholder::Weapon, selectedWeaponName());
+    set(DialoguePlaceholder::LastLocation, lastLocationName());
+    set(DialoguePlaceholder::WeaponName, forgedWeaponName());
+    set(DialoguePlaceholder::DragonbornName, otherName);
+    set(DialoguePlaceholder::DragonbornSubject, otherSubject);
+    set(DialoguePlaceholder::DragonbornObject, otherObject);
+    set(DialoguePlaceholder::DragonbornPossessive, otherPossessive);
+    set(DialoguePlaceholder::DragonbornPossessivePronoun, otherPossessivePronoun);
+    set(DialoguePlaceholder::DragonbornSibling, otherSibling);
+    set(DialoguePlaceholder::DragonbornSiblingName, otherSiblingName);
+    set(DialoguePlaceholder::DragonbornOwnPossessive, ownPossessive);
+    set(DialoguePlaceholder::PlayerSibling, playerSibling);
+    ++context.version;
+    return context;
+}
+
+// Replace tokens such as {player} or {weapon} with dynamic names before displaying text.
+// The text is parsed once and its expansion is reused until dialogueContext() changes version.
+inline const std::string& injectSpeakerNames(const std::string& text, const Game& game) {
+    const DialogueContext& context = dialogueContext(game);
+    return Story::dialogueTemplateFor(text).expand(context.values, context.version);
 }
@@ -0,0 +1,104 @@
+// === C++ Libraries ===
+#include <string_view>    // Compares token names without allocating.
+#include <unordered_map>  // Keeps parsed templates keyed by their source text.
+#include <utility>        // Moves the source text into the template.
+// === Header Files ===
+#include "story/dialogueTemplate.hpp"  // Declares DialogueTemplate implemented below.
+
+namespace Story {
+namespace {
+struct PlaceholderName {
+    std::string_view name;
+    DialoguePlaceholder id;
+};
+
+constexpr std::array<PlaceholderName, 19> kPlaceholderNames{ {
+    { "player", DialoguePlaceholder::Player },
+    { "playerName", DialoguePlaceholder::Player },
+    { "fireDragon", DialoguePlaceholder::FireDragon },
+    { "waterDragon", DialoguePlaceholder::WaterDragon },
+    { "earthDragon", DialoguePlaceholder::EarthDragon },
+    { "airDragon", DialoguePlaceholder::AirDragon },
+    { "lastDragonName", DialoguePlaceholder::LastDragonName },
+    { "weapon", DialoguePlaceholder::Weapon },
+    { "lastLocation", DialoguePlaceholder::LastLocation },
+    { "weaponName", DialoguePlaceholder::WeaponName },
+    { "dragonbornName", DialoguePlaceholder::DragonbornName },
+    { "dragonbornSubject", DialoguePlaceholder::DragonbornSubject },
+    { "dragonbornObject", DialoguePlaceholder::DragonbornObject },
+    { "dragonbornPossessive", DialoguePlaceholder::DragonbornPossessive },
+    { "dragonbornPossessivePronoun", DialoguePlaceholder::DragonbornPossessivePronoun },
+    { "dragonbornSibling", DialoguePlaceholder::DragonbornSibling },
+    { "dragonbornSiblingName", DialoguePlaceholder::DragonbornSiblingName },
+    { "dragonbornOwnPossessive", DialoguePlaceholder::DragonbornOwnPossessive },
+    { "playerSibling", DialoguePlaceholder::PlayerSibling },
+} };
+
+int lookupPlaceholder(std::string_view name) {
+    for (const auto& entry : kPlaceholderNames) {
+        if (entry.name == name)
+            return static_cast<int>(entry.id);
+    }
+    return -1;
+}
+} // namespace
+
+DialogueTemplate::DialogueTemplate(std::string text)
+: source(std::move(text))
+{
+    std::size_t literalStart = 0;
+    std::size_t pos = 0;
+    while ((pos = source.find('{', pos)) != std::string::npos) {
+        std::size_t close = source.find('}', pos + 1);
+        if (close == std::string::npos)
+            break;
+
+        int id = lookupPlaceholder(std::string_view(source).substr(pos + 1, close - pos - 1));
+        if (id == kLiteral) {
+            // Unknown braces stay literal text; keep scanning right after this '{'.
+            ++pos;
+            continue;
+        }
+
+        if (pos > literalStart)
+            pieces.push_back({ literalStart, pos - literalStart, kLiteral });
+        pieces.push_back({ pos, close + 1 - pos, id });
+        hasPlaceholders = true;
+        pos = close + 1;
+        literalStart = pos;
+    }
+    if (literalStart < source.size())
+        pieces.push_back({ literalStart, source.size() - literalStart, kLiteral });
+}
+
+const std::string& DialogueTemplate::expand(const DialoguePlaceholderValues& values, std::uint64_t contextVersion) {
+    if (!hasPlaceholders)
+        return source;
+    if (expansionValid && expandedVersion == contextVersion)
+        return expanded;
+
+    expanded.clear();
+    for (const auto& piece : pieces) {
+        if (piece.placeholder != kLiteral) {
+            const std::string& value = values[static_cast<std::size_t>(piece.placeholder)];
+            if (!value.empty()) {
+                expanded += value;
+                continue;
+            }
+        }
+        expanded.append(source, piece.offset, piece.length);
+    }
+    expansionValid = true;
+    expandedVersion = contextVersion;
+    return expanded;
+}
+
+DialogueTemplate& dialogueTemplateFor(const std::string& text) {
+    static std::unordered_map<std::string, DialogueTemplate> templates;
+    auto found = templates.find(text);
+    if (found != templates.end())
+        return found->second;
+    return templates.try_emplace(text, text).first->second;
+}
+
+} // namespace Story
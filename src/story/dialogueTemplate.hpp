@@ -0,0 +1,67 @@
+#pragma once
+// === C++ Libraries ===
+#include <array>    // Holds one expansion value per placeholder id.
+#include <cstddef>  // Provides std::size_t for span offsets.
+#include <cstdint>  // Stores the context version the cached expansion belongs to.
+#include <string>   // Owns the source text and the expanded result.
+#include <vector>   // Stores the parsed literal/placeholder pieces.
+
+namespace Story {
+
+// Placeholders understood by injectSpeakerNames (see the token cheatsheet in storyIntro.hpp).
+enum class DialoguePlaceholder : std::uint8_t {
+    Player,                       // {player} and {playerName}
+    FireDragon,
+    WaterDragon,
+    EarthDragon,
+    AirDragon,
+    LastDragonName,
+    Weapon,
+    LastLocation,
+    WeaponName,
+    DragonbornName,
+    DragonbornSubject,
+    DragonbornObject,
+    DragonbornPossessive,
+    DragonbornPossessivePronoun,
+    DragonbornSibling,
+    DragonbornSiblingName,
+    DragonbornOwnPossessive,
+    PlayerSibling,
+    Count
+};
+
+using DialoguePlaceholderValues = std::array<std::string, static_cast<std::size_t>(DialoguePlaceholder::Count)>;
+
+// A dialogue text parsed once into literal spans and placeholder ids. The expansion is
+// cached together with the context version it was built for.
+class DialogueTemplate {
+public:
+    explicit DialogueTemplate(std::string text);
+
+    // Returns the text with every placeholder replaced; only rebuilds when contextVersion changed.
+    // Placeholders whose value is empty stay in the text verbatim, like the old find/replace did.
+    const std::string& expand(const DialoguePlaceholderValues& values, std::uint64_t contextVersion);
+
+private:
+    static constexpr int kLiteral = -1;
+
+    struct Piece {
+        std::size_t offset = 0;     // Span into source (the whole "{token}" for placeholders).
+        std::size_t length = 0;
+        int placeholder = kLiteral;
+    };
+
+    std::string source;
+    std::vector<Piece> pieces;
+    bool hasPlaceholders = false;
+    bool expansionValid = false;
+    std::uint64_t expandedVersion = 0;
+    std::string expanded;
+};
+
+// Returns the template for text, parsing it the first time this exact text is seen.
+// Templates are never evicted: dialogue texts form a fixed set, so references stay valid.
+DialogueTemplate& dialogueTemplateFor(const std::string& text);
+
+} // namespace Story
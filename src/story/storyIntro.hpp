@@ -1,6 +1,7 @@
 #pragma once
 // === C++ Libraries ===
 #include <array>                    // Stores quiz speech entries in fixed-size arrays.
+#include <cstddef>                  // Provides std::size_t for the dynamic token revision.
 #include <string>                   // Holds narration strings for dialogue lines.
 #include <utility>                  // Provides std::pair used by color token helpers.
 #include <vector>                   // Aggregates dialogue sequences and color keywords.
@@ -61,9 +62,10 @@ inline const std::vector<std::pair<std::string, sf::Color>>& colorTokens() {
     return tokens;
 }
 
-namespace {
-    inline std::vector<std::pair<std::string, sf::Color>> dynamicColorTokens;
-}
+// Runtime tokens (player/Dragonborn names and pronouns). Namespace-scope inline variables so every
+// translation unit shares one copy; the revision lets colorizers rebuild only when the set changes.
+inline std::vector<std::pair<std::string, sf::Color>> dynamicColorTokens;
+inline std::size_t dynamicColorTokensRevision = 0;
 
 inline std::vector<std::pair<std::string, sf::Color>> colorTokensWithDynamic() {
     auto tokens = colorTokens();
@@ -83,10 +85,10 @@ inline void refreshDynamicDragonbornTokens(
     std::string dragonbornSiblingName,
     std::string playerSibling
 ) {
-    dynamicColorTokens.clear();
+    std::vector<std::pair<std::string, sf::Color>> refreshed;
     auto add = [&](const std::string& value) {
         if (!value.empty())
-            dynamicColorTokens.emplace_back(value, ColorHelper::Palette::SoftRed);
+            refreshed.emplace_back(value, ColorHelper::Palette::SoftRed);
     };
 
     add(playerName);
@@ -99,6 +101,11 @@ inline void refreshDynamicDragonbornTokens(
     add(dragonbornSibling);
     add(dragonbornSiblingName);
     add(playerSibling);
+
+    if (refreshed == dynamicColorTokens)
+        return;
+    dynamicColorTokens = std::move(refreshed);
+    ++dynamicColorTokensRevision;
 }
 
 // Represents scripted quiz prompts keyed by dragon speaker identity.
@@ -0,0 +1,269 @@
+// === C++ Libraries ===
+#include <algorithm>   // Uses std::clamp/std::max/std::min while resampling and sizing.
+#include <cmath>       // Evaluates the Lanczos kernel.
+#include <cstdint>     // Reads and writes raw RGBA bytes as std::uint8_t.
+#include <filesystem>  // Creates the baked directory tree and measures file sizes.
+#include <fstream>     // Writes the size report.
+#include <iomanip>     // Aligns the report columns.
+#include <iostream>    // Echoes the report and logs failures.
+#include <optional>    // Receives the display size from the manifest.
+#include <set>         // Drops duplicate paths from the manifest.
+#include <sstream>     // Builds the report before it is written out.
+#include <string>      // Holds asset paths.
+#include <string_view> // Compares the command-line flag.
+#include <vector>      // Stores the filter taps and intermediate rows.
+// === SFML Libraries ===
+#include <SFML/Graphics/Image.hpp>  // Decodes the source art and encodes the baked copies.
+// === Header Files ===
+#include "resources/bakedAssets.hpp"  // Provides the per-asset display sizes and baked paths.
+#include "resources/qoiImage.hpp"     // Encodes the fast-decode copies written by --qoi.
+#include "resources/resources.hpp"    // Provides the list of textures Resources::loadAll references.
+
+// Offline tool: downsamples every texture the game draws scaled-to-fit to the largest size it
+// is ever shown at, writes the results to assets_baked/ and prints a size report.
+// Run it from the game's working directory (the build folder, next to assets/).
+// Usage: glandular_bake [--qoi]
+// With --qoi every texture, including those kept at native size, is written as .qoi instead,
+// which skips PNG inflate at load time (see glandular_decode_bench for the numbers).
+
+namespace {
+constexpr float kLanczosRadius = 3.f;
+constexpr float kPi = 3.14159265358979f;
+
+float lanczos(float x) {
+    x = std::abs(x);
+    if (x < 1e-6f)
+        return 1.f;
+    if (x >= kLanczosRadius)
+        return 0.f;
+    float px = kPi * x;
+    return kLanczosRadius * std::sin(px) * std::sin(px / kLanczosRadius) / (px * px);
+}
+
+// Source pixels and normalized weights contributing to one destination pixel.
+struct Taps {
+    unsigned int first = 0;
+    std::vector<float> weights;
+};
+
+// Lanczos-3 taps for shrinking srcSize pixels to dstSize; the kernel is widened by the
+// scale factor so every source pixel contributes (no aliasing on large reductions).
+std::vector<Taps> computeTaps(unsigned int srcSize, unsigned int dstSize) {
+    std::vector<Taps> taps(dstSize);
+    float scale = static_cast<float>(srcSize) / static_cast<float>(dstSize);
+    float support = kLanczosRadius * scale;
+    for (unsigned int i = 0; i < dstSize; ++i) {
+        float center = (static_cast<float>(i) + 0.5f) * scale;
+        int first = std::max(0, static_cast<int>(std::floor(center - support)));
+        int last = std::min(static_cast<int>(srcSize) - 1, static_cast<int>(std::ceil(center + support)));
+
+        Taps& tap = taps[i];
+        tap.first = static_cast<unsigned int>(first);
+        float sum = 0.f;
+        for (int j = first; j <= last; ++j) {
+            float weight = lanczos((static_cast<float>(j) + 0.5f - center) / scale);
+            tap.weights.push_back(weight);
+            sum += weight;
+        }
+        if (sum != 0.f) {
+            for (float& weight : tap.weights)
+                weight /= sum;
+        }
+    }
+    return taps;
+}
+
+// Separable Lanczos-3 resample. Works on premultiplied alpha so transparent pixels do not
+// bleed their (usually black) colour into the edges of the art.
+sf::Image resample(const sf::Image& source, sf::Vector2u dstSize) {
+    const sf::Vector2u srcSize = source.getSize();
+    const std::uint8_t* pixels = source.getPixelsPtr();
+
+    std::vector<float> premultiplied(static_cast<std::size_t>(srcSize.x) * srcSize.y * 4);
+    for (std::size_t i = 0; i < premultiplied.size(); i += 4) {
+        float alpha = pixels[i + 3] / 255.f;
+        premultiplied[i + 0] = pixels[i + 0] * alpha;
+        premultiplied[i + 1] = pixels[i + 1] * alpha;
+        premultiplied[i + 2] = pixels[i + 2] * alpha;
+        premultiplied[i + 3] = pixels[i + 3];
+    }
+
+    // Horizontal pass: srcSize.y rows of dstSize.x pixels.
+    std::vector<Taps> columnTaps = computeTaps(srcSize.x, dstSize.x);
+    std::vector<float> rows(static_cast<std::size_t>(dstSize.x) * srcSize.y * 4, 0.f);
+    for (unsigned int y = 0; y < srcSize.y; ++y) {
+        const float* srcRow = &premultiplied[static_cast<std::size_t>(y) * srcSize.x * 4];
+        float* dstRow = &rows[static_cast<std::size_t>(y) * dstSize.x * 4];
+        for (unsigned int x = 0; x < dstSize.x; ++x) {
+            const Taps& tap = columnTaps[x];
+            float* out = dstRow + static_cast<std::size_t>(x) * 4;
+            for (std::size_t k = 0; k < tap.weights.size(); ++k) {
+                const float* in = srcRow + (tap.first + k) * 4;
+                for (int c = 0; c < 4; ++c)
+                    out[c] += in[c] * tap.weights[k];
+            }
+        }
+    }
+
+    // Vertical pass, then back to straight alpha.
+    std::vector<Taps> rowTaps = computeTaps(srcSize.y, dstSize.y);
+    std::vector<std::uint8_t> result(static_cast<std::size_t>(dstSize.x) * dstSize.y * 4);
+    const std::size_t rowStride = static_cast<std::size_t>(dstSize.x) * 4;
+    for (unsigned int y = 0; y < dstSize.y; ++y) {
+        const Taps& tap = rowTaps[y];
+        for (unsigned int x = 0; x < dstSize.x; ++x) {
+            float accum[4] = { 0.f, 0.f, 0.f, 0.f };
+            for (std::size_t k = 0; k < tap.weights.size(); ++k) {
+                const float* in = &rows[(tap.first + k) * rowStride + static_cast<std::size_t>(x) * 4];
+                for (int c = 0; c < 4; ++c)
+                    accum[c] += in[c] * tap.weights[k];
+            }
+
+            // Lanczos rings slightly past the input range, so clamp before converting back.
+            float alpha = std::clamp(accum[3], 0.f, 255.f);
+            std::uint8_t* out = &result[static_cast<std::size_t>(y) * rowStride + static_cast<std::size_t>(x) * 4];
+            for (int c = 0; c < 3; ++c) {
+                float value = alpha > 0.f ? std::clamp(accum[c], 0.f, alpha) * 255.f / alpha : 0.f;
+                out[c] = static_cast<std::uint8_t>(std::lround(value));
+            }
+            out[3] = static_cast<std::uint8_t>(std::lround(alpha));
+        }
+    }
+
+    return sf::Image(dstSize, result.data());
+}
+
+// Largest size with the source aspect ratio that fits inside maxSize (never upscales).
+sf::Vector2u fitInside(sf::Vector2u size, sf::Vector2u maxSize) {
+    float scale = std::min(
+        static_cast<float>(maxSize.x) / static_cast<float>(size.x),
+        static_cast<float>(maxSize.y) / static_cast<float>(size.y)
+    );
+    if (scale >= 1.f)
+        return size;
+    return {
+        std::max(1u, static_cast<unsigned int>(std::lround(size.x * scale))),
+        std::max(1u, static_cast<unsigned int>(std::lround(size.y * scale)))
+    };
+}
+
+std::uintmax_t fileSize(const std::string& path) {
+    std::error_code error;
+    auto size = std::filesystem::file_size(path, error);
+    return error ? 0 : size;
+}
+
+std::string formatSize(sf::Vector2u size) {
+    return std::to_string(size.x) + "x" + std::to_string(size.y);
+}
+
+double toMegabytes(std::uintmax_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+
+bool writeFile(const std::string& path, const std::vector<std::byte>& bytes) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    return file && file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    namespace fs = std::filesystem;
+
+    // Same as the game: resolve "assets/..." relative to the executable.
+    try {
+        fs::current_path(fs::canonical(argv[0]).parent_path());
+    } catch (...) {
+    }
+
+    const bool writeQoi = argc > 1 && std::string_view(argv[1]) == "--qoi";
+
+    std::set<std::string> paths;
+    for (auto& path : Resources::texturePaths())
+        paths.insert(std::move(path));
+
+    std::ostringstream report;
+    report << std::left << std::setw(72) << "asset" << std::setw(12) << "source"
+           << std::setw(12) << "baked" << std::setw(12) << "file KB" << "VRAM KB\n";
+
+    std::uintmax_t fileBefore = 0;
+    std::uintmax_t fileAfter = 0;
+    std::uintmax_t vramBefore = 0;
+    std::uintmax_t vramAfter = 0;
+    int bakedCount = 0;
+    int failures = 0;
+
+    for (const std::string& path : paths) {
+        std::string bakedPath = assets::bakedPathFor(path);
+        std::string qoiPath = assets::bakedQoiPathFor(path);
+        std::optional<sf::Vector2u> maxSize = assets::maxDisplaySize(path);
+        std::error_code error;
+        // The game prefers a .qoi copy, so a plain bake must not leave one from an earlier --qoi run.
+        if (!writeQoi)
+            fs::remove(qoiPath, error);
+
+        sf::Image image;
+        const bool bake = maxSize || writeQoi;
+        if (!bake || !image.loadFromFile(path)) {
+            if (bake) {
+                std::cout << "Failed to load " << path << "\n";
+                ++failures;
+            }
+            continue;
+        }
+
+        sf::Vector2u srcSize = image.getSize();
+        sf::Vector2u dstSize = maxSize ? fitInside(srcSize, *maxSize) : srcSize;
+        std::uintmax_t srcBytes = fileSize(path);
+        fileBefore += srcBytes;
+        vramBefore += static_cast<std::uintmax_t>(srcSize.x) * srcSize.y * 4;
+
+        if (dstSize == srcSize && !writeQoi) {
+            // Already small enough; drop any copy left over from an older, larger source.
+            fs::remove(bakedPath, error);
+            fileAfter += srcBytes;
+            vramAfter += static_cast<std::uintmax_t>(srcSize.x) * srcSize.y * 4;
+            continue;
+        }
+
+        const std::string& outputPath = writeQoi ? qoiPath : bakedPath;
+        fs::create_directories(fs::path(outputPath).parent_path(), error);
+        if (dstSize != srcSize)
+            image = resample(image, dstSize);
+        const bool saved = writeQoi ? writeFile(qoiPath, assets::encodeQoi(image)) : image.saveToFile(bakedPath);
+        if (!saved) {
+            std::cout << "Failed to save " << outputPath << "\n";
+            ++failures;
+            continue;
+        }
+        if (writeQoi)
+            fs::remove(bakedPath, error);  // Shadowed by the .qoi copy.
+
+        std::uintmax_t dstBytes = fileSize(outputPath);
+        fileAfter += dstBytes;
+        vramAfter += static_cast<std::uintmax_t>(dstSize.x) * dstSize.y * 4;
+        ++bakedCount;
+
+        report << std::setw(72) << path << std::setw(12) << formatSize(srcSize)
+               << std::setw(12) << formatSize(dstSize)
+               << std::setw(12) << (std::to_string(srcBytes / 1024) + "->" + std::to_string(dstBytes / 1024))
+               << (static_cast<std::uintmax_t>(srcSize.x) * srcSize.y * 4 / 1024) << "->"
+               << (static_cast<std::uintmax_t>(dstSize.x) * dstSize.y * 4 / 1024) << "\n";
+    }
+
+    report << std::fixed << std::setprecision(1)
+           << "\nBaked " << bakedCount << " of " << paths.size() << " textures"
+           << (writeQoi ? " as QOI" : "") << " (" << paths.size() - bakedCount << " left as they are).\n"
+           << "Files: " << toMegabytes(fileBefore) << " MB -> " << toMegabytes(fileAfter) << " MB\n"
+           << "VRAM:  " << toMegabytes(vramBefore) << " MB -> " << toMegabytes(vramAfter) << " MB\n";
+
+    std::cout << report.str();
+    std::error_code error;
+    fs::create_directories(std::string(assets::kBakedAssetDir), error);
+    std::string reportPath = std::string(assets::kBakedAssetDir) + "/bake_report.txt";
+    std::ofstream reportFile(reportPath);
+    if (!reportFile || !(reportFile << report.str()))
+        std::cout << "Failed to write " << reportPath << "\n";
+
+    return failures == 0 ? 0 : 1;
+}
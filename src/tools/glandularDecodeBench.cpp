@@ -0,0 +1,129 @@
+// === C++ Libraries ===
+#include <algorithm>    // Keeps the fastest of the timed runs.
+#include <cstring>      // Compares the decoded pixels of both formats.
+#include <filesystem>   // Resolves the working directory like the game does.
+#include <fstream>      // Reads the source art.
+#include <iomanip>      // Aligns the report columns.
+#include <iostream>     // Prints the report and failures.
+#include <iterator>     // Reads a whole file into memory.
+#include <set>          // Drops duplicate paths from the manifest.
+#include <string>       // Holds asset paths and parses --runs.
+#include <string_view>  // Compares the command-line flags.
+#include <vector>       // Holds the file bytes.
+// === SFML Libraries ===
+#include <SFML/Graphics/Image.hpp>  // Decodes the PNG side of the comparison.
+#include <SFML/System/Clock.hpp>    // Times every decode.
+// === Header Files ===
+#include "resources/assetManifest.hpp"  // Lists every texture the game loads.
+#include "resources/qoiImage.hpp"       // Encodes and decodes the QOI side of the comparison.
+
+// Offline tool: decodes every manifest texture from assets/ as PNG (the current load path) and
+// as QOI (what glandular_bake --qoi writes) and prints the time and size of each.
+// Run it from the game's working directory (the build folder, next to assets/).
+// Usage: glandular_decode_bench [--runs N]   (default 3; the fastest run of each is kept)
+
+namespace {
+double elapsedMs(const sf::Clock& clock) {
+    return static_cast<double>(clock.getElapsedTime().asMicroseconds()) / 1000.0;
+}
+
+bool readFile(const std::string& path, std::vector<std::byte>& bytes) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+        return false;
+    std::vector<char> chars((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    bytes.resize(chars.size());
+    std::memcpy(bytes.data(), chars.data(), chars.size());
+    return true;
+}
+
+// Fastest of runs decodes, so a cold cache or a scheduler hiccup does not skew a row.
+template <typename Decode>
+double bestOf(int runs, Decode&& decode) {
+    double best = 0.0;
+    for (int run = 0; run < runs; ++run) {
+        sf::Clock clock;
+        if (!decode())
+            return -1.0;
+        double ms = elapsedMs(clock);
+        best = run == 0 ? ms : std::min(best, ms);
+    }
+    return best;
+}
+
+double toMegabytes(std::size_t bytes) {
+    return static_cast<double>(bytes) / (1024.0 * 1024.0);
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    namespace fs = std::filesystem;
+
+    // Same as the game: resolve "assets/..." relative to the executable.
+    try {
+        fs::current_path(fs::canonical(argv[0]).parent_path());
+    } catch (...) {
+    }
+
+    int runs = 3;
+    if (argc > 2 && std::string_view(argv[1]) == "--runs")
+        runs = std::max(1, std::stoi(argv[2]));
+
+    std::set<std::string> paths;
+    for (const auto& asset : assets::kTextureManifest)
+        paths.insert(asset.path);
+
+    std::cout << std::left << std::setw(72) << "asset" << std::setw(12) << "pixels"
+              << std::setw(16) << "file KB" << "decode ms (png -> qoi)\n" << std::fixed << std::setprecision(2);
+
+    std::size_t pngBytes = 0;
+    std::size_t qoiBytes = 0;
+    double pngMs = 0.0;
+    double qoiMs = 0.0;
+    std::size_t pixels = 0;
+    int compared = 0;
+    int failures = 0;
+
+    for (const std::string& path : paths) {
+        std::vector<std::byte> png;
+        sf::Image reference;
+        if (!readFile(path, png) || !reference.loadFromMemory(png.data(), png.size())) {
+            std::cout << "Failed to load " << path << "\n";
+            ++failures;
+            continue;
+        }
+        const std::vector<std::byte> qoi = assets::encodeQoi(reference);
+        const sf::Vector2u size = reference.getSize();
+
+        sf::Image decoded;
+        double pngRunMs = bestOf(runs, [&] { return decoded.loadFromMemory(png.data(), png.size()); });
+        double qoiRunMs = bestOf(runs, [&] { return assets::decodeQoi(qoi, decoded); });
+        const std::size_t byteCount = static_cast<std::size_t>(size.x) * size.y * 4;
+        if (pngRunMs < 0.0 || qoiRunMs < 0.0 || decoded.getSize() != size
+            || std::memcmp(decoded.getPixelsPtr(), reference.getPixelsPtr(), byteCount) != 0) {
+            std::cout << "QOI round trip differs for " << path << "\n";
+            ++failures;
+            continue;
+        }
+
+        pngBytes += png.size();
+        qoiBytes += qoi.size();
+        pngMs += pngRunMs;
+        qoiMs += qoiRunMs;
+        pixels += static_cast<std::size_t>(size.x) * size.y;
+        ++compared;
+        std::cout << std::setw(72) << path
+                  << std::setw(12) << (std::to_string(size.x) + "x" + std::to_string(size.y))
+                  << std::setw(16) << (std::to_string(png.size() / 1024) + "->" + std::to_string(qoi.size() / 1024))
+                  << pngRunMs << " -> " << qoiRunMs << "\n";
+    }
+
+    const double megapixels = static_cast<double>(pixels) / 1'000'000.0;
+    std::cout << "\nDecoded " << compared << " textures (" << std::setprecision(1) << megapixels
+              << " MP), fastest of " << runs << " run(s) each.\n"
+              << "Files: PNG " << toMegabytes(pngBytes) << " MB, QOI " << toMegabytes(qoiBytes) << " MB\n"
+              << "PNG:   " << pngMs << " ms (" << (pngMs > 0.0 ? megapixels / (pngMs / 1000.0) : 0.0) << " MP/s)\n"
+              << "QOI:   " << qoiMs << " ms (" << (qoiMs > 0.0 ? megapixels / (qoiMs / 1000.0) : 0.0) << " MP/s)\n"
+              << "QOI decodes " << (qoiMs > 0.0 ? pngMs / qoiMs : 0.0) << "x faster\n";
+    return failures == 0 ? 0 : 1;
+}
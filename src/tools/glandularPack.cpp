@@ -0,0 +1,137 @@
+// === C++ Libraries ===
+#include <algorithm>   // Sorts the table of contents by path hash.
+#include <cstdint>     // Fixes the width of the written fields.
+#include <filesystem>  // Walks the asset tree and replaces the old pack.
+#include <fstream>     // Reads the loose files and writes the pack.
+#include <iostream>    // Prints the summary and failures.
+#include <string>      // Holds asset paths.
+#include <vector>      // Collects the files and their bytes.
+// === Header Files ===
+#include "resources/assetPack.hpp"    // Shares the .gpak layout with the runtime reader.
+#include "resources/bakedAssets.hpp"  // Packs the baked copy of a texture when there is one.
+
+// Offline tool: writes every runtime asset into one .gpak file (see resources/assetPack.hpp).
+// Run it from the game's working directory after glandular_bake, so baked art is picked up.
+// Usage: glandular_pack [output path, default glandular.gpak]
+
+namespace {
+// assets/data (rankings) stays loose because the game writes to it; assets/icon and
+// assets/old_textures are not read at runtime.
+constexpr const char* kPackedDirs[] = {
+    "assets/audio",
+    "assets/dragonstones",
+    "assets/fonts",
+    "assets/gfx",
+    "assets/shaders",
+    "assets/textures",
+};
+
+struct PackedFile {
+    std::string path;  // Lookup key, spelled the way the game asks for it.
+    std::vector<char> bytes;
+};
+
+bool readFile(const std::string& path, std::vector<char>& bytes) {
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file)
+        return false;
+    bytes.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    return static_cast<bool>(file.read(bytes.data(), static_cast<std::streamsize>(bytes.size())));
+}
+
+std::uint64_t alignUp(std::uint64_t value) {
+    return (value + assets::kPackAlignment - 1) / assets::kPackAlignment * assets::kPackAlignment;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    namespace fs = std::filesystem;
+
+    // Same as the game: resolve "assets/..." relative to the executable.
+    try {
+        fs::current_path(fs::canonical(argv[0]).parent_path());
+    } catch (...) {
+    }
+    const std::string outputPath = argc > 1 ? argv[1] : assets::kDefaultPackPath;
+
+    std::vector<PackedFile> files;
+    std::uint64_t bakedCount = 0;
+    for (const char* dir : kPackedDirs) {
+        std::error_code error;
+        for (const auto& entry : fs::recursive_directory_iterator(dir, error)) {
+            if (!entry.is_regular_file() || entry.path().filename().string().starts_with("."))
+                continue;
+            PackedFile file;
+            file.path = entry.path().generic_string();
+            std::string source = assets::resolveAssetPath(file.path);
+            if (source != file.path)
+                ++bakedCount;
+            if (!readFile(source, file.bytes)) {
+                std::cout << "Failed to load " << source << "\n";
+                return 1;
+            }
+            files.push_back(std::move(file));
+        }
+    }
+
+    std::vector<assets::PackEntry> entries(files.size());
+    std::uint64_t pathsStart = sizeof(assets::PackHeader) + entries.size() * sizeof(assets::PackEntry);
+    std::uint64_t cursor = pathsStart;
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        entries[i].pathHash = assets::hashAssetPath(files[i].path);
+        entries[i].pathOffset = static_cast<std::uint32_t>(cursor);
+        entries[i].pathLength = static_cast<std::uint32_t>(files[i].path.size());
+        cursor += files[i].path.size();
+    }
+    for (std::size_t i = 0; i < files.size(); ++i) {
+        cursor = alignUp(cursor);
+        entries[i].offset = cursor;
+        entries[i].size = files[i].bytes.size();
+        cursor += files[i].bytes.size();
+    }
+
+    // Files and paths are written in walk order; only the table is sorted for the lookup.
+    std::vector<assets::PackEntry> table = entries;
+    std::stable_sort(table.begin(), table.end(), [](const assets::PackEntry& a, const assets::PackEntry& b) {
+        return a.pathHash < b.pathHash;
+    });
+
+    assets::PackHeader header{};
+    std::copy(std::begin(assets::kPackMagic), std::end(assets::kPackMagic), header.magic);
+    header.version = assets::kPackVersion;
+    header.entryCount = static_cast<std::uint32_t>(table.size());
+
+    const std::string tempPath = outputPath + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(table.data()), static_cast<std::streamsize>(table.size() * sizeof(assets::PackEntry)));
+        for (const auto& file : files)
+            out.write(file.path.data(), static_cast<std::streamsize>(file.path.size()));
+        std::uint64_t written = pathsStart;
+        for (const auto& file : files)
+            written += file.path.size();
+        const std::vector<char> padding(assets::kPackAlignment, 0);
+        for (std::size_t i = 0; i < files.size(); ++i) {
+            out.write(padding.data(), static_cast<std::streamsize>(entries[i].offset - written));
+            out.write(files[i].bytes.data(), static_cast<std::streamsize>(files[i].bytes.size()));
+            written = entries[i].offset + files[i].bytes.size();
+        }
+        if (!out) {
+            std::cout << "Failed to write " << tempPath << "\n";
+            return 1;
+        }
+    }
+
+    std::error_code error;
+    fs::rename(tempPath, outputPath, error);
+    if (error) {
+        std::cout << "Failed to write " << outputPath << ": " << error.message() << "\n";
+        return 1;
+    }
+
+    std::cout << "Packed " << files.size() << " files (" << bakedCount << " baked) into "
+              << outputPath << ", " << cursor / 1024 << " KB\n";
+    return 0;
+}
@@ -12,11 +12,9 @@
 #include <utility>
 #include <memory>
 #include <vector>
-#include <unordered_map>
 #include <unordered_set>
 #include <random>
 
-#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
@@ -27,12 +25,16 @@
 #include "core/game.hpp"
 #include "core/itemActivation.hpp"
 #include "helper/colorHelper.hpp"
+#include "resources/assetFiles.hpp"
+#include "resources/assetProfiler.hpp"
+#include "resources/assetUsage.hpp"
 #include "story/storyIntro.hpp"
 #include "story/textStyles.hpp"
 #include "ui/popupStyle.hpp"
 
 namespace ui::battle {
 void startBattle(Game& game) {
+    game.battleAssets.acquire();
     game.battleDemo = BattleDemoState{};
     game.battleDemo.player.name = game.playerName.empty() ? "Dragonborn" : game.playerName;
     game.state = GameState::BattleDemo;
@@ -169,8 +171,8 @@ namespace {
 
     const sf::Texture* dragonbornBackTexture(const Game& game) {
         return (game.playerGender == Game::DragonbornGender::Female)
-            ? &game.resources.spriteDragonbornFemaleBack
-            : &game.resources.spriteDragonbornMaleBack;
+            ? &game.resources.texture(TextureId::SpriteDragonbornFemaleBack)
+            : &game.resources.texture(TextureId::SpriteDragonbornMaleBack);
     }
 
     std::array<const sf::Texture*, 3> finalizeFriendshipTextures(
@@ -199,9 +201,9 @@ namespace {
                 candidates.push_back(texture);
             }
         };
-        addIfNotActive("wanda", &game.resources.spriteWandaRinnBack);
-        addIfNotActive("will", &game.resources.spriteWillFigsidBack);
-        addIfNotActive("noah", &game.resources.spriteNoahLottBack);
+        addIfNotActive("wanda", &game.resources.texture(TextureId::SpriteWandaRinnBack));
+        addIfNotActive("will", &game.resources.texture(TextureId::SpriteWillFigsidBack));
+        addIfNotActive("noah", &game.resources.texture(TextureId::SpriteNoahLottBack));
         const sf::Texture* dragonbornBack = dragonbornBackTexture(game);
         if (!containsToken(activeName, "dragonborn")) {
             candidates.push_back(dragonbornBack);
@@ -215,11 +217,11 @@ namespace {
             if (!containsToken(activeName, token))
                 candidates.push_back(texture);
         };
-        addIfNotActive("rowsted", &game.resources.spriteRowstedSheacaneBack);
-        addIfNotActive("flawtin", &game.resources.spriteFlawtinSeamenBack);
-        addIfNotActive("gustavo", &game.resources.spriteGustavoWindimaessBack);
-        addIfNotActive("grounded", &game.resources.spriteGroundedClaymoreBack);
-        const sf::Texture* fallback = &game.resources.spriteRowstedSheacaneBack;
+        addIfNotActive("rowsted", &game.resources.texture(TextureId::SpriteRowstedSheacaneBack));
+        addIfNotActive("flawtin", &game.resources.texture(TextureId::SpriteFlawtinSeamenBack));
+        addIfNotActive("gustavo", &game.resources.texture(TextureId::SpriteGustavoWindimaessBack));
+        addIfNotActive("grounded", &game.resources.texture(TextureId::SpriteGroundedClaymoreBack));
+        const sf::Texture* fallback = &game.resources.texture(TextureId::SpriteRowstedSheacaneBack);
         return finalizeFriendshipTextures(candidates, fallback);
     }
 
@@ -374,25 +376,25 @@ namespace {
 
     const sf::SoundBuffer* masterBatesSkillSound(const Game& game, std::string_view skillName) {
         if (skillName == "Midnight Release")
-            return &game.resources.skillMidnightRelease;
+            return &game.resources.sound(SoundId::SkillMidnightRelease);
         if (skillName == "Bad Habit")
-            return &game.resources.skillBadHabit;
+            return &game.resources.sound(SoundId::SkillBadHabit);
         if (skillName == "Shadow Routine")
-            return &game.resources.skillShadowRoutine;
+            return &game.resources.sound(SoundId::SkillShadowRoutine);
         if (skillName == "Guilty Ember")
-            return &game.resources.skillGuiltyEmber;
+            return &game.resources.sound(SoundId::SkillGuiltyEmber);
         return nullptr;
     }
 
     const sf::Texture* masterBatesSkillTexture(const Game& game, std::string_view skillName) {
         if (skillName == "Midnight Release")
-            return &game.resources.skillMasterBatesMidnightRelease;
+            return &game.resources.texture(TextureId::SkillMasterBatesMidnightRelease);
         if (skillName == "Bad Habit")
-            return &game.resources.skillMasterBatesBadHabit;
+            return &game.resources.texture(TextureId::SkillMasterBatesBadHabit);
         if (skillName == "Shadow Routine")
-            return &game.resources.skillMasterBatesShadowRoutine;
+            return &game.resources.texture(TextureId::SkillMasterBatesShadowRoutine);
         if (skillName == "Guilty Ember")
-            return &game.resources.skillMasterBatesGuiltyEmber;
+            return &game.resources.texture(TextureId::SkillMasterBatesGuiltyEmber);
         return nullptr;
     }
 
@@ -484,13 +486,13 @@ namespace {
     const sf::Texture* skillSlashTextureFor(const Game& game, BattleDemoState::SkillElement element) {
         switch (element) {
             case BattleDemoState::SkillElement::Air:
-                return &game.resources.skillSlashAir;
+                return &game.resources.texture(TextureId::SkillSlashAir);
             case BattleDemoState::SkillElement::Earth:
-                return &game.resources.skillSlashEarth;
+                return &game.resources.texture(TextureId::SkillSlashEarth);
             case BattleDemoState::SkillElement::Fire:
-                return &game.resources.skillSlashFire;
+                return &game.resources.texture(TextureId::SkillSlashFire);
             case BattleDemoState::SkillElement::Water:
-                return &game.resources.skillSlashWater;
+                return &game.resources.texture(TextureId::SkillSlashWater);
             default:
                 return nullptr;
         }
@@ -499,13 +501,13 @@ namespace {
     const sf::Texture* skillWeaponTextureFor(const Game& game, BattleDemoState::SkillElement element) {
         switch (element) {
             case BattleDemoState::SkillElement::Air:
-                return &game.resources.skillWeaponAir;
+                return &game.resources.texture(TextureId::SkillWeaponAir);
             case BattleDemoState::SkillElement::Earth:
-                return &game.resources.skillWeaponEarth;
+                return &game.resources.texture(TextureId::SkillWeaponEarth);
             case BattleDemoState::SkillElement::Fire:
-                return &game.resources.skillWeaponFire;
+                return &game.resources.texture(TextureId::SkillWeaponFire);
             case BattleDemoState::SkillElement::Water:
-                return &game.resources.skillWeaponWater;
+                return &game.resources.texture(TextureId::SkillWeaponWater);
             default:
                 return nullptr;
         }
@@ -514,13 +516,13 @@ namespace {
     const sf::SoundBuffer* skillElementSoundFor(const Game& game, BattleDemoState::SkillElement element) {
         switch (element) {
             case BattleDemoState::SkillElement::Air:
-                return &game.resources.skillAir;
+                return &game.resources.sound(SoundId::SkillAir);
             case BattleDemoState::SkillElement::Earth:
-                return &game.resources.skillEarth;
+                return &game.resources.sound(SoundId::SkillEarth);
             case BattleDemoState::SkillElement::Fire:
-                return &game.resources.skillFire;
+                return &game.resources.sound(SoundId::SkillFire);
             case BattleDemoState::SkillElement::Water:
-                return &game.resources.skillWater;
+                return &game.resources.sound(SoundId::SkillWater);
             default:
                 return nullptr;
         }
@@ -673,7 +675,8 @@ namespace {
         evolution.shakeTimer = 0.f;
         evolution.active = true;
         evolution.sound.reset();
-        evolution.sound.emplace(game.resources.chickSound);
+        evolution.sound.emplace(game.resources.sound(SoundId::ChickSound));
+        assets::notePlay(*evolution.sound);
         evolution.sound->play();
         battle.masterBatesDragonActive = true;
         battle.enemy.name = "Master Bates (Dragon)";
@@ -709,7 +712,8 @@ namespace {
         evolution.tint = sf::Color::White;
         evolution.shakeOffset = { 0.f, 0.f };
         evolution.shakeTimer = 0.f;
-        evolution.sound.emplace(game.resources.masterBatesEvolution);
+        evolution.sound.emplace(game.resources.sound(SoundId::MasterBatesEvolution));
+        assets::notePlay(*evolution.sound);
         evolution.sound->play();
         battle.actionTimer = 0.f;
         battle.actionMenuVisible = false;
@@ -749,7 +753,8 @@ namespace {
         effect.pendingHp = 0.f;
         effect.slashSound.reset();
         effect.elementSound.reset();
-        effect.slashSound.emplace(game.resources.skillSlash);
+        effect.slashSound.emplace(game.resources.sound(SoundId::SkillSlash));
+        assets::notePlay(*effect.slashSound);
         effect.slashSound->play();
     }
 
@@ -772,6 +777,7 @@ namespace {
                 effect.slashVisible = false;
                 if (const sf::SoundBuffer* buffer = skillElementSoundFor(game, effect.element)) {
                     effect.elementSound.emplace(*buffer);
+                    assets::notePlay(*effect.elementSound);
                     effect.elementSound->play();
                 } else {
                     effect.phase = BattleDemoState::SkillEffect::Phase::FadeOut;
@@ -908,17 +914,17 @@ namespace {
                          float alpha) {
         if (alpha <= 0.f)
             return;
-        if (game.resources.spriteWandaRinn.getSize().x == 0 || game.resources.spriteWandaRinn.getSize().y == 0)
+        auto baseSize = game.resources.canvasSize(game.resources.texture(TextureId::SpriteWandaRinn));
+        if (baseSize.x == 0 || baseSize.y == 0)
             return;
 
-        auto baseSize = game.resources.spriteWandaRinn.getSize();
         sf::Vector2f targetSize{
             static_cast<float>(baseSize.x) * kFriendshipSpriteTargetFactor,
             static_cast<float>(baseSize.y) * kFriendshipSpriteTargetFactor
         };
 
         auto scaleForTexture = [&](const sf::Texture& texture) {
-            sf::Sprite sprite(texture);
+            sf::Sprite sprite = game.resources.canvasSprite(texture);
             auto bounds = sprite.getLocalBounds();
             float scaleX = (bounds.size.x > 0.f) ? (targetSize.x / bounds.size.x) : 0.f;
             float scaleY = (bounds.size.y > 0.f) ? (targetSize.y / bounds.size.y) : 0.f;
@@ -929,7 +935,7 @@ namespace {
         auto drawSprite = [&](const sf::Texture* texture, const sf::Vector2f& position) -> float {
             if (!texture)
                 return 0.f;
-            sf::Sprite sprite(*texture);
+            sf::Sprite sprite = game.resources.canvasSprite(*texture);
             auto bounds = sprite.getLocalBounds();
             if (bounds.size.x <= 0.f || bounds.size.y <= 0.f)
                 return 0.f;
@@ -943,6 +949,7 @@ namespace {
             sf::Color tint = sf::Color::White;
             tint.a = static_cast<std::uint8_t>(255.f * alpha);
             sprite.setColor(tint);
+            assets::noteDraw(sprite);
             target.draw(sprite);
             return bounds.size.y * scale;
         };
@@ -958,10 +965,10 @@ namespace {
         float frontRowY = centerY + 70.f;
 
         std::array<const sf::Texture*, 4> dragonTextures = {{
-            &game.resources.spriteRowstedSheacane,
-            &game.resources.spriteFlawtinSeamen,
-            &game.resources.spriteGustavoWindimaess,
-            &game.resources.spriteGroundedClaymore
+            &game.resources.texture(TextureId::SpriteRowstedSheacane),
+            &game.resources.texture(TextureId::SpriteFlawtinSeamen),
+            &game.resources.texture(TextureId::SpriteGustavoWindimaess),
+            &game.resources.texture(TextureId::SpriteGroundedClaymore)
         }};
         std::array<float, 4> dragonOffsets = { -210.f, -70.f, 70.f, 210.f };
         float maxSpriteHeight = 0.f;
@@ -971,9 +978,9 @@ namespace {
         }
 
         std::array<const sf::Texture*, 3> npcTextures = {{
-            &game.resources.spriteWillFigsid,
-            &game.resources.spriteWandaRinn,
-            &game.resources.spriteNoahLott
+            &game.resources.texture(TextureId::SpriteWillFigsid),
+            &game.resources.texture(TextureId::SpriteWandaRinn),
+            &game.resources.texture(TextureId::SpriteNoahLott)
         }};
         std::array<float, 3> npcOffsets = { -140.f, 0.f, 140.f };
         for (std::size_t i = 0; i < npcTextures.size(); ++i) {
@@ -1112,8 +1119,8 @@ namespace {
                         }
                     }
                     const sf::Texture* fallbackBack = (game.playerGender == Game::DragonbornGender::Female)
-                        ? &game.resources.spriteDragonbornFemaleBack
-                        : &game.resources.spriteDragonbornMaleBack;
+                        ? &game.resources.texture(TextureId::SpriteDragonbornFemaleBack)
+                        : &game.resources.texture(TextureId::SpriteDragonbornMaleBack);
                     const sf::Texture* newBack = animation.pendingBackSprite
                         ? animation.pendingBackSprite
                         : fallbackBack;
@@ -1175,13 +1182,14 @@ namespace {
         effect.active = true;
         effect.stage = BattleDemoState::MasterBatesSkillEffect::Stage::Powerup;
         effect.target = target;
-        effect.powerupTexture = &game.resources.skillMasterBatesPowerup;
+        effect.powerupTexture = &game.resources.texture(TextureId::SkillMasterBatesPowerup);
         effect.skillTexture = masterBatesSkillTexture(game, skillName);
         effect.skillSoundBuffer = masterBatesSkillSound(game, skillName);
         effect.pendingDamage = true;
         effect.pendingHp = pendingHp;
         effect.sound.reset();
-        effect.sound.emplace(game.resources.skillPowerUp);
+        effect.sound.emplace(game.resources.sound(SoundId::SkillPowerUp));
+        assets::notePlay(*effect.sound);
         effect.sound->play();
     }
 
@@ -1200,6 +1208,7 @@ namespace {
             effect.sound.reset();
             if (effect.skillSoundBuffer) {
                 effect.sound.emplace(*effect.skillSoundBuffer);
+                assets::notePlay(*effect.sound);
                 effect.sound->play();
                 return;
             }
@@ -1239,7 +1248,8 @@ namespace {
             if (evolution.sound && evolution.sound->getStatus() == sf::Sound::Status::Stopped) {
                 evolution.stage = BattleDemoState::MasterBatesEvolution::Stage::AwwSound;
                 evolution.sound.reset();
-                evolution.sound.emplace(game.resources.awwSound);
+                evolution.sound.emplace(game.resources.sound(SoundId::AwwSound));
+                assets::notePlay(*evolution.sound);
                 evolution.sound->play();
             }
             return;
@@ -1259,8 +1269,10 @@ namespace {
                 evolution.timer = 0.f;
                 evolution.tint = ColorHelper::Palette::SoftRed;
                 pushLog(game, "Master Bates is evolving!");
-                if (evolution.sound)
+                if (evolution.sound) {
+                    assets::notePlay(*evolution.sound);
                     evolution.sound->play();
+                }
             }
             return;
         }
@@ -1321,7 +1333,8 @@ namespace {
         }
         effect.startCenter = startCenter;
         effect.targetCenter = targetCenter;
-        effect.sound.emplace(game.resources.skillFriendship);
+        effect.sound.emplace(game.resources.sound(SoundId::SkillFriendship));
+        assets::notePlay(*effect.sound);
         effect.sound->play();
     }
 
@@ -1378,7 +1391,7 @@ namespace {
             ? std::clamp(effect.fade * 255.f, 0.f, 255.f)
             : 255.f;
         constexpr float kFriendshipSpriteBaseScale = 0.5f;
-        auto baseSize = game.resources.spriteWandaRinn.getSize();
+        auto baseSize = game.resources.canvasSize(game.resources.texture(TextureId::SpriteWandaRinn));
         sf::Vector2f targetSize{
             static_cast<float>(baseSize.x) * kFriendshipSpriteTargetFactor,
             static_cast<float>(baseSize.y) * kFriendshipSpriteTargetFactor
@@ -1387,7 +1400,7 @@ namespace {
             const sf::Texture* texture = effect.textures[i];
             if (!texture)
                 continue;
-            sf::Sprite sprite(*texture);
+            sf::Sprite sprite = game.resources.canvasSprite(*texture);
             auto bounds = sprite.getLocalBounds();
             sprite.setOrigin(sf::Vector2f{
                 bounds.position.x + (bounds.size.x * 0.5f),
@@ -1403,6 +1416,7 @@ namespace {
         scale *= 0.5f;
             sprite.setScale(sf::Vector2f{ scale, scale });
             sprite.setColor(sf::Color(255, 255, 255, static_cast<std::uint8_t>(fadeAlpha)));
+            assets::noteDraw(sprite);
             target.draw(sprite);
         }
     }
@@ -1439,6 +1453,7 @@ namespace {
                 : battle.cachedEnemyCenter;
             skillSprite.setPosition(targetCenter);
             skillSprite.setColor(sf::Color(255, 255, 255, 200));
+            assets::noteDraw(skillSprite);
             target.draw(skillSprite);
         }
     }
@@ -1490,6 +1505,7 @@ namespace {
             std::uint8_t fadeAlpha = static_cast<std::uint8_t>(std::clamp(effect.weaponFade * 255.f, 0.f, 255.f));
             sprite.setColor(sf::Color(255, 255, 255, fadeAlpha));
         }
+        assets::noteDraw(sprite);
         target.draw(sprite);
     }
 
@@ -1539,10 +1555,10 @@ namespace {
         };
 
         std::array<DragonDefinition, 4> dragonDefinitions = {{
-            { "Rowsted", &game.resources.spriteRowstedSheacane, &game.resources.spriteRowstedSheacaneBack, "Fire" },
-            { "Flawtin", &game.resources.spriteFlawtinSeamen, &game.resources.spriteFlawtinSeamenBack, "Water" },
-            { "Gustavo", &game.resources.spriteGustavoWindimaess, &game.resources.spriteGustavoWindimaessBack, "Air" },
-            { "Grounded", &game.resources.spriteGroundedClaymore, &game.resources.spriteGroundedClaymoreBack, "Earth" }
+            { "Rowsted", &game.resources.texture(TextureId::SpriteRowstedSheacane), &game.resources.texture(TextureId::SpriteRowstedSheacaneBack), "Fire" },
+            { "Flawtin", &game.resources.texture(TextureId::SpriteFlawtinSeamen), &game.resources.texture(TextureId::SpriteFlawtinSeamenBack), "Water" },
+            { "Gustavo", &game.resources.texture(TextureId::SpriteGustavoWindimaess), &game.resources.texture(TextureId::SpriteGustavoWindimaessBack), "Air" },
+            { "Grounded", &game.resources.texture(TextureId::SpriteGroundedClaymore), &game.resources.texture(TextureId::SpriteGroundedClaymoreBack), "Earth" }
         }};
 
         auto pushDragon = [&](const DragonDefinition& definition) {
@@ -1592,11 +1608,11 @@ namespace {
                     playerEntry.skills[i] = std::optional<std::string>{ kPlayerSkillNames[i] };
                 }
                 const sf::Texture* playerSprite = (game.playerGender == Game::DragonbornGender::Female)
-                    ? &game.resources.spriteDragonbornFemale
-                    : &game.resources.spriteDragonbornMale;
+                    ? &game.resources.texture(TextureId::SpriteDragonbornFemale)
+                    : &game.resources.texture(TextureId::SpriteDragonbornMale);
                 const sf::Texture* playerBackSprite = (game.playerGender == Game::DragonbornGender::Female)
-                    ? &game.resources.spriteDragonbornFemaleBack
-                    : &game.resources.spriteDragonbornMaleBack;
+                    ? &game.resources.texture(TextureId::SpriteDragonbornFemaleBack)
+                    : &game.resources.texture(TextureId::SpriteDragonbornMaleBack);
                 CreatureMenuEntry heroEntry{
                     playerEntry,
                     playerSprite,
@@ -1632,9 +1648,9 @@ namespace {
                 card.disabled = card.defeated || isBlocked(name) || (battle.player.name == name);
                 entries.push_back(card);
             };
-            pushFriend("Wanda Rinn", &game.resources.spriteWandaRinn, &game.resources.spriteWandaRinnBack, Game::DragonbornGender::Female);
-            pushFriend("Will Figsid", &game.resources.spriteWillFigsid, &game.resources.spriteWillFigsidBack, Game::DragonbornGender::Male);
-            pushFriend("Noah Lott", &game.resources.spriteNoahLott, &game.resources.spriteNoahLottBack, Game::DragonbornGender::Male);
+            pushFriend("Wanda Rinn", &game.resources.texture(TextureId::SpriteWandaRinn), &game.resources.texture(TextureId::SpriteWandaRinnBack), Game::DragonbornGender::Female);
+            pushFriend("Will Figsid", &game.resources.texture(TextureId::SpriteWillFigsid), &game.resources.texture(TextureId::SpriteWillFigsidBack), Game::DragonbornGender::Male);
+            pushFriend("Noah Lott", &game.resources.texture(TextureId::SpriteNoahLott), &game.resources.texture(TextureId::SpriteNoahLottBack), Game::DragonbornGender::Male);
             addDragonsForSlots(kMenuSlots);
         } else if (type == BattleDemoState::CreatureMenuType::Dragons) {
             addAllDragons();
@@ -1665,8 +1681,8 @@ namespace {
 
     const sf::Texture* genderIconFor(const Game& game, Game::DragonbornGender gender) {
         return (gender == Game::DragonbornGender::Female)
-            ? &game.resources.battleIconFemale
-            : &game.resources.battleIconMale;
+            ? &game.resources.texture(TextureId::BattleIconFemale)
+            : &game.resources.texture(TextureId::BattleIconMale);
     }
 
     constexpr float kGenderIconScale = 0.015f;
@@ -1692,7 +1708,7 @@ namespace {
         if (!battle.introBlinkVisible)
             return;
 
-        sf::Sprite badge{ game.resources.battleBeginsGlandular };
+        sf::Sprite badge{ game.resources.texture(TextureId::BattleBeginsGlandular) };
         auto badgeBounds = badge.getLocalBounds();
         float badgeWidth = badgeBounds.size.x;
         float badgeHeight = badgeBounds.size.y;
@@ -1739,7 +1755,7 @@ namespace {
         if (!battle.battleMusic)
             battle.battleMusic = std::make_unique<sf::Music>();
         sf::Music& music = *battle.battleMusic;
-        if (!music.openFromFile(kBattleMusicPath)) {
+        if (!assets::openMusic(music, kBattleMusicPath)) {
             battle.battleMusic.reset();
             return;
         }
@@ -1762,57 +1778,14 @@ namespace {
         battle.battleMusic.reset();
     }
 
-    sf::FloatRect normalizedOpaqueBounds(const sf::Texture& texture) {
-        static std::unordered_map<const sf::Texture*, sf::FloatRect> cache;
-        auto itr = cache.find(&texture);
-        if (itr != cache.end())
-            return itr->second;
-
-        sf::Image image = texture.copyToImage();
-        auto size = image.getSize();
-        sf::FloatRect normalized(sf::Vector2f{ 0.f, 0.f }, sf::Vector2f{ 1.f, 1.f });
-        if (size.x == 0 || size.y == 0) {
-            cache.emplace(&texture, normalized);
-            return normalized;
-        }
-
-        unsigned minX = size.x;
-        unsigned minY = size.y;
-        unsigned maxX = 0;
-        unsigned maxY = 0;
-        bool found = false;
-        for (unsigned y = 0; y < size.y; ++y) {
-            for (unsigned x = 0; x < size.x; ++x) {
-                if (image.getPixel({ x, y }).a == 0)
-                    continue;
-                if (!found) {
-                    minX = maxX = x;
-                    minY = maxY = y;
-                    found = true;
-                } else {
-                    minX = std::min(minX, x);
-                    minY = std::min(minY, y);
-                    maxX = std::max(maxX, x);
-                    maxY = std::max(maxY, y);
-                }
-            }
-        }
-
-        if (found) {
-            float width = static_cast<float>(maxX - minX + 1);
-            float height = static_cast<float>(maxY - minY + 1);
-            normalized.position.x = static_cast<float>(minX) / static_cast<float>(size.x);
-            normalized.position.y = static_cast<float>(minY) / static_cast<float>(size.y);
-            normalized.size.x = width / static_cast<float>(size.x);
-            normalized.size.y = height / static_cast<float>(size.y);
-        }
-
-        cache.emplace(&texture, normalized);
-        return normalized;
+    // Bounds of the pixels with alpha > 0, precomputed when the texture was loaded.
+    sf::FloatRect normalizedOpaqueBounds(const Resources& resources, const sf::Texture& texture) {
+        return resources.opaqueBounds(texture).visible
+            .value_or(sf::FloatRect(sf::Vector2f{ 0.f, 0.f }, sf::Vector2f{ 1.f, 1.f }));
     }
 
-    sf::Vector2f normalizedOpaqueCenter(const sf::Texture& texture) {
-        sf::FloatRect bounds = normalizedOpaqueBounds(texture);
+    sf::Vector2f normalizedOpaqueCenter(const Resources& resources, const sf::Texture& texture) {
+        sf::FloatRect bounds = normalizedOpaqueBounds(resources, texture);
         if (bounds.size.x <= 0.f || bounds.size.y <= 0.f)
             return { 0.5f, 0.5f };
         return {
@@ -1821,8 +1794,8 @@ namespace {
         };
     }
 
-    sf::Vector2f normalizedOpaqueBottom(const sf::Texture& texture) {
-        sf::FloatRect bounds = normalizedOpaqueBounds(texture);
+    sf::Vector2f normalizedOpaqueBottom(const Resources& resources, const sf::Texture& texture) {
+        sf::FloatRect bounds = normalizedOpaqueBounds(resources, texture);
         if (bounds.size.x <= 0.f || bounds.size.y <= 0.f)
             return { 0.5f, 1.f };
         return {
@@ -2089,6 +2062,7 @@ namespace {
                 });
                 iconSprite.setScale(sf::Vector2f{ kGenderIconScale, kGenderIconScale });
                 iconSprite.setPosition({ cursor, centerY });
+                assets::noteDraw(iconSprite);
                 target.draw(iconSprite);
                 cursor += (iconBounds.size.x * kGenderIconScale) + kGenderIconSpacing;
             }
@@ -2096,8 +2070,8 @@ namespace {
         };
 
         float padding = large ? 28.f : 16.f;
-        const sf::Texture* spriteTexture = entry.sprite ? entry.sprite : &game.resources.spriteDragonbornMale;
-        sf::Sprite sprite{ *spriteTexture };
+        const sf::Texture* spriteTexture = entry.sprite ? entry.sprite : &game.resources.texture(TextureId::SpriteDragonbornMale);
+        sf::Sprite sprite = game.resources.canvasSprite(*spriteTexture);
         auto spriteBounds = sprite.getLocalBounds();
 
         float spriteTarget = 0.f;
@@ -2194,6 +2168,7 @@ namespace {
             float spriteY = spriteYBase + (spriteSpace * 0.5f);
             sprite.setPosition({ spriteX, spriteY });
             sprite.setColor(cardDisabled ? sf::Color(160, 160, 170) : sf::Color::White);
+            assets::noteDraw(sprite);
             target.draw(sprite);
 
             float nameFontSize = 40.f;
@@ -2238,6 +2213,7 @@ namespace {
             float spriteY = spriteYBase + (spriteSpace * 0.5f);
             sprite.setPosition({ spriteX, spriteY });
             sprite.setColor(cardDisabled ? sf::Color(160, 160, 170) : sf::Color::White);
+            assets::noteDraw(sprite);
             target.draw(sprite);
 
             float textX = spriteX + spriteWidth + 14.f;
@@ -2582,6 +2558,15 @@ namespace {
         }
 }
 
+    // Battle state holds sprite pointers across frames, so keep every loaded battle texture resident.
+    void retainBattleTextures(const Game& game) {
+        for (std::size_t i = 0; i < assets::kTextureCount; ++i) {
+            const auto& entry = assets::kTextureManifest[i];
+            if (entry.cached && (entry.group == AssetGroup::Sprites || entry.group == AssetGroup::Battle))
+                game.resources.textures.retain(game.resources.handle(static_cast<TextureId>(i)));
+        }
+    }
+
 } // namespace
 
 void update(Game& game, sf::Time dt) {
@@ -2691,6 +2676,7 @@ void update(Game& game, sf::Time dt) {
             battle.victoryTransitioned = true;
             battle.phase = BattleDemoState::Phase::Complete;
             stopBattleMusic(game);
+            game.battleAssets.release();
             if (game.battleReturnToSeminiferous) {
                 game.battleReturnToSeminiferous = false;
                 core::itemActivation::activateItem(game, "dragoncup_umbra");
@@ -3004,6 +2990,7 @@ bool handleEvent(Game& game, const sf::Event& event) {
 }
 
 void draw(Game& game, sf::RenderTarget& target) {
+    retainBattleTextures(game);
     const auto size = target.getSize();
     float width = static_cast<float>(size.x);
     float height = static_cast<float>(size.y);
@@ -3026,7 +3013,7 @@ void draw(Game& game, sf::RenderTarget& target) {
         shakenView.move(evolution.shakeOffset);
         target.setView(shakenView);
     }
-    sf::Sprite background = makeLayer(game.resources.battleBackgroundLayer, { width, height });
+    sf::Sprite background = makeLayer(game.resources.texture(TextureId::BattleBackgroundLayer), { width, height });
     auto backgroundBounds = background.getGlobalBounds();
     auto backgroundPosition = sf::Vector2f{ (width - backgroundBounds.size.x) * 0.5f, (height - backgroundBounds.size.y) * 0.5f };
     background.setPosition(backgroundPosition);
@@ -3060,6 +3047,7 @@ void draw(Game& game, sf::RenderTarget& target) {
     auto drawLayer = [&](const sf::Texture& texture, const sf::Vector2f& targetSize) -> sf::FloatRect {
         sf::Sprite sprite = makeLayer(texture, targetSize);
         sprite.setPosition(backgroundPosition);
+        assets::noteDraw(sprite);
         target.draw(sprite);
         return sprite.getGlobalBounds();
     };
@@ -3071,7 +3059,7 @@ void draw(Game& game, sf::RenderTarget& target) {
     };
 
     auto computeBoxBounds = [&](const sf::Texture& texture) -> sf::FloatRect {
-        sf::FloatRect normalized = normalizedOpaqueBounds(texture);
+        sf::FloatRect normalized = normalizedOpaqueBounds(game.resources, texture);
         if (normalized.size.x <= 0.f || normalized.size.y <= 0.f)
             return {};
         const sf::Vector2f scale = backgroundBounds.size;
@@ -3295,9 +3283,9 @@ void draw(Game& game, sf::RenderTarget& target) {
         target.draw(hpText);
     };
 
-    sf::Sprite playerPlatformSprite = createLayerSprite(game.resources.battlePlayerPlatform);
+    sf::Sprite playerPlatformSprite = createLayerSprite(game.resources.texture(TextureId::BattlePlayerPlatform));
     sf::FloatRect playerPlatformBounds = playerPlatformSprite.getGlobalBounds();
-    sf::Sprite enemyPlatformSprite = createLayerSprite(game.resources.battleEnemyPlatform);
+    sf::Sprite enemyPlatformSprite = createLayerSprite(game.resources.texture(TextureId::BattleEnemyPlatform));
     sf::FloatRect enemyPlatformBounds = enemyPlatformSprite.getGlobalBounds();
 
     float entranceDuration = battle.platformEntranceDuration;
@@ -3326,21 +3314,23 @@ void draw(Game& game, sf::RenderTarget& target) {
 
     playerPlatformSprite.setPosition({ playerDrawX, playerFinalY });
     enemyPlatformSprite.setPosition({ enemyDrawX, enemyFinalY });
+    assets::noteDraw(playerPlatformSprite);
     target.draw(playerPlatformSprite);
+    assets::noteDraw(enemyPlatformSprite);
     target.draw(enemyPlatformSprite);
 
     const sf::Texture* defaultBack = (game.playerGender == Game::DragonbornGender::Female)
-        ? &game.resources.spriteDragonbornFemaleBack
-        : &game.resources.spriteDragonbornMaleBack;
+        ? &game.resources.texture(TextureId::SpriteDragonbornFemaleBack)
+        : &game.resources.texture(TextureId::SpriteDragonbornMaleBack);
     if (!battle.playerBackSprite)
         battle.playerBackSprite = defaultBack;
     const sf::Texture* playerBackTexture = battle.playerBackSprite ? battle.playerBackSprite : defaultBack;
-    sf::Sprite playerSprite(*playerBackTexture);
+    sf::Sprite playerSprite = game.resources.canvasSprite(*playerBackTexture);
     auto spriteBounds = playerSprite.getLocalBounds();
-    sf::Vector2f spriteOrigin = normalizedOpaqueCenter(*playerBackTexture);
+    sf::Vector2f spriteOrigin = normalizedOpaqueCenter(game.resources, *playerBackTexture);
     playerSprite.setOrigin(sf::Vector2f{ spriteOrigin.x * spriteBounds.size.x, spriteOrigin.y * spriteBounds.size.y });
     playerSprite.setScale(sf::Vector2f{ 0.30f, 0.30f });
-    sf::Vector2f playerCenterNormalized = normalizedOpaqueCenter(game.resources.battlePlayerPlatform);
+    sf::Vector2f playerCenterNormalized = normalizedOpaqueCenter(game.resources, game.resources.texture(TextureId::BattlePlayerPlatform));
     sf::Vector2f playerCenter{
         playerPlatformBounds.position.x + playerPlatformBounds.size.x * playerCenterNormalized.x,
         playerPlatformBounds.position.y + playerPlatformBounds.size.y * playerCenterNormalized.y
@@ -3373,8 +3363,10 @@ void draw(Game& game, sf::RenderTarget& target) {
         auto stage = battle.swapAnimation.stage;
         skipPlayerSprite = (stage == Stage::OutgoingWhite || stage == Stage::OutgoingSoftRed);
     }
-    if (!skipPlayerSprite)
+    if (!skipPlayerSprite) {
+        assets::noteDraw(playerSprite);
         target.draw(playerSprite);
+    }
     if (!skipPlayerSprite) {
         if (auto overlayColor = computeSwapOverlayColor(battle)) {
             sf::Sprite overlay = playerSprite;
@@ -3383,8 +3375,8 @@ void draw(Game& game, sf::RenderTarget& target) {
         }
     }
 
-    sf::FloatRect textBoxBounds = drawLayer(game.resources.battleTextBox, backgroundBounds.size);
-    sf::FloatRect textBoxContent = computeBoxBounds(game.resources.battleTextBox);
+    sf::FloatRect textBoxBounds = drawLayer(game.resources.texture(TextureId::BattleTextBox), backgroundBounds.size);
+    sf::FloatRect textBoxContent = computeBoxBounds(game.resources.texture(TextureId::BattleTextBox));
     if ((textBoxContent.size.x <= 0.f || textBoxContent.size.y <= 0.f)
         && textBoxBounds.size.x > 0.f && textBoxBounds.size.y > 0.f)
         textBoxContent = textBoxBounds;
@@ -3520,8 +3512,8 @@ void draw(Game& game, sf::RenderTarget& target) {
             }
         }
     }
-    sf::FloatRect actionBoxBounds = drawLayer(game.resources.battleActionBox, backgroundBounds.size);
-    sf::FloatRect actionBoxContent = computeBoxBounds(game.resources.battleActionBox);
+    sf::FloatRect actionBoxBounds = drawLayer(game.resources.texture(TextureId::BattleActionBox), backgroundBounds.size);
+    sf::FloatRect actionBoxContent = computeBoxBounds(game.resources.texture(TextureId::BattleActionBox));
     if ((actionBoxContent.size.x <= 0.f || actionBoxContent.size.y <= 0.f)
         && actionBoxBounds.size.x > 0.f && actionBoxBounds.size.y > 0.f)
         actionBoxContent = actionBoxBounds;
@@ -3660,11 +3652,11 @@ void draw(Game& game, sf::RenderTarget& target) {
         }
     }
     if (platformsArrived) {
-        drawLayer(game.resources.battlePlayerBox, backgroundBounds.size);
-        drawLayer(game.resources.battleEnemyBox, backgroundBounds.size);
+        drawLayer(game.resources.texture(TextureId::BattlePlayerBox), backgroundBounds.size);
+        drawLayer(game.resources.texture(TextureId::BattleEnemyBox), backgroundBounds.size);
 
-        sf::FloatRect playerBoxBounds = computeBoxBounds(game.resources.battlePlayerBox);
-        sf::FloatRect enemyBoxBounds = computeBoxBounds(game.resources.battleEnemyBox);
+        sf::FloatRect playerBoxBounds = computeBoxBounds(game.resources.texture(TextureId::BattlePlayerBox));
+        sf::FloatRect enemyBoxBounds = computeBoxBounds(game.resources.texture(TextureId::BattleEnemyBox));
 
         auto playerHealthBar = drawHealthWidget(playerBoxBounds, battle.player, 40.f, 0.f, battle.playerDisplayedHp);
         drawHealthWidget(enemyBoxBounds, battle.enemy, 40.f, -40.f, battle.enemyDisplayedHp);
@@ -3742,14 +3734,14 @@ void draw(Game& game, sf::RenderTarget& target) {
     }
 
     const sf::Texture* enemyTexture = battle.masterBatesDragonActive
-        ? &game.resources.spriteMasterBatesDragon
-        : &game.resources.spriteMasterBates;
-    sf::Sprite enemySprite(*enemyTexture);
+        ? &game.resources.texture(TextureId::SpriteMasterBatesDragon)
+        : &game.resources.texture(TextureId::SpriteMasterBates);
+    sf::Sprite enemySprite = game.resources.canvasSprite(*enemyTexture);
     auto enemyBounds = enemySprite.getLocalBounds();
-    sf::Vector2f enemyBottom = normalizedOpaqueBottom(*enemyTexture);
+    sf::Vector2f enemyBottom = normalizedOpaqueBottom(game.resources, *enemyTexture);
     enemySprite.setOrigin(sf::Vector2f{ enemyBottom.x * enemyBounds.size.x, enemyBottom.y * enemyBounds.size.y });
     enemySprite.setScale(sf::Vector2f{ 0.20f, 0.20f });
-    sf::Vector2f enemyCenterNormalized = normalizedOpaqueCenter(game.resources.battleEnemyPlatform);
+    sf::Vector2f enemyCenterNormalized = normalizedOpaqueCenter(game.resources, game.resources.texture(TextureId::BattleEnemyPlatform));
     sf::Vector2f enemyCenter{
         enemyPlatformBounds.position.x + enemyPlatformBounds.size.x * enemyCenterNormalized.x,
         enemyPlatformBounds.position.y + enemyPlatformBounds.size.y * enemyCenterNormalized.y
@@ -3773,6 +3765,7 @@ void draw(Game& game, sf::RenderTarget& target) {
     if (evolution.active)
         enemyTint = evolution.tint;
     enemySprite.setColor(enemyTint);
+    assets::noteDraw(enemySprite);
     target.draw(enemySprite);
     drawSkillEffect(
         game,
@@ -2,6 +2,7 @@
 
 #include "core/game.hpp"
 #include "helper/colorHelper.hpp"
+#include "resources/assetProfiler.hpp"
 #include "ui/popupStyle.hpp"
 #include "ui/weaponPopupScale.hpp"
 
@@ -140,9 +141,9 @@ void drawPreview(Game& game, sf::RenderTarget& target) {
     float nameY = popupY + scaledMargin + spriteAreaHeight + (scaledNameArea * 0.5f);
 
     const std::array<const sf::Texture*, 3> textures = {
-        &game.resources.weaponHolmabirBroken,
-        &game.resources.weaponKattkavarBroken,
-        &game.resources.weaponStiggedinBroken
+        &game.resources.texture(TextureId::WeaponHolmabirBroken),
+        &game.resources.texture(TextureId::WeaponKattkavarBroken),
+        &game.resources.texture(TextureId::WeaponStiggedinBroken)
     };
 
     for (std::size_t index = 0; index < kWeapons.size(); ++index) {
@@ -173,6 +174,7 @@ void drawPreview(Game& game, sf::RenderTarget& target) {
         sf::Color spriteColor = ColorHelper::Palette::Normal;
         spriteColor = ColorHelper::applyAlphaFactor(spriteColor, preview.weaponAlpha);
         sprite.setColor(spriteColor);
+        assets::noteDraw(sprite);
         target.draw(sprite);
 
         sf::Text label{ game.resources.uiFont, info.name, static_cast<unsigned int>(kNameFontSize) };
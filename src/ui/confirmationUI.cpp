@@ -9,6 +9,7 @@
 #include "helper/colorHelper.hpp"    // Applies shared palette colors to the popup visuals.
 #include "story/textStyles.hpp"      // Uses TextStyles::UI colors when rendering text/button outlines.
 #include "helper/textColorHelper.hpp"// Breaks the message into colored segments.
+#include "resources/assetUsage.hpp"  // Notes confirm/reject sound plays for --trace-asset-usage.
 #include "rendering/textLayout.hpp"  // Reuses the tutorial line-spacing helper.
 #include "ui/popupStyle.hpp"         // Draws the standardized popup frame.
 
@@ -159,6 +160,7 @@ bool handleConfirmationEvent(Game& game, const sf::Event& event) {
         if (game.confirmationPrompt.yesBounds.contains(clickPos)) {
             if (game.confirmSound) {
                 game.confirmSound->stop();
+                assets::notePlay(*game.confirmSound);
                 game.confirmSound->play();
             }
             hideConfirmationPrompt(game);
@@ -168,6 +170,7 @@ bool handleConfirmationEvent(Game& game, const sf::Event& event) {
         else if (game.confirmationPrompt.noBounds.contains(clickPos)) {
             if (game.rejectSound) {
                 game.rejectSound->stop();
+                assets::notePlay(*game.rejectSound);
                 game.rejectSound->play();
             }
             hideConfirmationPrompt(game);
@@ -190,6 +193,7 @@ bool handleConfirmationEvent(Game& game, const sf::Event& event) {
             if (game.confirmationPrompt.keyboardSelection == 0) {
                 if (game.confirmSound) {
                     game.confirmSound->stop();
+                    assets::notePlay(*game.confirmSound);
                     game.confirmSound->play();
                 }
                 hideConfirmationPrompt(game);
@@ -200,6 +204,7 @@ bool handleConfirmationEvent(Game& game, const sf::Event& event) {
             if (game.confirmationPrompt.keyboardSelection == 1) {
                 if (game.rejectSound) {
                     game.rejectSound->stop();
+                    assets::notePlay(*game.rejectSound);
                     game.rejectSound->play();
                 }
                 hideConfirmationPrompt(game);
@@ -1,6 +1,7 @@
 // === C++ Libraries ===
 #include <algorithm>
 #include <cmath>
+#include <utility>
 
 // === SFML Libraries ===
 #include <SFML/Graphics/RectangleShape.hpp>
@@ -13,6 +14,7 @@
 #include "creditsUI.hpp"
 #include "core/game.hpp"
 #include "helper/colorHelper.hpp"
+#include "resources/assetProfiler.hpp"
 #include "story/textStyles.hpp"
 
 namespace ui::credits {
@@ -27,6 +29,9 @@ constexpr float kPanelFadeOutDuration = 1.0f;
 constexpr float kBetaFadeInDuration = 1.0f;
 constexpr float kBetaHoldDuration = 6.0f;
 constexpr float kCreditsTitleOffset = 80.f;
+// Portraits resident at once: the one on screen and the next two. Each entry shows for
+// 6.5 s, so a portrait starts decoding at least that long before it fades in.
+constexpr std::size_t kResidentPortraits = 3;
 
 const char* categoryLabel(Category category) {
     switch (category) {
@@ -43,37 +48,75 @@ float clamp01(float value) {
 
 void populateEntries(Game& game, State& state) {
     state.entries.clear();
-    auto addEntry = [&](const sf::Texture& texture, std::string role, std::string actor, Category category) {
+    auto addEntry = [&](assets::TextureHandle texture, std::string role, std::string actor, Category category) {
         state.entries.push_back(Entry{
-            &texture,
+            texture,
             std::move(role),
             "portrayed by " + std::move(actor),
             category
         });
     };
 
-    addEntry(game.resources.creditActAsha, "Asha Scale", "Ashton Knight", Category::Acts);
-    addEntry(game.resources.creditActEmber, "Ember Scale", "Scarlett Knight", Category::Acts);
-    addEntry(game.resources.creditActBates, "Master Bates", "Edgar Heggs", Category::Acts);
-    addEntry(game.resources.creditActBatesDragon, "Master Bates (Dragon Form)", "Ari Moss", Category::Acts);
-    addEntry(game.resources.creditActNoah, "Noah Lott", "Wisely Grant", Category::Acts);
-    addEntry(game.resources.creditActWanda, "Wanda Rinn", "Mara Trail", Category::Acts);
-    addEntry(game.resources.creditActWill, "Will Figsid", "Mason Hardy", Category::Acts);
+    addEntry(game.resources.handle(TextureId::CreditActAsha), "Asha Scale", "Ashton Knight", Category::Acts);
+    addEntry(game.resources.handle(TextureId::CreditActEmber), "Ember Scale", "Scarlett Knight", Category::Acts);
+    addEntry(game.resources.handle(TextureId::CreditActBates), "Master Bates", "Edgar Heggs", Category::Acts);
+    addEntry(game.resources.handle(TextureId::CreditActBatesDragon), "Master Bates (Dragon Form)", "Ari Moss", Category::Acts);
+    addEntry(game.resources.handle(TextureId::CreditActNoah), "Noah Lott", "Wisely Grant", Category::Acts);
+    addEntry(game.resources.handle(TextureId::CreditActWanda), "Wanda Rinn", "Mara Trail", Category::Acts);
+    addEntry(game.resources.handle(TextureId::CreditActWill), "Will Figsid", "Mason Hardy", Category::Acts);
 
-    addEntry(game.resources.creditActFlawtin, "Flawtin Seamen", "Zuri Kofi", Category::Dragons);
-    addEntry(game.resources.creditActGrounded, "Grounded Claymore", "Dustin Quarry", Category::Dragons);
-    addEntry(game.resources.creditActGustavo, "Gustavo Windimaess", "Yuna Sato", Category::Dragons);
-    addEntry(game.resources.creditActRowsted, "Rowsted Sheacane", "Imana Zola", Category::Dragons);
+    addEntry(game.resources.handle(TextureId::CreditActFlawtin), "Flawtin Seamen", "Zuri Kofi", Category::Dragons);
+    addEntry(game.resources.handle(TextureId::CreditActGrounded), "Grounded Claymore", "Dustin Quarry", Category::Dragons);
+    addEntry(game.resources.handle(TextureId::CreditActGustavo), "Gustavo Windimaess", "Yuna Sato", Category::Dragons);
+    addEntry(game.resources.handle(TextureId::CreditActRowsted), "Rowsted Sheacane", "Imana Zola", Category::Dragons);
 
-    addEntry(game.resources.creditActTory, "Tory Tailor", "Pascal Scholz", Category::Specials);
+    addEntry(game.resources.handle(TextureId::CreditActTory), "Tory Tailor", "Pascal Scholz", Category::Specials);
     state.entries.push_back(Entry{
-        &game.resources.creditActKensen,
+        game.resources.handle(TextureId::CreditActKensen),
         "Special thanks to my artist:",
         "Kensen Futagoza",
         Category::Specials
     });
 
-    state.betaTexture = &game.resources.creditBetaTesterAlex;
+    state.betaTexture = game.resources.handle(TextureId::CreditBetaTesterAlex);
+}
+
+// Position of the art on screen in the sequence of entry portraits followed by the beta tester art.
+std::size_t sequencePosition(const State& state) {
+    switch (state.phase) {
+        case State::Phase::TitleFadeIn:
+        case State::Phase::PanelFadeIn:
+            return 0;
+        case State::Phase::EntryDisplay:
+            return state.entryIndex;
+        default:
+            return state.entries.size();
+    }
+}
+
+// Keeps the portrait on screen and the next ones pinned and decoding, and unpins the rest so
+// TextureCache::trim() drops each portrait once it has faded out.
+void streamPortraits(Game& game, State& state) {
+    std::vector<assets::TextureHandle> wanted;
+    const std::size_t sequenceLength = state.entries.size() + 1;
+    for (std::size_t i = sequencePosition(state); i < sequenceLength && wanted.size() < kResidentPortraits; ++i) {
+        assets::TextureHandle handle = i < state.entries.size() ? state.entries[i].texture : state.betaTexture;
+        if (handle)
+            wanted.push_back(handle);
+    }
+
+    auto& textures = game.resources.textures;
+    for (assets::TextureHandle handle : state.pinnedPortraits) {
+        if (std::find(wanted.begin(), wanted.end(), handle) == wanted.end())
+            textures.unpin(handle);
+    }
+    for (assets::TextureHandle handle : wanted) {
+        if (std::find(state.pinnedPortraits.begin(), state.pinnedPortraits.end(), handle) != state.pinnedPortraits.end())
+            continue;
+        textures.pin(handle);
+        textures.prefetch(handle);
+    }
+    state.pinnedPortraits = std::move(wanted);
 }
 
 float entryAlphaFor(float elapsed) {
@@ -102,6 +145,7 @@ void start(Game& game) {
     state.betaAlpha = 0.f;
     state.phaseClock.restart();
     populateEntries(game, state);
+    streamPortraits(game, state);
     game.startTitleScreenMusic();
 }
 
@@ -171,6 +215,7 @@ void update(Game& game) {
         case State::Phase::Complete:
             break;
     }
+    streamPortraits(game, state);
 }
 
 void draw(Game& game, sf::RenderTarget& target) {
@@ -226,9 +271,10 @@ void draw(Game& game, sf::RenderTarget& target) {
         category.setFillColor(catColor);
         target.draw(category);
 
-        if (entry.texture && entry.texture->getSize().x > 0 && entry.texture->getSize().y > 0) {
-            sf::Sprite sprite(*entry.texture);
-            auto texSize = entry.texture->getSize();
+        const sf::Texture* entryTexture = entry.texture ? &game.resources.texture(entry.texture) : nullptr;
+        auto texSize = entryTexture ? game.resources.canvasSize(*entryTexture) : sf::Vector2u{};
+        if (texSize.x > 0 && texSize.y > 0) {
+            sf::Sprite sprite = game.resources.canvasSprite(*entryTexture);
             float scale = std::min(
                 squareSize / static_cast<float>(texSize.x),
                 squareSize / static_cast<float>(texSize.y)
@@ -240,6 +286,7 @@ void draw(Game& game, sf::RenderTarget& target) {
             float imageCenterY = squarePos.y + squareSize * 0.5f;
             sprite.setPosition({ imageCenterX, imageCenterY });
             sprite.setColor(sf::Color(255, 255, 255, static_cast<std::uint8_t>(255.f * contentAlpha)));
+            assets::noteDraw(sprite);
             target.draw(sprite);
         }
 
@@ -295,8 +342,9 @@ void draw(Game& game, sf::RenderTarget& target) {
 
     if ((state.phase == State::Phase::BetaDisplay || state.phase == State::Phase::AwaitExit)
         && state.betaTexture && state.betaAlpha > 0.f) {
-        sf::Sprite sprite(*state.betaTexture);
-        auto texSize = state.betaTexture->getSize();
+        const sf::Texture& betaTexture = game.resources.texture(state.betaTexture);
+        sf::Sprite sprite = game.resources.canvasSprite(betaTexture);
+        auto texSize = game.resources.canvasSize(betaTexture);
         float maxWidth = windowWidth * 0.7f;
         float maxHeight = windowHeight * 0.45f;
         float scale = std::min(
@@ -310,6 +358,7 @@ void draw(Game& game, sf::RenderTarget& target) {
         float centerY = windowHeight * 0.5f;
         sprite.setPosition({ centerX, centerY });
         sprite.setColor(sf::Color(255, 255, 255, static_cast<std::uint8_t>(255.f * state.betaAlpha)));
+        assets::noteDraw(sprite);
         target.draw(sprite);
 
         const std::string betaPrefix = "And another special thanks to my Beta Tester ";
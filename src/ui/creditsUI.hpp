@@ -7,9 +7,12 @@
 // === SFML Libraries ===
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Texture.hpp>
-#include <SFML/System/Clock.hpp>
 #include <SFML/Window/Event.hpp>
 
+// === Header Files ===
+#include "core/simulationClock.hpp"
+#include "resources/textureCache.hpp"
+
 class Game;
 
 namespace ui::credits {
@@ -21,7 +24,7 @@ enum class Category {
 };
 
 struct Entry {
-    const sf::Texture* texture = nullptr;
+    assets::TextureHandle texture;  // Resolved each frame so only the shown portrait stays resident.
     std::string line1;
     std::string line2;
     Category category = Category::Acts;
@@ -46,9 +49,10 @@ struct State {
     float panelAlpha = 0.f;
     float entryAlpha = 0.f;
     float betaAlpha = 0.f;
-    sf::Clock phaseClock;
+    core::SimClock phaseClock;
     std::vector<Entry> entries;
-    const sf::Texture* betaTexture = nullptr;
+    assets::TextureHandle betaTexture;
+    std::vector<assets::TextureHandle> pinnedPortraits;  // Streamed in ahead of their entry; see streamPortraits.
 };
 
 void start(Game& game);
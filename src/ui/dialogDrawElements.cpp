@@ -8,6 +8,8 @@
 #include "uiEffects.hpp"           // Computes glow colors for the dialogue frames.
 #include "helper/textColorHelper.hpp"  // Breaks speaker names into colored segments when rendering.
 #include "helper/colorHelper.hpp"  // Applies palette colors for outlines, text, and frames.
+#include "resources/assetProfiler.hpp" // Notes the first on-screen size of drawn art for --asset-report.
+#include "rendering/iconBatch.hpp"   // Draws the collected item icons from the icon atlas in one call.
 #include "rendering/textLayout.hpp"  // Lays out multi-line colored text segments inside boxes.
 #include "rendering/locations.hpp" // Needed for LocationId definitions used by portrait backgrounds.
 #include "story/textStyles.hpp"    // Retrieves speaker styles for portraits and name labels.
@@ -22,81 +24,29 @@ namespace {
     constexpr float kPortraitSpriteOffset = 3.f;
     constexpr float kDialogueLineSpacingMultiplier = 1.2f;
 
-    const sf::Texture* siblingPortrait(const Game& game) {
+    assets::TextureHandle siblingPortrait(const Game& game) {
         bool useCape = game.cloakEquipped;
         auto siblingGender = (game.playerGender == Game::DragonbornGender::Female)
             ? Game::DragonbornGender::Male
             : Game::DragonbornGender::Female;
         if (siblingGender == Game::DragonbornGender::Female) {
             return useCape
-                ? &game.resources.portraitDragonbornFemaleCape
-                : &game.resources.portraitDragonbornFemaleNoCape;
+                ? game.resources.handle(TextureId::PortraitDragonbornFemaleCape)
+                : game.resources.handle(TextureId::PortraitDragonbornFemaleNoCape);
         }
         return useCape
-            ? &game.resources.portraitDragonbornMaleCape
-            : &game.resources.portraitDragonbornMaleNoCape;
+            ? game.resources.handle(TextureId::PortraitDragonbornMaleCape)
+            : game.resources.handle(TextureId::PortraitDragonbornMaleNoCape);
     }
 
-    const sf::Texture* portraitForSpeaker(const Game& game, const std::string& speakerName) {
-        using TextStyles::SpeakerId;
-
-        switch (TextStyles::speakerFromName(speakerName)) {
-            case SpeakerId::StoryTeller:
-            case SpeakerId::NoNameNPC:
-                return &game.resources.portraitStoryTeller;
-            case SpeakerId::NoNameWanderer:
-                return &game.resources.portraitVillageWanderer;
-            case SpeakerId::VillageElder:
-                return &game.resources.portraitVillageElder;
-            case SpeakerId::VillageWanderer:
-                return &game.resources.portraitVillageWanderer;
-            case SpeakerId::Blacksmith:
-                return &game.resources.portraitBlacksmith;
-            case SpeakerId::MasterBates:
-                return &game.resources.portraitMasterBates;
-            case SpeakerId::NoahBates:
-                return &game.resources.portraitNoahBates;
-        case SpeakerId::Player:
-            if (game.playerGender == Game::DragonbornGender::Female)
-                return game.cloakEquipped
-                    ? &game.resources.portraitDragonbornFemaleCape
-                    : &game.resources.portraitDragonbornFemaleNoCape;
-            return game.cloakEquipped
-                ? &game.resources.portraitDragonbornMaleCape
-                : &game.resources.portraitDragonbornMaleNoCape;
-            case SpeakerId::FireDragon:
-                return &game.resources.portraitFireDragon;
-            case SpeakerId::WaterDragon:
-                return &game.resources.portraitWaterDragon;
-            case SpeakerId::AirDragon:
-                return &game.resources.portraitAirDragon;
-            case SpeakerId::EarthDragon:
-                return &game.resources.portraitEarthDragon;
-            case SpeakerId::DragonbornSibling:
-                return siblingPortrait(game);
-            case SpeakerId::Unknown:
-            default:
-                return nullptr;
-        }
+    assets::TextureHandle portraitForSpeaker(const Game& game, const std::string& speakerName) {
+        return dialogDraw::portraitFor(game, TextStyles::speakerFromName(speakerName));
     }
 
-    const sf::Texture* portraitBackgroundForLocation(const Game& game) {
+    assets::TextureHandle portraitBackgroundForLocation(const Game& game) {
         if (!game.currentLocation)
-            return &game.resources.portraitBackgroundToryTailor;
-
-        switch (game.currentLocation->id) {
-            case LocationId::Perigonal: return &game.resources.portraitBackgroundPetrigonal;
-            case LocationId::Gonad: return &game.resources.portraitBackgroundGonad;
-            case LocationId::FigsidsForge: return &game.resources.portraitBackgroundBlacksmith;
-            case LocationId::Blyathyroid: return &game.resources.portraitBackgroundBlyathyroid;
-            case LocationId::Lacrimere: return &game.resources.portraitBackgroundLacrimere;
-            case LocationId::Cladrenal: return &game.resources.portraitBackgroundCladrenal;
-            case LocationId::Aerobronchi: return &game.resources.portraitBackgroundAerobronchi;
-            case LocationId::Seminiferous: return &game.resources.portraitBackgroundSeminiferous;
-            case LocationId::UmbraOssea: return &game.resources.portraitBackgroundUmbraOssea;
-        }
-
-        return &game.resources.portraitBackgroundToryTailor;
+            return game.resources.handle(TextureId::PortraitBackgroundToryTailor);
+        return dialogDraw::portraitBackgroundFor(game, game.currentLocation->id);
     }
 
     void drawSpeakerPortrait(
@@ -128,11 +78,11 @@ namespace {
         );
 
         auto drawTextureInArea = [&](const sf::Texture& tex, float scaleFactor, bool fill, float verticalOffset) {
-            auto texSize = tex.getSize();
+            auto texSize = game.resources.canvasSize(tex);
             if (texSize.x == 0 || texSize.y == 0)
                 return;
 
-            sf::Sprite sprite{ tex };
+            sf::Sprite sprite = game.resources.canvasSprite(tex);
             float targetWidth = portraitArea.size.x * scaleFactor;
             float targetHeight = portraitArea.size.y * scaleFactor;
             float scaleX = targetWidth / static_cast<float>(texSize.x);
@@ -154,14 +104,15 @@ namespace {
             color.a = static_cast<std::uint8_t>(std::clamp(uiAlphaFactor, 0.f, 1.f) * 255.f);
             sprite.setColor(color);
 
+            assets::noteDraw(sprite);
             target.draw(sprite);
         };
 
-        const sf::Texture* background = (speakerId == TextStyles::SpeakerId::StoryTeller)
-            ? &game.resources.portraitBackgroundToryTailor
+        assets::TextureHandle background = (speakerId == TextStyles::SpeakerId::StoryTeller)
+            ? game.resources.handle(TextureId::PortraitBackgroundToryTailor)
             : portraitBackgroundForLocation(game);
         if (background) {
-            drawTextureInArea(*background, kPortraitBackgroundScale, false, 0.f);
+            drawTextureInArea(game.resources.texture(background), kPortraitBackgroundScale, false, 0.f);
         }
         drawTextureInArea(texture, kPortraitRenderScale, false, kPortraitSpriteOffset);
     }
@@ -271,8 +222,8 @@ namespace dialogDraw {
         float baseY = namePos.y + nameSize.y - kSpeakerNameBottomOffset;
         nameText.setPosition({ x, baseY });
 
-        if (const sf::Texture* portraitTex = portraitForSpeaker(game, info.name)) {
-            drawSpeakerPortrait(target, game, game.nameBox, *portraitTex, speakerId, uiAlphaFactor);
+        if (assets::TextureHandle portrait = portraitForSpeaker(game, info.name)) {
+            drawSpeakerPortrait(target, game, game.nameBox, game.resources.texture(portrait), speakerId, uiAlphaFactor);
         }
 
 
@@ -400,11 +351,75 @@ namespace dialogDraw {
     }
 
     void drawItemIcons(Game& game, sf::RenderTarget& target, float uiAlphaFactor) {
+        IconBatch batch;
         for (auto& item : game.itemController.icons()) {
             sf::Color color = item.sprite.getColor();
             color.a = static_cast<std::uint8_t>(255.f * uiAlphaFactor);
             item.sprite.setColor(color);
-            target.draw(item.sprite);
+            if (const auto* region = game.resources.iconAtlas.find(item.sprite.getTexture()))
+                batch.add(*region, item.sprite.getGlobalBounds(), color);
+            else
+                target.draw(item.sprite);
+        }
+        batch.draw(target);
+    }
+
+    assets::TextureHandle portraitFor(const Game& game, TextStyles::SpeakerId speaker) {
+        using TextStyles::SpeakerId;
+
+        switch (speaker) {
+            case SpeakerId::StoryTeller:
+            case SpeakerId::NoNameNPC:
+                return game.resources.handle(TextureId::PortraitStoryTeller);
+            case SpeakerId::NoNameWanderer:
+                return game.resources.handle(TextureId::PortraitVillageWanderer);
+            case SpeakerId::VillageElder:
+                return game.resources.handle(TextureId::PortraitVillageElder);
+            case SpeakerId::VillageWanderer:
+                return game.resources.handle(TextureId::PortraitVillageWanderer);
+            case SpeakerId::Blacksmith:
+                return game.resources.handle(TextureId::PortraitBlacksmith);
+            case SpeakerId::MasterBates:
+                return game.resources.handle(TextureId::PortraitMasterBates);
+            case SpeakerId::NoahBates:
+                return game.resources.handle(TextureId::PortraitNoahBates);
+        case SpeakerId::Player:
+            if (game.playerGender == Game::DragonbornGender::Female)
+                return game.cloakEquipped
+                    ? game.resources.handle(TextureId::PortraitDragonbornFemaleCape)
+                    : game.resources.handle(TextureId::PortraitDragonbornFemaleNoCape);
+            return game.cloakEquipped
+                ? game.resources.handle(TextureId::PortraitDragonbornMaleCape)
+                : game.resources.handle(TextureId::PortraitDragonbornMaleNoCape);
+            case SpeakerId::FireDragon:
+                return game.resources.handle(TextureId::PortraitFireDragon);
+            case SpeakerId::WaterDragon:
+                return game.resources.handle(TextureId::PortraitWaterDragon);
+            case SpeakerId::AirDragon:
+                return game.resources.handle(TextureId::PortraitAirDragon);
+            case SpeakerId::EarthDragon:
+                return game.resources.handle(TextureId::PortraitEarthDragon);
+            case SpeakerId::DragonbornSibling:
+                return siblingPortrait(game);
+            case SpeakerId::Unknown:
+            default:
+                return {};
+        }
+    }
+
+    assets::TextureHandle portraitBackgroundFor(const Game& game, LocationId location) {
+        switch (location) {
+            case LocationId::Perigonal: return game.resources.handle(TextureId::PortraitBackgroundPetrigonal);
+            case LocationId::Gonad: return game.resources.handle(TextureId::PortraitBackgroundGonad);
+            case LocationId::FigsidsForge: return game.resources.handle(TextureId::PortraitBackgroundBlacksmith);
+            case LocationId::Blyathyroid: return game.resources.handle(TextureId::PortraitBackgroundBlyathyroid);
+            case LocationId::Lacrimere: return game.resources.handle(TextureId::PortraitBackgroundLacrimere);
+            case LocationId::Cladrenal: return game.resources.handle(TextureId::PortraitBackgroundCladrenal);
+            case LocationId::Aerobronchi: return game.resources.handle(TextureId::PortraitBackgroundAerobronchi);
+            case LocationId::Seminiferous: return game.resources.handle(TextureId::PortraitBackgroundSeminiferous);
+            case LocationId::UmbraOssea: return game.resources.handle(TextureId::PortraitBackgroundUmbraOssea);
         }
+
+        return game.resources.handle(TextureId::PortraitBackgroundToryTailor);
     }
 }
@@ -5,6 +5,9 @@
 #include <SFML/Graphics/Color.hpp>  // Colors used for the glow effects.
 #include <SFML/Graphics/RenderTarget.hpp>  // Draws portraits, text, and boxes into the UI area.
 #include <SFML/Graphics/RectangleShape.hpp>  // Describes box boundaries used when drawing UI frames.
+// === Header Files ===
+#include "rendering/locations.hpp"      // Names the location whose portrait backdrop is looked up.
+#include "resources/textureCache.hpp"   // Returns portraits as cache handles.
 
 class Game;
 
@@ -56,4 +59,8 @@ namespace dialogDraw {
         , sf::RenderTarget& target
         , float uiAlphaFactor
     );
+    // Portrait drawn for speaker (player and sibling follow gender and cloak); empty if none.
+    assets::TextureHandle portraitFor(const Game& game, TextStyles::SpeakerId speaker);
+    // Backdrop drawn behind non-narrator portraits while at location.
+    assets::TextureHandle portraitBackgroundFor(const Game& game, LocationId location);
 }
@@ -21,6 +21,9 @@
 #include "story/storyIntro.hpp"     // Drives the intro, dragon, and quiz dialogues referenced here.
 #include "story/textStyles.hpp"     // Provides speaker styles/colors for names and portraits.
 #include "helper/colorHelper.hpp"   // Applies palette colors when drawing names/dragon labels.
+#include "resources/assetProfiler.hpp" // Notes the first on-screen size of drawn art for --asset-report.
+#include "resources/assetUsage.hpp"    // Notes the level-up sound for --trace-asset-usage.
+#include "resources/textureLod.hpp"    // Draws the showcased dragon and forged weapon through their downscaled levels.
 #include "helper/healingPotion.hpp" // Reuses the Wanda healing animation when HP bottoms out.
 #include "rendering/textLayout.hpp"
 #include "ui/popupStyle.hpp"
@@ -64,6 +67,7 @@ namespace {
         sf::Color bgColor = game.background->getColor();
         bgColor.a = static_cast<std::uint8_t>(255.f * fadeProgress * uiAlphaFactor);
         game.background->setColor(bgColor);
+        assets::noteDraw(*game.background);
         target.draw(*game.background);
     }
 
@@ -88,15 +92,14 @@ namespace {
         ui::popup::drawPopupFrame(target, popupBounds, uiAlphaFactor);
 
         const auto& option = game.weaponOptions[game.selectedWeaponIndex];
-        if (option.texture.getSize().x > 0 && option.texture.getSize().y > 0) {
-            sf::Sprite sprite{ option.texture };
+        if (option.texture && option.texture->getSize().x > 0 && option.texture->getSize().y > 0) {
             float spriteAreaHeight = popupHeight * 0.55f;
             float spriteAreaWidth = popupWidth * 0.8f;
-            auto textureSize = option.texture.getSize();
+            auto textureSize = option.texture->getSize();
             float scaleX = spriteAreaWidth / static_cast<float>(textureSize.x);
             float scaleY = spriteAreaHeight / static_cast<float>(textureSize.y);
             float scale = std::min(scaleX, scaleY);
-            sprite.setScale({ scale, scale });
+            sf::Sprite sprite = assets::lodSprite(*option.texture, scale);
             auto localBounds = sprite.getLocalBounds();
             sprite.setOrigin({
                 localBounds.position.x + localBounds.size.x * 0.5f,
@@ -109,6 +112,9 @@ namespace {
             sf::Color spriteColor = sprite.getColor();
             spriteColor.a = static_cast<std::uint8_t>(255.f * uiAlphaFactor);
             sprite.setColor(spriteColor);
+            // The sprite may sample a downscaled level; the report row belongs to the full texture.
+            if (assets::profiler().enabled())
+                assets::profiler().noteDraw(*option.texture, sprite.getGlobalBounds().size);
             target.draw(sprite);
         }
 
@@ -146,7 +152,7 @@ void drawMapItemPopup(Game& game, sf::RenderTarget& target, float uiAlphaFactor)
         sf::FloatRect popupBounds{ { popupX, popupY }, { popupWidth, popupHeight } };
         ui::popup::drawPopupFrame(target, popupBounds, uiAlphaFactor);
 
-        const sf::Texture& mapTexture = game.resources.mapGlandular;
+        const sf::Texture& mapTexture = game.resources.texture(TextureId::MapGlandular);
         if (mapTexture.getSize().x > 0 && mapTexture.getSize().y > 0) {
             sf::Sprite sprite{ mapTexture };
             float spriteAreaWidth = popupWidth * 0.78f;
@@ -163,6 +169,7 @@ void drawMapItemPopup(Game& game, sf::RenderTarget& target, float uiAlphaFactor)
             sf::Color spriteColor = sprite.getColor();
             spriteColor.a = static_cast<std::uint8_t>(255.f * uiAlphaFactor);
             sprite.setColor(spriteColor);
+            assets::noteDraw(sprite);
             target.draw(sprite);
         }
 
@@ -332,23 +339,7 @@ namespace {
         target.draw(overlay);
     }
 
-    bool updateTypewriter(Game& game, const std::string& fullText, float delay) {
-        bool isTyping = !game.askingName && game.charIndex < fullText.size();
-
-    if (isTyping) {
-            game.startTypingSound();
-            if (game.typewriterClock.getElapsedTime().asSeconds() >= delay) {
-                game.visibleText += fullText[game.charIndex];
-                game.charIndex++;
-                game.typewriterClock.restart();
-            }
-        }
-        else {
-            game.stopTypingSound();
-        }
-
-        return isTyping;
-    }
+    constexpr float kTypewriterDelay = 0.02f;  // Seconds of simulated time per revealed character.
 
     std::optional<std::size_t> dragonPortraitIndexForLocation(LocationId id) {
         switch (id) {
@@ -439,7 +430,7 @@ namespace {
     void drawCenteredDragon(
         Game& game,
         sf::RenderTarget& target,
-        Game::DragonPortrait& portrait,
+        const Game::DragonPortrait& portrait,
         float combinedAlpha
     ) {
         if (combinedAlpha <= 0.f)
@@ -448,19 +439,21 @@ namespace {
         auto view = target.getView();
         sf::Vector2f center = view.getCenter();
 
-        auto prevScale = portrait.sprite.getScale();
-        auto prevPosition = portrait.sprite.getPosition();
-        auto prevColor = portrait.sprite.getColor();
-
+        // The 2048px art is drawn at a fraction of its size; sample the matching LOD level.
         float displayScale = portrait.baseScale * kDragonScaleMultiplier;
-        portrait.sprite.setScale({ displayScale, displayScale });
-        portrait.sprite.setPosition(center);
+        sf::Sprite sprite = assets::lodSprite(portrait.sprite.getTexture(), displayScale);
+        auto localBounds = sprite.getLocalBounds();
+        sprite.setOrigin({
+            localBounds.position.x + (localBounds.size.x / 2.f),
+            localBounds.position.y + (localBounds.size.y / 2.f)
+        });
+        sprite.setPosition(center);
 
-        sf::Color spriteColor = prevColor;
+        sf::Color spriteColor = portrait.sprite.getColor();
         spriteColor.a = static_cast<std::uint8_t>(std::clamp(combinedAlpha, 0.f, 1.f) * 255.f);
-        portrait.sprite.setColor(spriteColor);
+        sprite.setColor(spriteColor);
 
-        auto spriteBounds = portrait.sprite.getGlobalBounds();
+        auto spriteBounds = sprite.getGlobalBounds();
 
         sf::Text label{ game.resources.titleFont, portrait.displayName, kDragonNameLabelSize };
         auto speakerId = TextStyles::speakerFromName(portrait.displayName);
@@ -495,12 +488,10 @@ namespace {
         backdrop.setFillColor(ColorHelper::applyAlphaFactor(sf::Color(4, 4, 6, 220), combinedAlpha));
         target.draw(backdrop);
 
-        target.draw(portrait.sprite);
+        if (assets::profiler().enabled())
+            assets::profiler().noteDraw(portrait.sprite.getTexture(), spriteBounds.size);
+        target.draw(sprite);
         target.draw(label);
-
-        portrait.sprite.setScale(prevScale);
-        portrait.sprite.setPosition(prevPosition);
-        portrait.sprite.setColor(prevColor);
     }
 
     void drawDragonShowcase(
@@ -762,6 +753,7 @@ namespace {
                 levelUp.clock.restart();
                 if (game.levelUpSound) {
                     game.levelUpSound->stop();
+                    assets::notePlay(*game.levelUpSound);
                     game.levelUpSound->play();
                 }
             }
@@ -1044,7 +1036,11 @@ namespace {
         foldSymbol.setPosition({ foldBarX + (kFoldBarWidth * 0.5f), foldBarY + (foldBarHeight * 0.5f) });
         target.draw(foldSymbol);
 
-        if (game.emergencyHealingActive && game.resources.spriteWandaRinn.getSize().x > 0 && game.resources.spriteWandaRinn.getSize().y > 0) {
+        const sf::Texture* emergencyWandaTexture = game.emergencyHealingActive
+            ? &game.resources.texture(TextureId::SpriteWandaRinn)
+            : nullptr;
+        sf::Vector2u wandaCanvas = emergencyWandaTexture ? game.resources.canvasSize(*emergencyWandaTexture) : sf::Vector2u{};
+        if (wandaCanvas.x > 0 && wandaCanvas.y > 0) {
             constexpr float kBubblePaddingX = 12.f;
             constexpr float kBubblePaddingY = 8.f;
             constexpr unsigned int kBubbleFontSize = 18;
@@ -1052,12 +1048,12 @@ namespace {
             constexpr float kTailWidth = 18.f;
             constexpr float kTailHeight = 18.f;
             float alpha = std::clamp(panelAlpha, 0.f, 1.f);
-            const sf::Texture& wandaTexture = game.resources.spriteWandaRinn;
-            sf::Sprite wandaSprite{ wandaTexture };
+            const sf::Texture& wandaTexture = *emergencyWandaTexture;
+            sf::Sprite wandaSprite = game.resources.canvasSprite(wandaTexture);
             float maxWidth = statusSize.x * 0.45f;
             float maxHeight = statusSize.y * 1.2f;
-            float textureWidth = static_cast<float>(wandaTexture.getSize().x);
-            float textureHeight = static_cast<float>(wandaTexture.getSize().y);
+            float textureWidth = static_cast<float>(wandaCanvas.x);
+            float textureHeight = static_cast<float>(wandaCanvas.y);
             float widthScale = textureWidth > 0.f ? maxWidth / textureWidth : 1.f;
             float heightScale = textureHeight > 0.f ? maxHeight / textureHeight : 1.f;
             float baseScale = std::min(widthScale, heightScale);
@@ -1074,6 +1070,7 @@ namespace {
             sf::Color spriteColor = wandaSprite.getColor();
             spriteColor.a = static_cast<std::uint8_t>(255.f * alpha);
             wandaSprite.setColor(spriteColor);
+            assets::noteDraw(wandaSprite);
             target.draw(wandaSprite);
 
             float spriteHeight = spriteBounds.size.y * spriteScale;
@@ -1182,13 +1179,13 @@ void drawLocationBox(Game& game, sf::RenderTarget& target, float uiAlphaFactor,
     auto globalBounds = locationName.getGlobalBounds();
     float textY = globalBounds.position.y + (globalBounds.size.y * 0.5f);
 
-    sf::Sprite leftDivider{ game.resources.dividerLeft };
-    sf::Sprite rightDivider{ game.resources.dividerRight };
+    sf::Sprite leftDivider{ game.resources.texture(TextureId::DividerLeft) };
+    sf::Sprite rightDivider{ game.resources.texture(TextureId::DividerRight) };
     leftDivider.setColor(glowColor);
     rightDivider.setColor(glowColor);
 
-    auto leftSize = game.resources.dividerLeft.getSize();
-    auto rightSize = game.resources.dividerRight.getSize();
+    auto leftSize = game.resources.texture(TextureId::DividerLeft).getSize();
+    auto rightSize = game.resources.texture(TextureId::DividerRight).getSize();
     float leftY = textY - (static_cast<float>(leftSize.y) * 0.5f);
     float rightY = textY - (static_cast<float>(rightSize.y) * 0.5f);
 
@@ -1203,6 +1200,29 @@ void drawLocationBox(Game& game, sf::RenderTarget& target, float uiAlphaFactor,
     target.draw(locationName);
 }
 
+void advanceTypewriter(Game& game) {
+    // Paused while the last render did not show a typing line: hold the clock at zero so the
+    // line resumes with one character instead of catching up on the paused time.
+    if (!game.typewriterShown || !game.currentDialogue || game.dialogueIndex >= game.currentDialogue->size()) {
+        game.typewriterClock.restart();
+        return;
+    }
+
+    const std::string& fullText = injectSpeakerNames((*game.currentDialogue)[game.dialogueIndex].text, game);
+    if (game.askingName || game.charIndex >= fullText.size()) {
+        game.stopTypingSound();
+        return;
+    }
+
+    game.startTypingSound();
+    const sf::Time step = sf::seconds(kTypewriterDelay);
+    while (game.charIndex < fullText.size() && game.typewriterClock.getElapsedTime() >= step) {
+        game.visibleText += fullText[game.charIndex];
+        game.charIndex++;
+        game.typewriterClock.consume(step);
+    }
+}
+
 void drawDialogueUI(Game& game, sf::RenderTarget& target, bool skipConfirmation, float* outAlpha, bool renderMenu) {
 
     ui::brokenweapon::updatePreview(game);
@@ -1266,17 +1286,17 @@ void drawDialogueUI(Game& game, sf::RenderTarget& target, bool skipConfirmation,
         return;
     }
 
+    static const std::string kNoDialogueText;
     const DialogueLine* line = nullptr;
-    std::string fullText;
     if (hasDialogueLine) {
         line = &(*game.currentDialogue)[game.dialogueIndex];
-        fullText = injectSpeakerNames(line->text, game);
     }
     else if (keepShowingLastFeedbackLine && game.currentDialogue && !game.currentDialogue->empty()) {
         line = &game.currentDialogue->back();
     }
+    // Cached expansion: no copy or placeholder scan while the same line stays on screen.
+    const std::string& fullText = hasDialogueLine ? injectSpeakerNames(line->text, game) : kNoDialogueText;
 
-    float delay = 0.02f;
     bool isTyping = false;
     bool isMapTutorialLine =
         hasDialogueLine
@@ -1295,8 +1315,10 @@ void drawDialogueUI(Game& game, sf::RenderTarget& target, bool skipConfirmation,
         && hasDialogueLine
         && game.state != GameState::IntroTitle
         && !isMapTutorialLine;
+    // advanceTypewriter reveals the characters on the next simulation steps; render only reports.
+    game.typewriterShown = allowTyping;
     if (allowTyping)
-        isTyping = updateTypewriter(game, fullText, delay);
+        isTyping = !game.askingName && game.charIndex < fullText.size();
 
         if (line) {
             TextStyles::SpeakerStyle info = TextStyles::speakerStyle(line->speaker);
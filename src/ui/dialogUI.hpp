@@ -8,5 +8,7 @@
 class Game;
 
 void drawDialogueUI(Game& game, sf::RenderTarget& target, bool skipConfirmation = false, float* outAlpha = nullptr, bool renderMenu = true);
+// Reveals one character per typewriter delay of simulated time; called once per fixed step.
+void advanceTypewriter(Game& game);
 
 void drawLocationBox(Game& game, sf::RenderTarget& target, float uiAlphaFactor, const sf::Color& glowColor);
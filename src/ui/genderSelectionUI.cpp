@@ -12,6 +12,8 @@
 
 #include "confirmationUI.hpp"
 #include "helper/colorHelper.hpp"
+#include "resources/assetProfiler.hpp"
+#include "resources/assetUsage.hpp"
 #include "story/dialogInput.hpp"
 #include "story/textStyles.hpp"
 #include "ui/popupStyle.hpp"
@@ -43,6 +45,7 @@ namespace {
         if (game.genderAnimation.phase != Game::GenderSelectionAnimation::Phase::Idle || !game.buttonHoverSound)
             return;
         game.buttonHoverSound->stop();
+        assets::notePlay(*game.buttonHoverSound);
         game.buttonHoverSound->play();
     }
 }
@@ -172,23 +175,24 @@ void draw(Game& game, sf::RenderTarget& target, float uiAlphaFactor) {
     auto scaleForTexture = [&](const sf::Texture& texture) {
         float maxHeight = static_cast<float>(windowSize.y) * kMaxHeightFactor;
         float maxWidth = static_cast<float>(windowSize.x) * kMaxWidthFactor;
-        float scaleX = maxWidth / static_cast<float>(texture.getSize().x);
-        float scaleY = maxHeight / static_cast<float>(texture.getSize().y);
+        sf::Vector2u canvas = game.resources.canvasSize(texture);
+        float scaleX = maxWidth / static_cast<float>(canvas.x);
+        float scaleY = maxHeight / static_cast<float>(canvas.y);
         return std::min(scaleX, scaleY);
     };
 
-    float femaleScale = scaleForTexture(game.resources.spriteDragonbornFemale);
-    float maleScale = scaleForTexture(game.resources.spriteDragonbornMale);
+    float femaleScale = scaleForTexture(game.resources.texture(TextureId::SpriteDragonbornFemale));
+    float maleScale = scaleForTexture(game.resources.texture(TextureId::SpriteDragonbornMale));
 
-    const sf::Texture& femaleTexture = (game.genderSelectionHovered == 0)
-        ? game.resources.spriteDragonbornFemaleHovered
-        : game.resources.spriteDragonbornFemale;
-    const sf::Texture& maleTexture = (game.genderSelectionHovered == 1)
-        ? game.resources.spriteDragonbornMaleHovered
-        : game.resources.spriteDragonbornMale;
+    const sf::Texture& femaleTexture = game.resources.texture((game.genderSelectionHovered == 0)
+        ? game.resources.handle(TextureId::SpriteDragonbornFemaleHovered)
+        : game.resources.handle(TextureId::SpriteDragonbornFemale));
+    const sf::Texture& maleTexture = game.resources.texture((game.genderSelectionHovered == 1)
+        ? game.resources.handle(TextureId::SpriteDragonbornMaleHovered)
+        : game.resources.handle(TextureId::SpriteDragonbornMale));
 
-    sf::Sprite femaleSprite(femaleTexture);
-    sf::Sprite maleSprite(maleTexture);
+    sf::Sprite femaleSprite = game.resources.canvasSprite(femaleTexture);
+    sf::Sprite maleSprite = game.resources.canvasSprite(maleTexture);
     femaleSprite.setScale({ femaleScale, femaleScale });
     maleSprite.setScale({ maleScale, maleScale });
 
@@ -353,7 +357,9 @@ void draw(Game& game, sf::RenderTarget& target, float uiAlphaFactor) {
     selectionBackdrop.setFillColor(ColorHelper::applyAlphaFactor(ColorHelper::Palette::DialogBackdrop, uiAlphaFactor));
     target.draw(selectionBackdrop);
 
+    assets::noteDraw(femaleSprite);
     target.draw(femaleSprite);
+    assets::noteDraw(maleSprite);
     target.draw(maleSprite);
     target.draw(hintText);
 
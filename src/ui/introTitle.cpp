@@ -11,6 +11,8 @@
 #include "introTitle.hpp"
 #include "core/game.hpp"
 #include "helper/colorHelper.hpp"
+#include "resources/assetProfiler.hpp"
+#include "resources/assetUsage.hpp"
 #include "ui/confirmationUI.hpp"
 #include "ui/battleUI.hpp"
 
@@ -45,6 +47,7 @@ namespace {
         if (!game.introTitleHoverSound)
             return;
         game.introTitleHoverSound->stop();
+        assets::notePlay(*game.introTitleHoverSound);
         game.introTitleHoverSound->play();
     }
 
@@ -86,13 +89,14 @@ void triggerIntroTitleExit(Game& game) {
     if(!game.introTitleFadeOutActive && !game.introTitleHidden) {
         if (!game.startGameSoundPlayed && game.startGameSound) {
             game.startGameSound->stop();
+            assets::notePlay(*game.startGameSound);
             game.startGameSound->play();
             game.startGameSoundPlayed = true;
         }
         game.fadeOutTitleScreenMusic(game.introTitleFadeOutDuration + 0.5f);
         game.introTitleFadeOutActive = true;
         game.introTitleFadeClock.restart();
-        game.queuedBackgroundTexture = &game.resources.backgroundToryTailor;
+        game.queuedBackgroundTexture = game.resources.handle(TextureId::BackgroundToryTailor);
     }
 
     if (!game.uiFadeInActive) {
@@ -191,10 +195,12 @@ void drawIntroTitle(Game& game, sf::RenderTarget& target) {
         if (fadeProgress >= 1.f) {
             game.introTitleFadeOutActive = false;
             if (game.queuedBackgroundTexture) {
-                game.setBackgroundTexture(*game.queuedBackgroundTexture);
-                game.queuedBackgroundTexture = nullptr;
+                game.setBackgroundTexture(game.queuedBackgroundTexture);
+                game.queuedBackgroundTexture = {};
             }
             game.introTitleHidden = true;
+            // The background keeps the intro art resident for as long as it still shows it.
+            game.introAssets.release();
 
             if (game.uiFadeInQueued && !game.uiFadeInActive) {
                 game.uiFadeInQueued = false;
@@ -218,7 +224,7 @@ void drawIntroTitle(Game& game, sf::RenderTarget& target) {
             }
         }
 
-        auto texSize = game.resources.introBackground.getSize();
+        auto texSize = game.resources.texture(TextureId::IntroBackground).getSize();
         if (texSize.x > 0 && texSize.y > 0) {
             float scaleX = static_cast<float>(target.getSize().x) / static_cast<float>(texSize.x);
             float scaleY = static_cast<float>(target.getSize().y) / static_cast<float>(texSize.y);
@@ -231,6 +237,7 @@ void drawIntroTitle(Game& game, sf::RenderTarget& target) {
         bgColor.a = static_cast<std::uint8_t>(255.f * fadeProgress * globalFade);
         game.background->setColor(bgColor);
 
+        assets::noteDraw(*game.background);
         target.draw(*game.background);
     }
 
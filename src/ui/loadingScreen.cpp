@@ -0,0 +1,63 @@
+// === C++ Libraries ===
+#include <algorithm>  // Uses std::clamp for the fill ratio.
+#include <string>     // Builds the percentage/asset label.
+// === SFML Libraries ===
+#include <SFML/Graphics.hpp>  // Provides the shapes and text drawn on the loading screen.
+// === Header Files ===
+#include "loadingScreen.hpp"       // Declares renderLoadingScreen.
+#include "core/game.hpp"           // Accesses the window and the already-opened fonts.
+#include "helper/colorHelper.hpp"  // Palette colors for the bar and labels.
+#include "story/textStyles.hpp"    // Shared UI panel/border colors.
+
+void renderLoadingScreen(Game& game, const assets::LoadProgress& progress) {
+    while (auto event = game.window.pollEvent()) {
+        if (event->is<sf::Event::Closed>())
+            game.window.close();
+    }
+    if (!game.window.isOpen())
+        return;
+
+    const float windowWidth = static_cast<float>(game.window.getSize().x);
+    const float windowHeight = static_cast<float>(game.window.getSize().y);
+    float ratio = progress.total > 0
+        ? static_cast<float>(progress.completed) / static_cast<float>(progress.total)
+        : 1.f;
+    ratio = std::clamp(ratio, 0.f, 1.f);
+
+    game.window.clear(ColorHelper::Palette::BlueNearBlack);
+
+    sf::Vector2f barSize{ windowWidth * 0.5f, 18.f };
+    sf::Vector2f barPos{ (windowWidth - barSize.x) * 0.5f, windowHeight * 0.6f };
+
+    sf::RectangleShape track(barSize);
+    track.setPosition(barPos);
+    track.setFillColor(TextStyles::UI::PanelDark);
+    track.setOutlineColor(TextStyles::UI::Border);
+    track.setOutlineThickness(2.f);
+    game.window.draw(track);
+
+    sf::RectangleShape fill({ barSize.x * ratio, barSize.y });
+    fill.setPosition(barPos);
+    fill.setFillColor(ColorHelper::Palette::TitleAccent);
+    game.window.draw(fill);
+
+    sf::Text title{ game.resources.titleFont, "Glandular", 72 };
+    title.setFillColor(ColorHelper::Palette::TitleAccent);
+    auto titleBounds = title.getLocalBounds();
+    title.setOrigin({ titleBounds.position.x + titleBounds.size.x * 0.5f, titleBounds.position.y + titleBounds.size.y });
+    title.setPosition({ windowWidth * 0.5f, barPos.y - 48.f });
+    game.window.draw(title);
+
+    int percent = static_cast<int>(ratio * 100.f);
+    std::string label = "Loading " + std::to_string(percent) + "%";
+    if (!progress.currentAsset.empty())
+        label += "  -  " + progress.currentAsset;
+    sf::Text status{ game.resources.uiFont, label, 18 };
+    status.setFillColor(ColorHelper::Palette::Subtitle);
+    auto statusBounds = status.getLocalBounds();
+    status.setOrigin({ statusBounds.position.x + statusBounds.size.x * 0.5f, statusBounds.position.y });
+    status.setPosition({ windowWidth * 0.5f, barPos.y + barSize.y + 14.f });
+    game.window.draw(status);
+
+    game.window.display();
+}
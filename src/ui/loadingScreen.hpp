@@ -0,0 +1,9 @@
+#pragma once
+// === Header Files ===
+#include "resources/assetLoader.hpp"  // Provides the LoadProgress snapshot rendered by the screen.
+
+class Game;
+
+// Draws one frame of the startup loading screen and pumps window events so the OS keeps it responsive.
+// Implementation: src/ui/loadingScreen.cpp
+void renderLoadingScreen(Game& game, const assets::LoadProgress& progress);
@@ -4,17 +4,18 @@
 #include <algorithm>   // Uses std::clamp/max/min while sizing and positioning map elements.
 #include <limits>
 #include <optional>    // Returns optional LocationId values for keyboard/mouse handling.
-#include <SFML/Graphics/Image.hpp>    // Loads texture pixels when deriving overlay hitboxes.
 #include <SFML/Window/Mouse.hpp>     // Reads mouse coordinates inside the map area.
 #include <SFML/Window/Keyboard.hpp>  // Processes direct key travel shortcuts.
 // === Header Files ===
 #include "mapSelectionUI.hpp"        // Declares the map UI functions defined here.
 #include "quizUI.hpp"                // Starts quizzes when a dragon destination is selected.
 #include "core/game.hpp"             // Accesses map/dialogue state, sprite bounds, and resources.
+#include "core/memoryRegistry.hpp"   // Reports the size of the cached location list.
 #include "story/textStyles.hpp"      // Formats dragon names and colors shown in location popups.
 #include "story/storyIntro.hpp"      // Supplies dragon dialogue references used by the UI.
 #include "story/quests.hpp"          // Reads quest metadata to finish quests once destinations are chosen.
 #include "helper/colorHelper.hpp"    // Applies color palettes to map labels and node outlines.
+#include "resources/assetProfiler.hpp" // Notes the first on-screen size of drawn art for --asset-report.
 #include "helper/textColorHelper.hpp"// Draws highlighted text segments inside popups.
 #include "rendering/textLayout.hpp"  // Wraps multi-line descriptions shown near the map.
 
@@ -22,42 +23,11 @@ namespace {
     constexpr std::size_t kLocationCount = 5;
     constexpr float kUmbraOverlayFadeDuration = 2.f;
 
-    std::optional<sf::FloatRect> computeNormalizedContentBounds(const sf::Texture* texture) {
+    // Overlay hitbox (pixels with alpha > 16), precomputed when the texture was loaded.
+    std::optional<sf::FloatRect> computeNormalizedContentBounds(const Resources& resources, const sf::Texture* texture) {
         if (!texture)
             return std::nullopt;
-        sf::Image image = texture->copyToImage();
-        auto size = image.getSize();
-        if (size.x == 0 || size.y == 0)
-            return std::nullopt;
-
-        unsigned int minX = size.x;
-        unsigned int minY = size.y;
-        unsigned int maxX = 0;
-        unsigned int maxY = 0;
-        bool found = false;
-
-        for (unsigned int y = 0; y < size.y; ++y) {
-            for (unsigned int x = 0; x < size.x; ++x) {
-                if (image.getPixel({ x, y }).a <= 16)
-                    continue;
-                found = true;
-                minX = std::min(minX, x);
-                minY = std::min(minY, y);
-                maxX = std::max(maxX, x);
-                maxY = std::max(maxY, y);
-            }
-        }
-
-        if (!found)
-            return std::nullopt;
-
-        float width = static_cast<float>(std::max(1u, maxX - minX + 1));
-        float height = static_cast<float>(std::max(1u, maxY - minY + 1));
-
-        return sf::FloatRect{
-            { static_cast<float>(minX) / static_cast<float>(size.x), static_cast<float>(minY) / static_cast<float>(size.y) },
-            { width / static_cast<float>(size.x), height / static_cast<float>(size.y) }
-        };
+        return resources.opaqueBounds(*texture).solid;
     }
 
     struct LocationItem {
@@ -74,54 +44,54 @@ namespace {
 
         // Gonad - center
         LocationItem gonad;
-        gonad.overlay = &game.resources.menuMapGonad;
+        gonad.overlay = &game.resources.texture(TextureId::MenuMapGonad);
         gonad.id = LocationId::Gonad;
         gonad.mapRelativePos = { 0.f, 0.f };
         gonad.name = "Gonad";
-        gonad.normalizedContentBounds = computeNormalizedContentBounds(gonad.overlay);
+        gonad.normalizedContentBounds = computeNormalizedContentBounds(game.resources, gonad.overlay);
         out.push_back(std::move(gonad));
 
         // Lacrimere - top (move close to border, keep 2% margin)
         LocationItem lac;
-        lac.overlay = &game.resources.menuMapLacrimere;
+        lac.overlay = &game.resources.texture(TextureId::MenuMapLacrimere);
         lac.id = LocationId::Lacrimere;
         lac.mapRelativePos = { 0.f, -0.48f };
         lac.name = "Lacrimere";
-        lac.normalizedContentBounds = computeNormalizedContentBounds(lac.overlay);
+        lac.normalizedContentBounds = computeNormalizedContentBounds(game.resources, lac.overlay);
         out.push_back(std::move(lac));
 
         // Blyathyroid - right (move close to border)
         LocationItem bly;
-        bly.overlay = &game.resources.menuMapBlyathyroid;
+        bly.overlay = &game.resources.texture(TextureId::MenuMapBlyathyroid);
         bly.id = LocationId::Blyathyroid;
         bly.mapRelativePos = { 0.48f, 0.f };
         bly.name = "Blyathyroid";
-        bly.normalizedContentBounds = computeNormalizedContentBounds(bly.overlay);
+        bly.normalizedContentBounds = computeNormalizedContentBounds(game.resources, bly.overlay);
         out.push_back(std::move(bly));
 
         // Aerobronchi - bottom (move close to border)
         LocationItem aero;
-        aero.overlay = &game.resources.menuMapAerobronchi;
+        aero.overlay = &game.resources.texture(TextureId::MenuMapAerobronchi);
         aero.id = LocationId::Aerobronchi;
         aero.mapRelativePos = { 0.f, 0.48f };
         aero.name = "Aerobronchi";
-        aero.normalizedContentBounds = computeNormalizedContentBounds(aero.overlay);
+        aero.normalizedContentBounds = computeNormalizedContentBounds(game.resources, aero.overlay);
         out.push_back(std::move(aero));
 
         // Cladrenal - left (move close to border)
         LocationItem cla;
-        cla.overlay = &game.resources.menuMapCladrenal;
+        cla.overlay = &game.resources.texture(TextureId::MenuMapCladrenal);
         cla.id = LocationId::Cladrenal;
         cla.mapRelativePos = { -0.48f, 0.f };
         cla.name = "Cladrenal";
-        cla.normalizedContentBounds = computeNormalizedContentBounds(cla.overlay);
+        cla.normalizedContentBounds = computeNormalizedContentBounds(game.resources, cla.overlay);
         out.push_back(std::move(cla));
 
         LocationItem petri;
-        petri.overlay = &game.resources.menuMapPetrigonal;
+        petri.overlay = &game.resources.texture(TextureId::MenuMapPetrigonal);
         petri.mapRelativePos = { 0.f, 0.1f };
         petri.name = "Petrigonal";
-        petri.normalizedContentBounds = computeNormalizedContentBounds(petri.overlay);
+        petri.normalizedContentBounds = computeNormalizedContentBounds(game.resources, petri.overlay);
         out.push_back(std::move(petri));
 
         return out;
@@ -245,8 +215,12 @@ std::optional<LocationId> locationAtPoint(const Game& game, sf::Vector2f pt) {
 } // namespace
 
 std::optional<MapPopupRenderData> drawMapSelectionUI(Game& game, sf::RenderTarget& target) {
+    // Held while the map is on screen; Game::run releases it once the map has been gone for a while.
+    game.mapAssets.acquire();
+    game.mapDrawnThisFrame = true;
+
     // Draw the map background centered above the name/text boxes
-    const sf::Texture& mapTex = game.resources.menuMapBackground;
+    const sf::Texture& mapTex = game.resources.texture(TextureId::MenuMapBackground);
     sf::Sprite mapSprite(mapTex);
 
     // Determine desired map size based on the current view (menu panel)
@@ -267,12 +241,20 @@ std::optional<MapPopupRenderData> drawMapSelectionUI(Game& game, sf::RenderTarge
     mapSprite.setPosition({ mapX, mapY });
 
     // Draw map
+    assets::noteDraw(mapSprite);
     target.draw(mapSprite);
 
     // Build location items
     static std::vector<LocationItem> locationsCache;
-    if (locationsCache.empty())
+    if (locationsCache.empty()) {
         locationsCache = buildLocations(game);
+        core::memoryRegistry().add("ui caches", "map locations", []() {
+            core::MemoryUsage usage{ locationsCache.capacity() * sizeof(LocationItem), 0, locationsCache.size() };
+            for (const auto& location : locationsCache)
+                usage.cpuBytes += core::heapBytes(location.name);
+            return usage;
+        });
+    }
 
     // mouse pos in world coords
     auto mousePos = game.window.mapPixelToCoords(sf::Mouse::getPosition(game.window));
@@ -307,6 +289,7 @@ std::optional<MapPopupRenderData> drawMapSelectionUI(Game& game, sf::RenderTarge
         overlaySprite.setOrigin(mapSprite.getOrigin());
         overlaySprite.setPosition(mapSprite.getPosition());
         overlaySprite.setColor(color);
+        assets::noteDraw(overlaySprite);
         target.draw(overlaySprite);
     };
 
@@ -318,7 +301,7 @@ std::optional<MapPopupRenderData> drawMapSelectionUI(Game& game, sf::RenderTarge
     };
 
     float umbraAlpha = 0.f;
-    bool umbraActive = game.menuMapUmbraOverlayActive && game.resources.menuMapUmbraOverlay.getSize().x > 0;
+    bool umbraActive = game.menuMapUmbraOverlayActive && game.resources.texture(TextureId::MenuMapUmbraOverlay).getSize().x > 0;
     bool umbraHovered = false;
     sf::FloatRect umbraBounds{};
     if (umbraActive) {
@@ -335,7 +318,7 @@ std::optional<MapPopupRenderData> drawMapSelectionUI(Game& game, sf::RenderTarge
             }
         }
         if (!game.menuMapUmbraOverlayContentBounds)
-            game.menuMapUmbraOverlayContentBounds = computeNormalizedContentBounds(&game.resources.menuMapUmbraOverlay);
+            game.menuMapUmbraOverlayContentBounds = computeNormalizedContentBounds(game.resources, &game.resources.texture(TextureId::MenuMapUmbraOverlay));
         if (game.menuMapUmbraOverlayContentBounds)
             umbraBounds = toGlobalRect(*game.menuMapUmbraOverlayContentBounds);
         else
@@ -503,7 +486,7 @@ std::optional<MapPopupRenderData> drawMapSelectionUI(Game& game, sf::RenderTarge
             ? ColorHelper::darken(ColorHelper::Palette::Normal, 0.18f)
             : ColorHelper::Palette::Normal;
         sf::Color overlayColor = ColorHelper::applyAlphaFactor(baseColor, 0.9f * umbraAlpha);
-        drawOverlaySprite(&game.resources.menuMapUmbraOverlay, overlayColor);
+        drawOverlaySprite(&game.resources.texture(TextureId::MenuMapUmbraOverlay), overlayColor);
     }
 
     return pendingPopup;
@@ -555,9 +538,9 @@ namespace {
                 std::size_t offset = 0;
                 while (offset <= segment.text.size()) {
                     std::size_t newlinePos = segment.text.find('\n', offset);
-                    std::string part = (newlinePos == std::string::npos)
+                    std::string part{ (newlinePos == std::string_view::npos)
                         ? segment.text.substr(offset)
-                        : segment.text.substr(offset, newlinePos - offset);
+                        : segment.text.substr(offset, newlinePos - offset) };
 
                     if (!part.empty()) {
                         sf::Text drawable(game.resources.uiFont, sf::String(), charSize);
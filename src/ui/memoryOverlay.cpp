@@ -0,0 +1,100 @@
+// === C++ Libraries ===
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <utility>
+
+// === SFML Libraries ===
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Window/Keyboard.hpp>
+
+// === Header Files ===
+#include "memoryOverlay.hpp"
+#include "../core/memoryRegistry.hpp"
+#include "../helper/colorHelper.hpp"
+
+namespace ui::memory {
+
+namespace {
+constexpr float kVisibleSampleSeconds = 0.5f;
+constexpr float kReportSampleSeconds = 1.f;
+constexpr unsigned int kTextSize = 14;
+constexpr float kLineHeight = 18.f;
+constexpr float kPadding = 8.f;
+constexpr float kPanelWidth = 420.f;
+constexpr float kCpuColumn = 230.f;
+constexpr float kGpuColumn = 300.f;
+constexpr float kItemsColumn = 370.f;
+
+std::string megabytes(std::size_t bytes) {
+    std::ostringstream text;
+    text << std::fixed << std::setprecision(1) << static_cast<double>(bytes) / (1024.0 * 1024.0);
+    return text.str();
+}
+} // namespace
+
+bool handleEvent(OverlayState& state, const sf::Event& event) {
+    auto key = event.getIf<sf::Event::KeyPressed>();
+    if (!key || key->scancode != sf::Keyboard::Scan::F3)
+        return false;
+    state.visible = !state.visible;
+    if (state.visible) {
+        // Show numbers in the first frame instead of after the first interval.
+        core::memoryRegistry().sample();
+        state.sampleClock.restart();
+    }
+    return true;
+}
+
+void update(OverlayState& state, bool memReport) {
+    if (!state.visible && !memReport)
+        return;
+    float interval = state.visible ? kVisibleSampleSeconds : kReportSampleSeconds;
+    if (state.sampleClock.getElapsedTime().asSeconds() < interval)
+        return;
+    core::memoryRegistry().sample();
+    state.sampleClock.restart();
+}
+
+void drawOverlay(const OverlayState& state, sf::RenderTarget& target, const sf::Font& font) {
+    if (!state.visible)
+        return;
+
+    const auto& sources = core::memoryRegistry().sources();
+    float panelHeight = kPadding * 2.f + kLineHeight * static_cast<float>(sources.size() + 2);
+    sf::Vector2f origin{ target.getView().getSize().x - kPanelWidth - kPadding, kPadding };
+
+    sf::RectangleShape panel({ kPanelWidth, panelHeight });
+    panel.setPosition(origin);
+    panel.setFillColor(sf::Color(4, 4, 6, 210));
+    target.draw(panel);
+
+    sf::Text text{ font, "", kTextSize };
+    float y = origin.y + kPadding;
+    auto drawRow = [&](const std::string& name, const std::string& cpu, const std::string& gpu,
+                       const std::string& items, sf::Color color) {
+        text.setFillColor(color);
+        const std::pair<float, const std::string*> columns[] = {
+            { 0.f, &name }, { kCpuColumn, &cpu }, { kGpuColumn, &gpu }, { kItemsColumn, &items }
+        };
+        for (const auto& [x, value] : columns) {
+            text.setString(*value);
+            text.setPosition({ origin.x + kPadding + x, y });
+            target.draw(text);
+        }
+        y += kLineHeight;
+    };
+
+    drawRow("memory (F3)", "CPU MB", "GPU MB", "items", ColorHelper::Palette::SoftYellow);
+    for (const auto& source : sources) {
+        drawRow(source.category + " / " + source.name, megabytes(source.current.cpuBytes),
+                megabytes(source.current.gpuBytes), std::to_string(source.current.items),
+                ColorHelper::Palette::Normal);
+    }
+    const core::MemoryUsage total = core::memoryRegistry().total();
+    drawRow("total", megabytes(total.cpuBytes), megabytes(total.gpuBytes), std::to_string(total.items),
+            ColorHelper::Palette::SoftYellow);
+}
+
+} // namespace ui::memory
@@ -0,0 +1,23 @@
+#pragma once
+// === SFML Libraries ===
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/System/Clock.hpp>
+#include <SFML/Window/Event.hpp>
+
+namespace ui::memory {
+
+// F3 shows where memory goes, per core::memoryRegistry() source, refreshed twice a second.
+struct OverlayState {
+    bool visible = false;
+    sf::Clock sampleClock;  // Wall time since the last sample.
+};
+
+// Toggles the overlay on F3; returns true when the event was consumed.
+bool handleEvent(OverlayState& state, const sf::Event& event);
+// Samples the registry when it is due: while the overlay is visible, or once a second for
+// --mem-report so the peaks cover the whole session.
+void update(OverlayState& state, bool memReport);
+void drawOverlay(const OverlayState& state, sf::RenderTarget& target, const sf::Font& font);
+
+} // namespace ui::memory
@@ -27,7 +27,9 @@
 #include "core/itemActivation.hpp"
 #include "core/ranking.hpp"
 #include "helper/colorHelper.hpp"
+#include "resources/assetProfiler.hpp"
 #include "helper/textColorHelper.hpp"
+#include "rendering/iconBatch.hpp"
 #include "rendering/textLayout.hpp"
 #include "story/dialogInput.hpp"
 #include "story/textStyles.hpp"
@@ -168,16 +170,16 @@ namespace {
         if (highlight) {
             switch (*highlight) {
                 case LocationId::Aerobronchi:
-                    dragonTexture = &game.resources.spriteGustavoWindimaess;
+                    dragonTexture = &game.resources.texture(TextureId::SpriteGustavoWindimaess);
                     break;
                 case LocationId::Blyathyroid:
-                    dragonTexture = &game.resources.spriteRowstedSheacane;
+                    dragonTexture = &game.resources.texture(TextureId::SpriteRowstedSheacane);
                     break;
                 case LocationId::Cladrenal:
-                    dragonTexture = &game.resources.spriteGroundedClaymore;
+                    dragonTexture = &game.resources.texture(TextureId::SpriteGroundedClaymore);
                     break;
                 case LocationId::Lacrimere:
-                    dragonTexture = &game.resources.spriteFlawtinSeamen;
+                    dragonTexture = &game.resources.texture(TextureId::SpriteFlawtinSeamen);
                     break;
                 default:
                     break;
@@ -209,12 +211,13 @@ namespace {
         std::optional<sf::Sprite> dragonSprite;
         float dragonSpriteWidth = 0.f;
         float dragonSpriteHeight = 0.f;
-        if (dragonTexture && dragonTexture->getSize().x > 0 && dragonTexture->getSize().y > 0) {
-            dragonSprite.emplace(*dragonTexture);
+        sf::Vector2u dragonCanvas = dragonTexture ? game.resources.canvasSize(*dragonTexture) : sf::Vector2u{};
+        if (dragonCanvas.x > 0 && dragonCanvas.y > 0) {
+            dragonSprite.emplace(game.resources.canvasSprite(*dragonTexture));
             float maxDragonWidth = std::clamp(popupWidth * 0.32f, 64.f, popupWidth * 0.5f);
             float maxDragonHeight = std::clamp(popupHeight * 0.4f, 64.f, popupHeight * 0.6f);
-            float texWidth = static_cast<float>(dragonTexture->getSize().x);
-            float texHeight = static_cast<float>(dragonTexture->getSize().y);
+            float texWidth = static_cast<float>(dragonCanvas.x);
+            float texHeight = static_cast<float>(dragonCanvas.y);
             float scale = std::min(maxDragonWidth / texWidth, maxDragonHeight / texHeight);
             if (scale > 0.f) {
                 dragonSpriteWidth = texWidth * scale;
@@ -254,6 +257,7 @@ namespace {
             });
             dragonSprite->setPosition({ spriteX, spriteY });
             dragonSprite->setColor(ColorHelper::applyAlphaFactor(sf::Color::White, menuFadeFactor));
+            assets::noteDraw(*dragonSprite);
             target.draw(*dragonSprite);
         }
         game.mapTutorialOkBounds = { { buttonX, buttonY }, { kMapTutorialButtonWidth, kMapTutorialButtonHeight } };
@@ -273,9 +277,18 @@ namespace {
         };
         const sf::Color slotBackground = ColorHelper::Palette::BlackBrown;
         auto& icons = game.itemController.icons();
+        // Atlas icons are queued here and drawn together before the tooltip.
+        IconBatch iconBatch;
         auto drawSlotIcon = [&](const sf::Texture& texture, const sf::Vector2f& center, sf::Vector2f areaSize, float alphaMultiplier = 1.f, sf::Color tintColor = sf::Color::White) {
             if (texture.getSize().x <= 0 || texture.getSize().y <= 0 || areaSize.x <= 0.f || areaSize.y <= 0.f)
                 return;
+            sf::Color tint = applyAlpha(tintColor);
+            float clampedAlpha = std::clamp(alphaMultiplier, 0.f, 1.f);
+            tint.a = static_cast<std::uint8_t>(tint.a * clampedAlpha);
+            if (const auto* region = game.resources.iconAtlas.find(texture)) {
+                iconBatch.addFitted(*region, center, areaSize, tint);
+                return;
+            }
             sf::Sprite sprite(texture);
             float texWidth = static_cast<float>(texture.getSize().x);
             float texHeight = static_cast<float>(texture.getSize().y);
@@ -287,10 +300,8 @@ namespace {
             sprite.setScale({ scale, scale });
             sprite.setOrigin({ texWidth * 0.5f, texHeight * 0.5f });
             sprite.setPosition(center);
-            sf::Color tint = applyAlpha(tintColor);
-            float clampedAlpha = std::clamp(alphaMultiplier, 0.f, 1.f);
-            tint.a = static_cast<std::uint8_t>(tint.a * clampedAlpha);
             sprite.setColor(tint);
+            assets::noteDraw(sprite);
             target.draw(sprite);
         };
         auto drawEquipmentSlot = [&](const sf::Vector2f& center, const sf::Texture& icon, float slotSize, sf::Color iconTint = sf::Color::White) {
@@ -478,15 +489,17 @@ namespace {
                 headerSprite->setPosition({ baseX, iconY });
                 headerSprite->setColor(applyAlpha(sf::Color::White));
             }
-            if (headerSprite)
+            if (headerSprite) {
+                assets::noteDraw(*headerSprite);
                 target.draw(*headerSprite);
+            }
             target.draw(header);
             return headerHeight;
         };
 
         float inventoryHeaderY = columnTop + 18.f;
         float inventoryHeaderHeight = drawSectionHeader(
-            &game.resources.buttonInventory,
+            &game.resources.texture(TextureId::ButtonInventory),
             "Inventory",
             leftColumnX + (leftColumnWidth * 0.5f),
             inventoryHeaderY,
@@ -674,13 +687,18 @@ namespace {
 
             sf::Color tint = sprite.getColor();
             tint.a = static_cast<std::uint8_t>(tint.a * 0.9f);
+            if (const auto* region = game.resources.iconAtlas.find(sprite.getTexture())) {
+                iconBatch.addFitted(*region, { posX + gridCellSize * 0.5f, posY + gridCellSize * 0.5f }, iconArea, applyAlpha(tint));
+                continue;
+            }
             sprite.setColor(applyAlpha(tint));
+            assets::noteDraw(sprite);
             target.draw(sprite);
         }
 
         float characterHeaderY = columnTop + 8.f;
         float characterHeaderHeight = drawSectionHeader(
-            &game.resources.buttonCharacter,
+            &game.resources.texture(TextureId::ButtonCharacter),
             "Character",
             rightColumnX + (rightColumnWidth * 0.5f),
             characterHeaderY,
@@ -792,8 +810,8 @@ namespace {
                     return;
                 const sf::Color slotIconTint = ColorHelper::lighten(ColorHelper::Palette::MenuSectionBeige, 0.08f);
                 const sf::Texture& silhouetteTexture = (game.playerGender == Game::DragonbornGender::Female)
-                    ? (game.cloakEquipped ? game.resources.charMenuFemaleCape : game.resources.charMenuFemaleNoCape)
-                    : (game.cloakEquipped ? game.resources.charMenuMaleCape : game.resources.charMenuMaleNoCape);
+                    ? (game.cloakEquipped ? game.resources.texture(TextureId::CharMenuFemaleCape) : game.resources.texture(TextureId::CharMenuFemaleNoCape))
+                    : (game.cloakEquipped ? game.resources.texture(TextureId::CharMenuMaleCape) : game.resources.texture(TextureId::CharMenuMaleNoCape));
                 if (silhouetteTexture.getSize().x > 0 && silhouetteTexture.getSize().y > 0) {
                     sf::Sprite silhouette(silhouetteTexture);
                     auto bounds = silhouette.getLocalBounds();
@@ -820,10 +838,10 @@ namespace {
 
                 const sf::Texture& leftSlotTexture = game.equippedWeapons.leftHand
                     ? *game.equippedWeapons.leftHand
-                    : game.resources.charMenuLeftHand;
+                    : game.resources.texture(TextureId::CharMenuLeftHand);
                 const sf::Texture& rightSlotTexture = game.equippedWeapons.rightHand
                     ? *game.equippedWeapons.rightHand
-                    : game.resources.charMenuRightHand;
+                    : game.resources.texture(TextureId::CharMenuRightHand);
 
                 float slotSize = std::clamp(area.size.x * 0.18f, 50.f, 70.f);
                 constexpr int kEquipmentRows = 3;
@@ -861,7 +879,7 @@ namespace {
                 for (int row = 1; row <= 2; ++row) {
                     float rowCenterY = firstSlotCenterY + slotVerticalSpacing * static_cast<float>(row);
                     sf::Vector2f leftCenter{ leftX, rowCenterY };
-                    drawEquipmentSlot(leftCenter, game.resources.charMenuRing, slotSize, slotIconTint);
+                    drawEquipmentSlot(leftCenter, game.resources.texture(TextureId::CharMenuRing), slotSize, slotIconTint);
                     ringSlotCenters[ringIndex] = leftCenter;
                     ringSlotBounds[ringIndex] = sf::FloatRect(
                         sf::Vector2f{ leftCenter.x - (slotSize * 0.5f), leftCenter.y - (slotSize * 0.5f) },
@@ -870,7 +888,7 @@ namespace {
                     ++ringIndex;
 
                     sf::Vector2f rightCenter{ rightX, rowCenterY };
-                    drawEquipmentSlot(rightCenter, game.resources.charMenuRing, slotSize, slotIconTint);
+                    drawEquipmentSlot(rightCenter, game.resources.texture(TextureId::CharMenuRing), slotSize, slotIconTint);
                     ringSlotCenters[ringIndex] = rightCenter;
                     ringSlotBounds[ringIndex] = sf::FloatRect(
                         sf::Vector2f{ rightCenter.x - (slotSize * 0.5f), rightCenter.y - (slotSize * 0.5f) },
@@ -918,7 +936,7 @@ namespace {
                 charMenuState.cloakButtonBounds = cloakButton.getGlobalBounds();
 
                 drawSlotIcon(
-                    game.resources.charMenuCloak,
+                    game.resources.texture(TextureId::CharMenuCloak),
                     { buttonPos.x + 24.f, buttonPos.y + buttonHeight * 0.5f },
                     { 28.f, 28.f },
                     cloakActive ? 1.f : 0.8f,
@@ -983,10 +1001,10 @@ namespace {
                 constexpr int columns = 4;
                 constexpr int rows = 4;
                 const std::array<const sf::Texture*, rows> elementIcons = {
-                    &game.resources.elementAirButton,
-                    &game.resources.elementEarthButton,
-                    &game.resources.elementFireButton,
-                    &game.resources.elementWaterButton
+                    &game.resources.texture(TextureId::ElementAirButton),
+                    &game.resources.texture(TextureId::ElementEarthButton),
+                    &game.resources.texture(TextureId::ElementFireButton),
+                    &game.resources.texture(TextureId::ElementWaterButton)
                 };
                 float maxElementWidth = 0.f;
                 for (const sf::Texture* tex : elementIcons) {
@@ -1020,27 +1038,34 @@ namespace {
                     target.draw(label);
                 }
                 const std::array<const sf::Texture*, columns> artifactPlaceholders = {{
-                    &game.resources.charMenuDragonscaleSlot,
-                    &game.resources.charMenuDragonstoneSlot,
-                    &game.resources.charMenuDragonclawSlot,
-                    &game.resources.charMenuLuckyCharmSlot
+                    &game.resources.texture(TextureId::CharMenuDragonscaleSlot),
+                    &game.resources.texture(TextureId::CharMenuDragonstoneSlot),
+                    &game.resources.texture(TextureId::CharMenuDragonclawSlot),
+                    &game.resources.texture(TextureId::CharMenuLuckyCharmSlot)
                 }};
                 for (int row = 0; row < rows; ++row) {
                     float cellY = startY + static_cast<float>(row) * (cellHeight + gridSpacing);
                     float rowCenterY = cellY + cellHeight * 0.5f;
                     if (elementIcons[row] && elementIcons[row]->getSize().x > 0 && elementIcons[row]->getSize().y > 0) {
                         float elementCenterX = area.position.x + gridPadding + elementColumnWidth * 0.5f;
-                        sf::Sprite elementSprite(*elementIcons[row]);
-                        elementSprite.setOrigin({
-                            static_cast<float>(elementIcons[row]->getSize().x) * 0.5f,
-                            static_cast<float>(elementIcons[row]->getSize().y) * 0.5f
-                        });
-                        elementSprite.setScale({ 0.4f, 0.4f });
-                        elementSprite.setPosition({
-                            elementCenterX,
-                            rowCenterY
-                        });
-                        target.draw(elementSprite);
+                        if (const auto* region = game.resources.iconAtlas.find(*elementIcons[row])) {
+                            sf::Vector2f elementSize = sf::Vector2f(elementIcons[row]->getSize()) * 0.4f;
+                            iconBatch.add(*region, { sf::Vector2f{ elementCenterX, rowCenterY } - (elementSize * 0.5f), elementSize });
+                        }
+                        else {
+                            sf::Sprite elementSprite(*elementIcons[row]);
+                            elementSprite.setOrigin({
+                                static_cast<float>(elementIcons[row]->getSize().x) * 0.5f,
+                                static_cast<float>(elementIcons[row]->getSize().y) * 0.5f
+                            });
+                            elementSprite.setScale({ 0.4f, 0.4f });
+                            elementSprite.setPosition({
+                                elementCenterX,
+                                rowCenterY
+                            });
+                            assets::noteDraw(elementSprite);
+                            target.draw(elementSprite);
+                        }
                     }
                     for (int col = 0; col < columns; ++col) {
                         float cellX = artifactStartX + static_cast<float>(col) * (cellWidth + gridSpacing);
@@ -1087,6 +1112,8 @@ namespace {
             }
         }
 
+        iconBatch.draw(target);
+
         if (game.hoveredInventoryItem >= 0 && game.hoveredInventoryItem < static_cast<int>(game.inventoryItemSlots.size())) {
             const auto& slot = game.inventoryItemSlots[game.hoveredInventoryItem];
             if ((slot.iconIndex && *slot.iconIndex < icons.size()) || slot.key)
@@ -1128,6 +1155,7 @@ namespace {
         float textY = position.y + 10.f;
         float maxTextWidth = width - 32.f;
         const auto storytellerStyle = TextStyles::speakerStyle(TextStyles::SpeakerId::StoryTeller);
+        const std::string storytellerPrefix = storytellerStyle.name + ": ";
         constexpr float kTitleFontSize = 30.f;
         constexpr float kTitleIconSize = 36.f;
         constexpr float kTitleIconSpacing = 8.f;
@@ -1137,8 +1165,8 @@ namespace {
         float titleIconWidth = 0.f;
         float titleIconHeight = 0.f;
         float titleY = textY - 10.f;
-        if (game.resources.buttonHelp.getSize().x > 0 && game.resources.buttonHelp.getSize().y > 0) {
-            titleIcon.emplace(game.resources.buttonHelp);
+        if (game.resources.texture(TextureId::ButtonHelp).getSize().x > 0 && game.resources.texture(TextureId::ButtonHelp).getSize().y > 0) {
+            titleIcon.emplace(game.resources.texture(TextureId::ButtonHelp));
             auto iconBounds = titleIcon->getLocalBounds();
             float scale = iconBounds.size.y > 0.f ? (kTitleIconSize / iconBounds.size.y) : 1.f;
             scale *= kTitleIconScaleFactor;
@@ -1170,7 +1198,7 @@ namespace {
         for (std::size_t idx = 0; idx < kInventoryTutorialMessages.size(); ++idx) {
             std::vector<ColoredTextSegment> segments;
             if (idx == 0)
-                segments.push_back({ storytellerStyle.name + ": ", storytellerStyle.color });
+                segments.push_back({ storytellerPrefix, storytellerStyle.color });
             segments.push_back({ kInventoryTutorialMessages[idx], ColorHelper::Palette::Normal });
 
             drawColoredSegments(
@@ -1234,6 +1262,7 @@ namespace {
         float textY = position.y + 10.f;
         float maxTextWidth = width - 32.f;
         const auto storytellerStyle = TextStyles::speakerStyle(TextStyles::SpeakerId::StoryTeller);
+        const std::string storytellerPrefix = storytellerStyle.name + ": ";
         constexpr float kTitleFontSize = 30.f;
         constexpr float kTitleIconSize = 36.f;
         constexpr float kTitleIconSpacing = 8.f;
@@ -1243,8 +1272,8 @@ namespace {
         std::optional<sf::Sprite> titleIcon;
         float titleIconWidth = 0.f;
         float titleIconHeight = 0.f;
-        if (game.resources.buttonHelp.getSize().x > 0 && game.resources.buttonHelp.getSize().y > 0) {
-            titleIcon.emplace(game.resources.buttonHelp);
+        if (game.resources.texture(TextureId::ButtonHelp).getSize().x > 0 && game.resources.texture(TextureId::ButtonHelp).getSize().y > 0) {
+            titleIcon.emplace(game.resources.texture(TextureId::ButtonHelp));
             auto iconBounds = titleIcon->getLocalBounds();
             float scale = iconBounds.size.y > 0.f ? (kTitleIconSize / iconBounds.size.y) : 1.f;
             scale *= kTitleIconScaleFactor;
@@ -1276,7 +1305,7 @@ namespace {
         for (std::size_t idx = 0; idx < kQuestTutorialMessages.size(); ++idx) {
             std::vector<ColoredTextSegment> segments;
             if (idx == 0)
-                segments.push_back({ storytellerStyle.name + ": ", storytellerStyle.color });
+                segments.push_back({ storytellerPrefix, storytellerStyle.color });
             segments.push_back({ kQuestTutorialMessages[idx], ColorHelper::Palette::Normal });
 
             drawColoredSegments(
@@ -1375,12 +1404,12 @@ namespace {
         std::optional<sf::Sprite> titleIcon;
         float iconWidth = 0.f;
         float iconHeight = 0.f;
-        if (game.resources.buttonQuests.getSize().x > 0 && game.resources.buttonQuests.getSize().y > 0) {
-            titleIcon.emplace(game.resources.buttonQuests);
-            float scale = titleIconHeight / static_cast<float>(game.resources.buttonQuests.getSize().y);
+        if (game.resources.texture(TextureId::ButtonQuests).getSize().x > 0 && game.resources.texture(TextureId::ButtonQuests).getSize().y > 0) {
+            titleIcon.emplace(game.resources.texture(TextureId::ButtonQuests));
+            float scale = titleIconHeight / static_cast<float>(game.resources.texture(TextureId::ButtonQuests).getSize().y);
             titleIcon->setScale({ scale, scale });
-            iconWidth = static_cast<float>(game.resources.buttonQuests.getSize().x) * scale;
-            iconHeight = static_cast<float>(game.resources.buttonQuests.getSize().y) * scale;
+            iconWidth = static_cast<float>(game.resources.texture(TextureId::ButtonQuests).getSize().x) * scale;
+            iconHeight = static_cast<float>(game.resources.texture(TextureId::ButtonQuests).getSize().y) * scale;
         }
         sf::Text titleText{ game.resources.uiFont, "Quests", static_cast<unsigned int>(titleFontSize) };
         titleText.setFillColor(applyAlpha(ColorHelper::Palette::SoftYellow));
@@ -1805,8 +1834,8 @@ namespace {
         constexpr float gapBetweenSprites = 24.f;
         float availableWidth = bounds.size.x - (padding * 2.f);
         float availableHeight = bounds.size.y - (padding * 2.f);
-        sf::Sprite treeSprite(game.resources.skilltree);
-        sf::Sprite barSprite(game.resources.skillbar);
+        sf::Sprite treeSprite(game.resources.texture(TextureId::Skilltree));
+        sf::Sprite barSprite(game.resources.texture(TextureId::Skillbar));
         auto treeBounds = treeSprite.getLocalBounds();
         auto barBounds = barSprite.getLocalBounds();
         float maxTextureWidth = std::max(treeBounds.size.x, barBounds.size.x);
@@ -1838,7 +1867,9 @@ namespace {
         barSprite.setPosition({ barX, barY });
         treeSprite.setColor(ColorHelper::applyAlphaFactor(sf::Color(255, 255, 255, static_cast<std::uint8_t>(255 * 0.95f)), alphaFactor));
         barSprite.setColor(ColorHelper::applyAlphaFactor(sf::Color(255, 255, 255, static_cast<std::uint8_t>(255 * 0.95f)), alphaFactor));
+        assets::noteDraw(treeSprite);
         target.draw(treeSprite);
+        assets::noteDraw(barSprite);
         target.draw(barSprite);
     }
 
@@ -2284,6 +2315,7 @@ void draw(Game& game, sf::RenderTarget& target) {
     float tabFade = game.menuActive ? 1.f : 0.f;
     constexpr float kTabIconMaxHeight = 36.f;
     constexpr float kTabIconLabelSpacing = 10.f;
+    IconBatch tabIcons;
     for (std::size_t idx = 0; idx < kTabLabels.size(); ++idx) {
         const auto& bounds = game.menuTabBounds[idx];
         if (bounds.size.x <= 0.f || bounds.size.y <= 0.f)
@@ -2306,9 +2338,9 @@ void draw(Game& game, sf::RenderTarget& target) {
 
         const sf::Texture* icon = nullptr;
         switch (static_cast<MenuTab>(idx)) {
-            case MenuTab::Inventory: icon = &game.resources.buttonInventory; break;
-            case MenuTab::Map: icon = &game.resources.buttonMap; break;
-            case MenuTab::Quests: icon = &game.resources.buttonQuests; break;
+            case MenuTab::Inventory: icon = &game.resources.texture(TextureId::ButtonInventory); break;
+            case MenuTab::Map: icon = &game.resources.texture(TextureId::ButtonMap); break;
+            case MenuTab::Quests: icon = &game.resources.texture(TextureId::ButtonQuests); break;
         }
 
         std::optional<sf::Sprite> sprite;
@@ -2339,9 +2371,16 @@ void draw(Game& game, sf::RenderTarget& target) {
 
         if (sprite.has_value()) {
             float iconY = bounds.position.y + (bounds.size.y - iconHeight) * 0.5f;
-            sprite->setPosition({ currentX, iconY });
-            sprite->setColor(ColorHelper::applyAlphaFactor(sprite->getColor(), menuFadeFactor));
-            target.draw(*sprite);
+            sf::Color iconColor = ColorHelper::applyAlphaFactor(sprite->getColor(), menuFadeFactor);
+            if (const auto* region = game.resources.iconAtlas.find(*icon)) {
+                tabIcons.add(*region, { { currentX, iconY }, { iconWidth, iconHeight } }, iconColor);
+            }
+            else {
+                sprite->setPosition({ currentX, iconY });
+                sprite->setColor(iconColor);
+                assets::noteDraw(*sprite);
+                target.draw(*sprite);
+            }
             currentX += iconWidth + spacing;
         }
 
@@ -2349,6 +2388,7 @@ void draw(Game& game, sf::RenderTarget& target) {
         label.setPosition({ currentX, labelY });
         target.draw(label);
     }
+    tabIcons.draw(target);
 
     game.menuPanel.setFillColor(ColorHelper::applyAlphaFactor(sf::Color(54, 33, 18), menuFadeFactor));
     game.menuPanel.setOutlineColor(ColorHelper::applyAlphaFactor(sf::Color::White, menuFadeFactor));
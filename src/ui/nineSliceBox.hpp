@@ -5,6 +5,7 @@
 #include <SFML/Graphics.hpp>  // Provides texture, color, sprite, and shape helpers for drawing frames.
 // === Header Files ===
 #include "story/textStyles.hpp"  // Supplies UI palette colors for the default frame tint.
+#include "resources/contentStore.hpp"  // Loads the frame, sharing an identical texture if one is loaded.
 
 class NineSliceBox {
     public:
@@ -12,10 +13,11 @@ class NineSliceBox {
         : border(borderSize) {}
     
     void load(const std::filesystem::path& path) {
-        if (!texture.loadFromFile(path)) {
+        texture = assets::contentStore().loadTexture(path.string());
+        if (!texture) {
             throw std::runtime_error("Failed to load 9-slice texture from: " + path.string());
         }
-        texSize = texture.getSize();
+        texSize = texture->getSize();
     }
 
     void draw(  sf::RenderTarget& target
@@ -41,7 +43,7 @@ class NineSliceBox {
         const int innerW = texW - 2 * border;
         const int innerH = texH - 2 * border;
 
-        sf::Sprite sprite(texture);
+        sf::Sprite sprite(*texture);
         sprite.setColor(color);
         
         // === Corners ===
@@ -130,7 +132,7 @@ class NineSliceBox {
     }
 
     private:
-        sf::Texture texture;
+        const sf::Texture* texture = nullptr;
         sf::Vector2u texSize{};
         int border;
 };
@@ -19,6 +19,7 @@
 #include "helper/layoutHelpers.hpp" // Recalculates UI layout when the quiz pops up.
 #include "rendering/textLayout.hpp" // Wraps quiz text inside the question popup.
 #include "rendering/locations.hpp" // Maps LocationId values to the correct dragon speaker info.
+#include "resources/assetUsage.hpp" // Notes quiz sound plays for --trace-asset-usage.
 #include "story/textStyles.hpp"   // Provides dragon speaker names/colors used by quizzes.
 #include "story/storyIntro.hpp"   // Retrieves quiz scripts and responses linked to each dragon.
 #include "ui/treasureChestUI.hpp"  // Displays the treasure chest reward overlay.
@@ -290,11 +291,13 @@ namespace {
                 if (quiz.selectionCorrect) {
                     if (game.quizCorrectSound) {
                         game.quizCorrectSound->stop();
+                        assets::notePlay(*game.quizCorrectSound);
                         game.quizCorrectSound->play();
                     }
                 }
                 else if (game.quizIncorrectSound) {
                     game.quizIncorrectSound->stop();
+                    assets::notePlay(*game.quizIncorrectSound);
                     game.quizIncorrectSound->play();
                     int damage = std::max(0, static_cast<int>(std::ceil(game.playerHp)) - 1);
                     startHpLoss(game, damage);
@@ -331,6 +334,7 @@ namespace {
         auto& quiz = game.quiz;
         if (game.quizQuestionStartSound) {
             game.quizQuestionStartSound->stop();
+            assets::notePlay(*game.quizQuestionStartSound);
             game.quizQuestionStartSound->play();
         }
         quiz.questionAudioPhase = Game::QuizData::QuestionAudioPhase::QuestionStart;
@@ -501,6 +505,7 @@ namespace {
 
         if (game.quizLoggingSound) {
             game.quizLoggingSound->stop();
+            assets::notePlay(*game.quizLoggingSound);
             game.quizLoggingSound->play();
         }
     }
@@ -574,6 +579,7 @@ static void updateQuestionAudio(Game& game) {
         game.quizQuestionStartSound->stop();
     if (game.quizQuestionThinkingSound) {
         game.quizQuestionThinkingSound->setLooping(true);
+        assets::notePlay(*game.quizQuestionThinkingSound);
         game.quizQuestionThinkingSound->play();
     }
     quiz.questionAudioPhase = Game::QuizData::QuestionAudioPhase::Thinking;
@@ -596,6 +602,8 @@ void startQuiz(Game& game, LocationId targetLocation, std::size_t questionIndex)
     quiz.locationMusicMuted = false;
     quiz.suppressNextQuestionStartRestart = false;
     stopQuestionAudio(game);
+    // Usually decoded during the quiz intro; waits here only if startQuiz came first.
+    game.quizAssets.finish();
 
     game.quiz.active = true;
     game.state = GameState::Quiz;
@@ -829,12 +837,14 @@ void beginQuestionAudio(Game& game) {
         quiz.questionStartSuppressed = false;
         if (game.quizQuestionThinkingSound) {
             game.quizQuestionThinkingSound->setLooping(true);
+            assets::notePlay(*game.quizQuestionThinkingSound);
             game.quizQuestionThinkingSound->play();
         }
         quiz.questionAudioPhase = Game::QuizData::QuestionAudioPhase::Thinking;
     } else {
         if (game.quizQuestionStartSound) {
             game.quizQuestionStartSound->setLooping(false);
+            assets::notePlay(*game.quizQuestionStartSound);
             game.quizQuestionStartSound->play();
         }
         quiz.questionAudioPhase = Game::QuizData::QuestionAudioPhase::QuestionStart;
@@ -901,6 +911,7 @@ void presentDragonstoneReward(Game& game) {
     stopQuestionAudio(game);
     game.quiz.quizAutoStarted = false;
     game.quiz.active = false;
+    game.quizAssets.release();
     game.state = GameState::Dialogue;
     game.lastCompletedLocation = location;
     game.locationCompleted[locIndex(location)] = true;
@@ -1011,7 +1022,7 @@ namespace {
         }
 
         appendDialogue(finalThanks);
-        game.setBackgroundTexture(game.resources.backgroundToryTailor);
+        game.setBackgroundTexture(game.resources.handle(TextureId::BackgroundToryTailor));
 
         game.currentDialogue = &game.transientDialogue;
         game.dialogueIndex = 0;
@@ -7,10 +7,10 @@
 // === SFML Libraries ===
 #include <SFML/Graphics/Font.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
-#include <SFML/System/Clock.hpp>
 #include <SFML/Window/Event.hpp>
 
 // === Header Files ===
+#include "../core/simulationClock.hpp"
 #include "../core/ranking.hpp"
 
 namespace ui::ranking {
@@ -26,8 +26,8 @@ struct OverlayState {
     float scrollOffset = 0.f;
     float showDelay = 2.5f;
     int playerRank = -1;
-    sf::Clock fadeClock;
-    sf::Clock popupClock;
+    core::SimClock fadeClock;
+    core::SimClock popupClock;
 };
 
 void triggerOverlay(OverlayState& state, int playerRank);
@@ -102,11 +102,11 @@ std::string trophyKeyFor(LocationId location) {
 }
 const sf::Texture* chestTextureFor(LocationId location, const Game& game) {
     switch (location) {
-        case LocationId::Blyathyroid: return &game.resources.treasureChestFire;
-        case LocationId::Aerobronchi: return &game.resources.treasureChestAir;
-        case LocationId::Lacrimere: return &game.resources.treasureChestWater;
-        case LocationId::Cladrenal: return &game.resources.treasureChestEarth;
-        default: return &game.resources.treasureChestFire;
+        case LocationId::Blyathyroid: return &game.resources.texture(TextureId::TreasureChestFire);
+        case LocationId::Aerobronchi: return &game.resources.texture(TextureId::TreasureChestAir);
+        case LocationId::Lacrimere: return &game.resources.texture(TextureId::TreasureChestWater);
+        case LocationId::Cladrenal: return &game.resources.texture(TextureId::TreasureChestEarth);
+        default: return &game.resources.texture(TextureId::TreasureChestFire);
     }
 }
 
@@ -133,8 +133,8 @@ UiVisibility computeUiVisibility(Game& game, UiElementMask elements) {
                 game.currentProcessedLine.clear();
 
                 if (game.queuedBackgroundTexture) {
-                    game.setBackgroundTexture(*game.queuedBackgroundTexture);
-                    game.queuedBackgroundTexture = nullptr;
+                    game.setBackgroundTexture(game.queuedBackgroundTexture);
+                    game.queuedBackgroundTexture = {};
                     visibility.backgroundFadeTriggered = true;
                 }
                 else if (!game.backgroundFadeInActive && !game.backgroundVisible) {
@@ -16,6 +16,8 @@
 #include "story/dialogInput.hpp"
 #include "story/textStyles.hpp"
 #include "helper/colorHelper.hpp"
+#include "resources/assetProfiler.hpp"
+#include "resources/textureLod.hpp"
 #include "ui/uiVisibility.hpp"
 #include "ui/confirmationUI.hpp"
 #include "ui/uiEffects.hpp"
@@ -194,15 +196,14 @@ void drawWeaponSelectionUI(Game& game, sf::RenderTarget& target) {
     for (std::size_t index = 0; index < candidateIndexes.size(); ++index) {
         std::size_t optionIndex = candidateIndexes[index];
         auto& option = game.weaponOptions[optionIndex];
-        const auto& texture = option.texture;
-        if (texture.getSize().x == 0 || texture.getSize().y == 0)
+        if (!option.texture || option.texture->getSize().x == 0 || option.texture->getSize().y == 0)
             continue;
+        const sf::Texture& texture = *option.texture;
 
-        sf::Sprite sprite{ texture };
         float scaleX = spriteMaxWidth / static_cast<float>(texture.getSize().x);
         float scaleY = spriteAreaHeight / static_cast<float>(texture.getSize().y);
         float scale = std::min(scaleX, scaleY);
-        sprite.setScale({ scale, scale });
+        sf::Sprite sprite = assets::lodSprite(texture, scale);
 
         auto localBounds = sprite.getLocalBounds();
         sprite.setOrigin({
@@ -225,6 +226,9 @@ void drawWeaponSelectionUI(Game& game, sf::RenderTarget& target) {
             spriteColor = ColorHelper::darken(spriteColor, 0.25f);
         spriteColor.a = static_cast<std::uint8_t>(255.f * uiAlphaFactor);
         sprite.setColor(spriteColor);
+        // The sprite may sample a downscaled level; the report row belongs to the full texture.
+        if (assets::profiler().enabled())
+            assets::profiler().noteDraw(texture, sprite.getGlobalBounds().size);
         target.draw(sprite);
 
         game.weaponSelectionPopupEntries.push_back({
@@ -0,0 +1,43 @@
+// === C++ Libraries ===
+#include <filesystem>  // Writes the test image to the temp directory and removes it again.
+#include <iostream>    // Reports failed checks.
+// === SFML Libraries ===
+#include <SFML/Graphics/Image.hpp>    // Builds the test image.
+#include <SFML/Graphics/Texture.hpp>  // Declares the textures handed out by loadTexture().
+// === Header Files ===
+#include "resources/contentStore.hpp"  // Loads the same file twice through the content store.
+#include "resources/textureLod.hpp"    // Checks which textures got downscaled levels.
+
+// Loads one file first without and then with LODs: the second call shares the first texture,
+// which must now have its levels even though the first load did not ask for them.
+int main() {
+    namespace fs = std::filesystem;
+    const fs::path path = fs::temp_directory_path() / "glandular_content_store_lod_test.png";
+    sf::Image image({ 256, 256 }, sf::Color::Red);
+    if (!image.saveToFile(path)) {
+        std::cout << "Failed to write " << path << "\n";
+        return 1;
+    }
+
+    int failures = 0;
+    const sf::Texture* plain = assets::contentStore().loadTexture(path.string());
+    if (!plain) {
+        std::cout << "Failed to load " << path << "\n";
+        ++failures;
+    } else if (assets::textureLods().levelCount(*plain) != 0) {
+        std::cout << "Failed: the first load built levels without withLods\n";
+        ++failures;
+    }
+
+    const sf::Texture* withLods = assets::contentStore().loadTexture(path.string(), true);
+    if (withLods != plain) {
+        std::cout << "Failed: the second load did not share the first texture\n";
+        ++failures;
+    } else if (withLods && assets::textureLods().levelCount(*withLods) == 0) {
+        std::cout << "Failed: the shared texture has no levels after loading it with withLods\n";
+        ++failures;
+    }
+
+    fs::remove(path);
+    return failures == 0 ? 0 : 1;
+}